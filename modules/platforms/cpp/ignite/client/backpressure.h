@@ -0,0 +1,153 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace ignite {
+
+/**
+ * Action taken when a request can not be sent because the send queues are full.
+ */
+enum class backpressure_mode {
+    /** The request fails immediately with status_code::BACKPRESSURE. */
+    FAIL,
+
+    /**
+     * The request waits in the pending requests queue until a send queue drains, and fails if the pending request
+     * timeout passes first.
+     */
+    WAIT,
+};
+
+/**
+ * Backpressure settings: limits of the data queued for sending.
+ *
+ * A slow node can not read the requests as fast as they are made, so they pile up in the send queue of its
+ * connection. Once the queue reaches the high watermark, the connection is saturated: requests are routed to other
+ * connections, and when all the connections are saturated they fail or wait, depending on the mode. The connection
+ * accepts requests again once its queue drains to the low watermark. The total size of the queues of all the
+ * connections is limited the same way, with the low watermark at half of the limit.
+ *
+ * Only supported for TCP connections on Linux and macOS, and for shared memory connections.
+ */
+class backpressure {
+public:
+    // Default
+    backpressure() = default;
+
+    /**
+     * Get high watermark of the send queue of a connection, in bytes.
+     *
+     * Zero value disables the limit. The default value is 0.
+     *
+     * @return Send queue limit.
+     */
+    [[nodiscard]] std::size_t get_send_queue_limit() const { return m_send_queue_limit; }
+
+    /**
+     * Set high watermark of the send queue of a connection, in bytes.
+     *
+     * @param limit Send queue limit.
+     */
+    void set_send_queue_limit(std::size_t limit) { m_send_queue_limit = limit; }
+
+    /**
+     * Get low watermark of the send queue of a connection, in bytes.
+     *
+     * Zero value means half of the limit. The default value is 0.
+     *
+     * @return Low watermark.
+     */
+    [[nodiscard]] std::size_t get_send_queue_low_watermark() const { return m_send_queue_low_watermark; }
+
+    /**
+     * Set low watermark of the send queue of a connection, in bytes.
+     *
+     * @param watermark Low watermark.
+     */
+    void set_send_queue_low_watermark(std::size_t watermark) { m_send_queue_low_watermark = watermark; }
+
+    /**
+     * Get high watermark of the total size of the send queues of all the connections, in bytes.
+     *
+     * Zero value disables the limit. The default value is 0.
+     *
+     * @return Total send queue limit.
+     */
+    [[nodiscard]] std::size_t get_total_send_queue_limit() const { return m_total_send_queue_limit; }
+
+    /**
+     * Set high watermark of the total size of the send queues of all the connections, in bytes.
+     *
+     * @param limit Total send queue limit.
+     */
+    void set_total_send_queue_limit(std::size_t limit) { m_total_send_queue_limit = limit; }
+
+    /**
+     * Get action taken when all the connections are saturated.
+     *
+     * The default value is backpressure_mode::FAIL.
+     *
+     * @return Mode.
+     */
+    [[nodiscard]] backpressure_mode get_mode() const { return m_mode; }
+
+    /**
+     * Set action taken when all the connections are saturated.
+     *
+     * @param mode Mode.
+     */
+    void set_mode(backpressure_mode mode) { m_mode = mode; }
+
+    /**
+     * Get watermark listener.
+     *
+     * @return Listener. Can be empty.
+     */
+    [[nodiscard]] const std::function<void(bool)> &get_listener() const { return m_listener; }
+
+    /**
+     * Set watermark listener. It is called with @c true when all the connections become saturated, and with
+     * @c false when any of them accepts requests again, so the producers can throttle themselves. Called from the
+     * network threads, so it should not block.
+     *
+     * @param listener Listener.
+     */
+    void set_listener(std::function<void(bool saturated)> listener) { m_listener = std::move(listener); }
+
+private:
+    /** Send queue limit. */
+    std::size_t m_send_queue_limit{0};
+
+    /** Send queue low watermark. */
+    std::size_t m_send_queue_low_watermark{0};
+
+    /** Total send queue limit. */
+    std::size_t m_total_send_queue_limit{0};
+
+    /** Mode. */
+    backpressure_mode m_mode{backpressure_mode::FAIL};
+
+    /** Watermark listener. */
+    std::function<void(bool)> m_listener;
+};
+
+} // namespace ignite
@@ -0,0 +1,96 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "client_runtime.h"
+
+#include "detail/client_runtime_impl.h"
+
+#include <ignite/common/ignite_error.h>
+#include <ignite/network/network.h>
+
+#include <algorithm>
+#include <thread>
+
+namespace ignite {
+
+client_runtime client_runtime::create(std::uint32_t io_threads) {
+    if (!io_threads)
+        io_threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+    auto event_loops = network::make_event_loop_group(io_threads);
+
+    // Timer callbacks of the clients handle their errors themselves.
+    auto timer = detail::thread_timer::start([](ignite_error &&) {});
+
+    return client_runtime(std::make_shared<detail::client_runtime_impl>(std::move(event_loops), std::move(timer)));
+}
+
+client_runtime client_runtime::create_external() {
+    auto loop = network::make_external_event_loop();
+    if (!loop)
+        throw ignite_error("External event loop is not supported on this platform");
+
+    // Timer callbacks of the clients handle their errors themselves.
+    auto timer = detail::thread_timer::create([](ignite_error &&) {});
+
+    return client_runtime(std::make_shared<detail::client_runtime_impl>(std::move(loop), std::move(timer)));
+}
+
+std::uint32_t client_runtime::get_io_threads() const noexcept {
+    if (!m_impl || !m_impl->get_event_loops())
+        return 0;
+
+    return std::uint32_t(m_impl->get_event_loops()->size());
+}
+
+bool client_runtime::is_external() const noexcept {
+    return m_impl && m_impl->get_external_loop();
+}
+
+int client_runtime::get_fd() const {
+    return external_loop().get_fd();
+}
+
+std::optional<std::chrono::milliseconds> client_runtime::get_timeout() const {
+    int loop_timeout = external_loop().get_timeout();
+
+    auto res = m_impl->get_timer()->get_timeout();
+    if (loop_timeout >= 0 && (!res || std::chrono::milliseconds(loop_timeout) < *res))
+        res = std::chrono::milliseconds(loop_timeout);
+
+    return res;
+}
+
+void client_runtime::on_readable() {
+    external_loop().handle_events();
+}
+
+void client_runtime::on_timer() {
+    auto &loop = external_loop();
+
+    loop.handle_timeouts();
+    m_impl->get_timer()->process();
+}
+
+network::external_event_loop &client_runtime::external_loop() const {
+    if (!is_external())
+        throw ignite_error("Runtime is not driven by an external event loop");
+
+    return *m_impl->get_external_loop();
+}
+
+} // namespace ignite
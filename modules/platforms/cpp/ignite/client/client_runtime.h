@@ -0,0 +1,158 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <ignite/common/config.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+namespace ignite {
+
+namespace detail {
+
+class client_runtime_impl;
+class cluster_connection;
+
+} // namespace detail
+
+class ignite_client;
+
+namespace network {
+
+class external_event_loop;
+
+} // namespace network
+
+/**
+ * Client runtime: network I/O threads and timer thread that can be shared by many clients.
+ *
+ * By default, every client starts its own I/O and timer threads. Clients configured with the same runtime use the
+ * runtime threads instead, so the number of threads does not depend on the number of clients. Connections are not
+ * shared: every client still connects and authenticates on its own. The threads are stopped once the runtime and all
+ * the clients configured with it are destroyed.
+ *
+ * The runtime is a handle: copies refer to the same threads.
+ *
+ * Shared I/O threads are not supported on Windows, where every client still starts its own I/O threads.
+ *
+ * A runtime created with create_external() starts no threads at all. The application polls the descriptor returned by
+ * get_fd() for reading in its own event loop, calls on_readable() when it is readable and on_timer() once the time
+ * returned by get_timeout() passes. All the network I/O, timers and client callbacks are run from these calls, so
+ * they should be made from a single thread. The timeout should be queried again after every call. There is no
+ * on_writable() counterpart: the interest in socket writability is tracked by the descriptor itself, which becomes
+ * readable once any socket can be written to.
+ *
+ * Clients with an external runtime can only be started with ignite_client::start_async(), and blocking operations
+ * must not be called from the loop thread.
+ */
+class client_runtime {
+public:
+    // Default
+    client_runtime() = default;
+
+    /**
+     * Create runtime and start its threads.
+     *
+     * @param io_threads Number of network I/O threads. Zero means the number of hardware threads.
+     * @return Runtime.
+     */
+    [[nodiscard]] IGNITE_API static client_runtime create(std::uint32_t io_threads = 0);
+
+    /**
+     * Create runtime driven by the event loop of the application. No threads are started.
+     *
+     * @return Runtime.
+     *
+     * @throw ignite_error if the platform does not support external event loops.
+     */
+    [[nodiscard]] IGNITE_API static client_runtime create_external();
+
+    /**
+     * Check whether the runtime is created. Clients configured with an empty runtime start their own threads.
+     *
+     * @return @c true if the runtime is created.
+     */
+    [[nodiscard]] bool is_created() const noexcept { return bool(m_impl); }
+
+    /**
+     * Get number of network I/O threads.
+     *
+     * @return Number of threads. Zero if the runtime is empty or the platform does not support shared I/O threads.
+     */
+    [[nodiscard]] IGNITE_API std::uint32_t get_io_threads() const noexcept;
+
+    /**
+     * Check whether the runtime is driven by the event loop of the application.
+     *
+     * @return @c true if the runtime is created with create_external().
+     */
+    [[nodiscard]] IGNITE_API bool is_external() const noexcept;
+
+    /**
+     * Get the descriptor to poll for reading. External runtime only.
+     *
+     * @return File descriptor.
+     */
+    [[nodiscard]] IGNITE_API int get_fd() const;
+
+    /**
+     * Get time until on_timer() should be called. External runtime only.
+     *
+     * @return Timeout, or @c std::nullopt if nothing is scheduled.
+     */
+    [[nodiscard]] IGNITE_API std::optional<std::chrono::milliseconds> get_timeout() const;
+
+    /**
+     * Process network events. Should be called when the descriptor is readable. Never blocks. External runtime only.
+     */
+    IGNITE_API void on_readable();
+
+    /**
+     * Initiate due connection attempts and run due timer callbacks. External runtime only.
+     */
+    IGNITE_API void on_timer();
+
+private:
+    friend class detail::cluster_connection;
+    friend class ignite_client;
+
+    /**
+     * Constructor.
+     *
+     * @param impl Implementation.
+     */
+    explicit client_runtime(std::shared_ptr<detail::client_runtime_impl> impl)
+        : m_impl(std::move(impl)) {}
+
+    /**
+     * Get event loop driven by the application.
+     *
+     * @return Event loop.
+     *
+     * @throw ignite_error if the runtime is not external.
+     */
+    [[nodiscard]] network::external_event_loop &external_loop() const;
+
+    /** Implementation. */
+    std::shared_ptr<detail::client_runtime_impl> m_impl;
+};
+
+} // namespace ignite
@@ -0,0 +1,70 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/client/client_runtime.h"
+
+#include "ignite/common/ignite_error.h"
+
+#include <gtest/gtest.h>
+
+#include <poll.h>
+
+using namespace ignite;
+
+TEST(client_runtime, empty) {
+    client_runtime runtime;
+
+    EXPECT_FALSE(runtime.is_created());
+    EXPECT_FALSE(runtime.is_external());
+    EXPECT_EQ(0u, runtime.get_io_threads());
+    EXPECT_THROW((void) runtime.get_fd(), ignite_error);
+}
+
+TEST(client_runtime, threads) {
+    auto runtime = client_runtime::create(2);
+
+    EXPECT_TRUE(runtime.is_created());
+    EXPECT_FALSE(runtime.is_external());
+    EXPECT_EQ(2u, runtime.get_io_threads());
+
+    EXPECT_THROW((void) runtime.get_fd(), ignite_error);
+    EXPECT_THROW((void) runtime.get_timeout(), ignite_error);
+    EXPECT_THROW(runtime.on_readable(), ignite_error);
+    EXPECT_THROW(runtime.on_timer(), ignite_error);
+}
+
+TEST(client_runtime, external) {
+    auto runtime = client_runtime::create_external();
+
+    EXPECT_TRUE(runtime.is_created());
+    EXPECT_TRUE(runtime.is_external());
+    EXPECT_EQ(0u, runtime.get_io_threads());
+
+    EXPECT_GE(runtime.get_fd(), 0);
+    EXPECT_FALSE(runtime.get_timeout().has_value());
+
+    // Nothing is ready without clients.
+    pollfd pfd{runtime.get_fd(), POLLIN, 0};
+    EXPECT_EQ(0, poll(&pfd, 1, 0));
+
+    runtime.on_readable();
+    runtime.on_timer();
+
+    // Copies refer to the same loop.
+    auto copy = runtime;
+    EXPECT_EQ(runtime.get_fd(), copy.get_fd());
+}
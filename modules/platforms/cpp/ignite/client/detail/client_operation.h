@@ -23,6 +23,9 @@ namespace ignite::detail {
  * Client operation code.
  */
 enum class client_operation {
+    /** Heartbeat. */
+    HEARTBEAT = 1,
+
     /** Get all tables. */
     TABLES_GET = 3,
 
@@ -76,6 +79,24 @@ enum class client_operation {
 
     /** Get and delete tuple. */
     TUPLE_GET_AND_DELETE = 32,
+
+    /** Execute compute job. */
+    COMPUTE_EXECUTE = 47,
+
+    /** Get cluster nodes. */
+    CLUSTER_GET_NODES = 48,
+
+    /** Execute SQL query. */
+    SQL_EXEC = 50,
+
+    /** Get next page of the SQL cursor. */
+    SQL_CURSOR_NEXT_PAGE = 51,
+
+    /** Close SQL cursor. */
+    SQL_CURSOR_CLOSE = 52,
+
+    /** Get partition assignment. */
+    PARTITION_ASSIGNMENT_GET = 53,
 };
 
 /**
@@ -89,4 +110,12 @@ enum class message_type {
     NOTIFICATION = 1,
 };
 
+/**
+ * Response flags.
+ */
+enum class response_flag {
+    /** Partition assignment has changed since the previous response. */
+    PARTITION_ASSIGNMENT_CHANGED = 1,
+};
+
 } // namespace ignite::detail
@@ -0,0 +1,88 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <ignite/client/detail/thread_timer.h>
+
+#include <ignite/network/event_loop_group.h>
+#include <ignite/network/external_event_loop.h>
+
+#include <memory>
+
+namespace ignite::detail {
+
+/**
+ * Client runtime implementation.
+ */
+class client_runtime_impl {
+public:
+    /**
+     * Constructor.
+     *
+     * @param event_loops Event loops. Can be null if not supported.
+     * @param timer Timer.
+     */
+    client_runtime_impl(std::shared_ptr<network::event_loop_group> event_loops, std::shared_ptr<thread_timer> timer)
+        : m_event_loops(std::move(event_loops))
+        , m_external_loop(std::dynamic_pointer_cast<network::external_event_loop>(m_event_loops))
+        , m_timer(std::move(timer)) {}
+
+    /**
+     * Destructor.
+     */
+    ~client_runtime_impl() { m_timer->stop(); }
+
+    // Deleted
+    client_runtime_impl(const client_runtime_impl &) = delete;
+    client_runtime_impl &operator=(const client_runtime_impl &) = delete;
+
+    /**
+     * Get event loops.
+     *
+     * @return Event loops. Can be null.
+     */
+    [[nodiscard]] const std::shared_ptr<network::event_loop_group> &get_event_loops() const { return m_event_loops; }
+
+    /**
+     * Get event loop driven by the application.
+     *
+     * @return Event loop. Null if the runtime has its own threads.
+     */
+    [[nodiscard]] const std::shared_ptr<network::external_event_loop> &get_external_loop() const {
+        return m_external_loop;
+    }
+
+    /**
+     * Get timer.
+     *
+     * @return Timer.
+     */
+    [[nodiscard]] const std::shared_ptr<thread_timer> &get_timer() const { return m_timer; }
+
+private:
+    /** Event loops. */
+    std::shared_ptr<network::event_loop_group> m_event_loops;
+
+    /** Event loop driven by the application. */
+    std::shared_ptr<network::external_event_loop> m_external_loop;
+
+    /** Timer. */
+    std::shared_ptr<thread_timer> m_timer;
+};
+
+} // namespace ignite::detail
@@ -17,24 +17,45 @@
 
 #include "cluster_connection.h"
 
-#include <ignite/network/codec.h>
-#include <ignite/network/codec_data_filter.h>
-#include <ignite/network/length_prefix_codec.h>
+#include <ignite/client/detail/client_runtime_impl.h>
+
 #include <ignite/network/network.h>
 #include <ignite/protocol/writer.h>
 
+#include <algorithm>
 #include <iterator>
+#include <random>
+#include <utility>
 
 namespace ignite::detail {
 
-cluster_connection::cluster_connection(ignite_client_configuration configuration)
+namespace {
+
+/**
+ * Get random generator of the current thread.
+ *
+ * @return Generator.
+ */
+std::mt19937 &random_generator() {
+    thread_local std::mt19937 generator(std::random_device{}());
+
+    return generator;
+}
+
+} // namespace
+
+cluster_connection::cluster_connection(
+    ignite_client_configuration configuration, std::shared_ptr<network::async_client_pool> pool)
     : m_configuration(std::move(configuration))
     , m_pool()
-    , m_logger(m_configuration.get_logger())
-    , m_generator(std::random_device()()) {
+    , m_provided_pool(std::move(pool))
+    , m_logger(m_configuration.get_logger()) {
+    if (m_configuration.get_batch_threads())
+        m_batch_pool = std::make_unique<thread_pool>(m_configuration.get_batch_threads());
 }
 
-void cluster_connection::start_async(std::function<void(ignite_result<void>)> callback) {
+void cluster_connection::start_async(
+    std::function<void(ignite_result<void>)> callback, std::function<void(ignite_callback<void>)> warmup) {
     using namespace network;
 
     if (m_pool)
@@ -50,40 +71,101 @@ void cluster_connection::start_async(std::function<void(ignite_result<void>)> ca
         addrs.push_back(std::move(ep.value()));
     }
 
-    data_filters filters;
+    m_configured_addrs = addrs;
+    m_addrs = addrs;
+
+    // Every address range gives at most one connection.
+    auto max_connections = std::uint32_t(addrs.size());
+    if (m_configuration.get_connection_limit())
+        max_connections = std::min(max_connections, m_configuration.get_connection_limit());
+
+    m_min_connections =
+        std::max(std::uint32_t(1), std::min(m_configuration.get_warmup().get_min_connections(), max_connections));
+
+    transport_configuration transport_cfg;
+    transport_cfg.shared_memory_enabled = m_configuration.is_shared_memory_enabled();
+    transport_cfg.submission_queue_enabled = m_configuration.is_submission_queue_enabled();
+    transport_cfg.zero_copy_threshold = m_configuration.get_zero_copy_threshold();
+    transport_cfg.io_thread_cpu = m_configuration.get_io_thread_cpu();
+    transport_cfg.send_queue_limit = m_configuration.get_backpressure().get_send_queue_limit();
+    transport_cfg.send_queue_low_watermark = m_configuration.get_backpressure().get_send_queue_low_watermark();
+    transport_cfg.total_send_queue_limit = m_configuration.get_backpressure().get_total_send_queue_limit();
+    switch (m_configuration.get_socket_profile()) {
+        case ignite::socket_profile::LOW_LATENCY:
+            transport_cfg.profile = network::socket_profile::LOW_LATENCY;
+            break;
+        case ignite::socket_profile::THROUGHPUT:
+            transport_cfg.profile = network::socket_profile::THROUGHPUT;
+            break;
+        default:
+            transport_cfg.profile = network::socket_profile::DEFAULT;
+            break;
+    }
 
-    std::shared_ptr<factory<codec>> codec_factory = std::make_shared<length_prefix_codec_factory>();
-    std::shared_ptr<codec_data_filter> codec_filter(new network::codec_data_filter(codec_factory));
-    filters.push_back(codec_filter);
+    const auto &runtime = m_configuration.get_runtime().m_impl;
+    if (runtime)
+        transport_cfg.event_loops = runtime->get_event_loops();
 
-    m_pool = network::make_async_client_pool(filters);
+    m_pool = m_provided_pool ? m_provided_pool : network::make_default_async_client_pool(transport_cfg);
 
     m_pool->set_handler(shared_from_this());
 
+    if (runtime) {
+        m_timer = runtime->get_timer();
+    } else {
+        m_timer = thread_timer::start([logger = m_logger](ignite_error &&err) {
+            logger->log_error("Unhandled error in timer callback: " + err.what_str());
+        });
+    }
+
     m_on_initial_connect = std::move(callback);
+    m_warmup = std::move(warmup);
 
     m_pool->start(std::move(addrs), m_configuration.get_connection_limit());
+
+    schedule_topology_refresh();
+    schedule_outlier_detection();
+}
+
+void cluster_connection::set_start_timeout(std::chrono::milliseconds timeout) {
+    schedule(timeout, [self_weak = weak_from_this()]() {
+        if (auto self = self_weak.lock())
+            self->initial_connect_result({ignite_error("Can not establish connection within timeout")});
+    });
 }
 
 void cluster_connection::stop() {
+    m_stopped = true;
+
+    // The timer of the runtime is shared with other clients.
+    auto timer = m_timer;
+    if (timer && !m_configuration.get_runtime().is_created())
+        timer->stop();
+
     auto pool = m_pool;
     if (pool)
         pool->stop();
+
+    std::deque<pending_request> pending;
+    {
+        std::lock_guard<std::mutex> lock(m_pending_requests_mutex);
+        std::swap(pending, m_pending_requests);
+    }
+
+    for (auto &request : pending)
+        fail_request(*request.handler, ignite_error(status_code::NETWORK, "Client is stopped"));
 }
 
 void cluster_connection::on_connection_success(const network::end_point &addr, uint64_t id) {
     m_logger->log_info("Established connection with remote host " + addr.to_string());
     m_logger->log_debug("Connection ID: " + std::to_string(id));
 
-    auto connection = std::make_shared<node_connection>(id, m_pool, m_logger);
-    {
-        [[maybe_unused]] std::unique_lock<std::recursive_mutex> lock(m_connections_mutex);
-
-        auto [_it, was_new] = m_connections.insert_or_assign(id, connection);
-        if (!was_new)
-            m_logger->log_error(
-                "Unknown error: connecting is already in progress. Connection ID: " + std::to_string(id));
-    }
+    auto connection = std::make_shared<node_connection>(id, addr, m_pool, m_logger, [self_weak = weak_from_this()]() {
+        if (auto self = self_weak.lock())
+            ++self->m_assignment_version;
+    });
+    if (m_connections.insert(id, connection))
+        m_logger->log_error("Unknown error: connecting is already in progress. Connection ID: " + std::to_string(id));
 
     try {
         bool res = connection->handshake();
@@ -109,7 +191,66 @@ void cluster_connection::on_connection_error(const network::end_point &addr, ign
 
 void cluster_connection::on_connection_closed(uint64_t id, std::optional<ignite_error> err) {
     m_logger->log_debug("Closed Connection ID " + std::to_string(id) + ", error=" + (err ? err->what() : "none"));
+    auto connection = find_client(id);
     remove_client(id);
+
+    // The partitions of the node are routed elsewhere until the assignment is reloaded.
+    if (connection && connection->is_handshake_complete())
+        ++m_assignment_version;
+
+    update_send_queue_saturation();
+}
+
+void cluster_connection::on_send_queue_saturation(uint64_t id, bool saturated) {
+    m_logger->log_debug(std::string("Send queue is ") + (saturated ? "saturated" : "drained")
+        + " on Connection ID " + std::to_string(id));
+
+    auto connection = find_client(id);
+    if (connection)
+        connection->set_send_queue_saturated(saturated);
+
+    update_send_queue_saturation();
+
+    if (saturated || !connection || !connection->is_handshake_complete())
+        return;
+
+    drain_pending_requests(std::move(connection));
+}
+
+void cluster_connection::on_total_send_queue_saturation(bool saturated) {
+    m_logger->log_debug(std::string("Total size of the send queues is ") + (saturated ? "saturated" : "drained"));
+
+    m_total_send_queue_saturated.store(saturated);
+    update_send_queue_saturation();
+
+    if (saturated)
+        return;
+
+    if (auto connection = get_random_channel())
+        drain_pending_requests(std::move(connection));
+}
+
+void cluster_connection::update_send_queue_saturation() {
+    const auto &listener = m_configuration.get_backpressure().get_listener();
+    if (!listener)
+        return;
+
+    bool ready = false;
+    bool saturated = true;
+    for (auto &connection : m_connections.values()) {
+        if (!connection->is_handshake_complete())
+            continue;
+
+        ready = true;
+        if (!connection->is_send_queue_saturated()) {
+            saturated = false;
+            break;
+        }
+    }
+
+    saturated = ready && (saturated || m_total_send_queue_saturated.load());
+    if (m_send_queues_saturated.exchange(saturated) != saturated)
+        listener(saturated);
 }
 
 void cluster_connection::on_message_received(uint64_t id, bytes_view msg) {
@@ -125,20 +266,24 @@ void cluster_connection::on_message_received(uint64_t id, bytes_view msg) {
     }
 
     auto res = connection->process_handshake_rsp(msg);
-    if (res.has_error())
+    if (res.has_error()) {
         remove_client(connection->id());
+        initial_connect_result(std::move(res));
+        return;
+    }
 
-    initial_connect_result(std::move(res));
-}
+    // The assignment may route the reads to the node now, or to a new node ID if the node was restarted.
+    ++m_assignment_version;
 
-std::shared_ptr<node_connection> cluster_connection::find_client(uint64_t id) {
-    [[maybe_unused]] std::unique_lock<std::recursive_mutex> lock(m_connections_mutex);
+    schedule_heartbeat(connection);
+    drain_pending_requests(connection);
 
-    auto it = m_connections.find(id);
-    if (it != m_connections.end())
-        return it->second;
+    if (m_handshakes.fetch_add(1) + 1 == m_min_connections)
+        start_warmup();
+}
 
-    return {};
+std::shared_ptr<node_connection> cluster_connection::find_client(uint64_t id) {
+    return m_connections.find(id);
 }
 
 void cluster_connection::on_message_sent(uint64_t id) {
@@ -146,11 +291,261 @@ void cluster_connection::on_message_sent(uint64_t id) {
 }
 
 void cluster_connection::remove_client(uint64_t id) {
-    [[maybe_unused]] std::unique_lock<std::recursive_mutex> lock(m_connections_mutex);
-
     m_connections.erase(id);
 }
 
+void cluster_connection::schedule(std::chrono::milliseconds timeout, std::function<void()> callback) {
+    m_timer->add(timeout, [self_weak = weak_from_this(), callback = std::move(callback)]() {
+        auto self = self_weak.lock();
+        if (!self || self->m_stopped)
+            return;
+
+        // The timer can be shared with other clients, so the errors are reported to the logger of this client.
+        auto res = result_of_operation<void>(callback);
+        if (res.has_error())
+            self->m_logger->log_error("Unhandled error in timer callback: " + res.error().what_str());
+    });
+}
+
+void cluster_connection::schedule_heartbeat(const std::shared_ptr<node_connection> &connection) {
+    auto interval = m_configuration.get_heartbeat_interval();
+    if (interval.count() <= 0 || !m_timer)
+        return;
+
+    auto idle_timeout = connection->get_idle_timeout();
+    if (idle_timeout.count() > 0)
+        interval = std::min(interval, idle_timeout / 3);
+
+    interval = std::max(interval, node_connection::MIN_HEARTBEAT_INTERVAL);
+
+    schedule(interval, [self_weak = weak_from_this(), connection_weak = std::weak_ptr(connection)]() {
+        auto self = self_weak.lock();
+        auto connection = connection_weak.lock();
+        if (!self || !connection)
+            return;
+
+        if (!connection->send_heartbeat()) {
+            self->m_logger->log_warning("Too many heartbeats are not answered, closing connection. Connection ID: "
+                + std::to_string(connection->id()));
+
+            self->m_pool->close(connection->id(), ignite_error(status_code::NETWORK, "Heartbeat timeout"));
+            return;
+        }
+
+        self->schedule_heartbeat(connection);
+    });
+}
+
+void cluster_connection::schedule_topology_refresh() {
+    auto interval = m_configuration.get_topology_refresh_interval();
+    if (interval.count() <= 0 || !m_timer)
+        return;
+
+    schedule(interval, [self_weak = weak_from_this()]() {
+        if (auto self = self_weak.lock())
+            self->refresh_topology();
+    });
+}
+
+void cluster_connection::refresh_topology() {
+    auto channel = get_random_channel();
+    if (!channel) {
+        schedule_topology_refresh();
+        return;
+    }
+
+    auto client_port = channel->address().port;
+    auto reader_func = [client_port](protocol::reader &reader) { return read_cluster_nodes(reader, client_port); };
+
+    auto handler = std::make_shared<response_handler_impl<std::vector<network::end_point>>>(std::move(reader_func),
+        [self_weak = weak_from_this()](ignite_result<std::vector<network::end_point>> &&res) {
+            auto self = self_weak.lock();
+            if (!self)
+                return;
+
+            if (res.has_error())
+                self->m_logger->log_warning("Failed to get cluster nodes: " + res.error().what_str());
+            else
+                self->apply_topology(res.value());
+
+            self->schedule_topology_refresh();
+        });
+
+    bool sent = channel->perform_request(client_operation::CLUSTER_GET_NODES, [](protocol::writer &) {}, handler);
+    if (!sent)
+        schedule_topology_refresh();
+}
+
+std::vector<network::end_point> cluster_connection::read_cluster_nodes(
+    protocol::reader &reader, std::uint16_t client_port) {
+    std::vector<network::end_point> nodes;
+
+    auto count = reader.read_array_header();
+    nodes.reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        (void) reader.read_string(); // Node ID.
+        (void) reader.read_string(); // Node name.
+        auto host = reader.read_string();
+        (void) reader.read_int32(); // Cluster network port.
+
+        nodes.emplace_back(std::move(host), client_port);
+    }
+
+    return nodes;
+}
+
+void cluster_connection::schedule_outlier_detection() {
+    auto interval = m_configuration.get_outlier_detection().get_interval();
+    if (interval.count() <= 0 || !m_timer)
+        return;
+
+    schedule(interval, [self_weak = weak_from_this()]() {
+        if (auto self = self_weak.lock())
+            self->detect_outliers();
+    });
+}
+
+void cluster_connection::detect_outliers() {
+    const auto &cfg = m_configuration.get_outlier_detection();
+
+    auto connections = m_connections.values();
+    connections.erase(std::remove_if(connections.begin(), connections.end(),
+                          [](const auto &connection) { return !connection->is_handshake_complete(); }),
+        connections.end());
+
+    auto now = std::chrono::steady_clock::now();
+
+    std::size_t ejected = 0;
+    std::vector<std::pair<std::shared_ptr<node_connection>, connection_stats::snapshot>> candidates;
+    for (auto &connection : connections) {
+        switch (connection->get_outlier_state()) {
+            case outlier_state::EJECTED:
+                ++ejected;
+                if (now >= connection->m_ejected_until)
+                    probe(connection);
+                break;
+
+            case outlier_state::PROBING:
+                ++ejected;
+                break;
+
+            case outlier_state::HEALTHY: {
+                auto stats = connection->get_stats().get_snapshot();
+                if (stats.requests >= cfg.get_min_requests())
+                    candidates.emplace_back(connection, stats);
+                break;
+            }
+        }
+    }
+
+    std::vector<std::int64_t> latencies;
+    latencies.reserve(candidates.size());
+    for (const auto &[_, stats] : candidates)
+        latencies.push_back(stats.latency_p90.count());
+
+    // Latency is only compared when there are enough connections for the median to be meaningful.
+    std::optional<std::int64_t> median_latency;
+    if (latencies.size() >= 3) {
+        auto mid = latencies.begin() + ptrdiff_t(latencies.size() / 2);
+        std::nth_element(latencies.begin(), mid, latencies.end());
+        median_latency = *mid;
+    }
+
+    auto max_ejected = std::size_t(cfg.get_max_ejected_fraction() * double(connections.size()));
+    for (auto &[connection, stats] : candidates) {
+        std::string reason;
+        if (stats.error_rate() > cfg.get_error_rate_threshold()) {
+            reason = "error rate " + std::to_string(stats.error_rate());
+        } else if (median_latency && *median_latency > 0
+            && double(stats.latency_p90.count()) > cfg.get_latency_factor() * double(*median_latency)) {
+            reason = "latency " + std::to_string(stats.latency_p90.count()) + "us, median "
+                + std::to_string(*median_latency) + "us";
+        }
+
+        if (reason.empty()) {
+            // A connection that behaves well for an interval gets shorter ejections again.
+            connection->m_ejections = std::max(connection->m_ejections - 1, 0);
+            continue;
+        }
+
+        if (ejected >= max_ejected) {
+            m_logger->log_warning("Connection is an outlier (" + reason
+                + "), but too many connections are ejected already. Connection ID: " + std::to_string(connection->id()));
+            continue;
+        }
+
+        eject(*connection, reason);
+        ++ejected;
+    }
+
+    schedule_outlier_detection();
+}
+
+void cluster_connection::eject(node_connection &connection, const std::string &reason) {
+    const auto &cfg = m_configuration.get_outlier_detection();
+
+    connection.m_ejections = std::min(connection.m_ejections + 1, 10);
+    connection.m_ejected_until =
+        std::chrono::steady_clock::now() + cfg.get_base_ejection_time() * connection.m_ejections;
+    connection.m_outlier_state.store(outlier_state::EJECTED);
+
+    m_logger->log_warning(
+        "Connection is ejected from routing (" + reason + "). Connection ID: " + std::to_string(connection.id()));
+}
+
+void cluster_connection::probe(const std::shared_ptr<node_connection> &connection) {
+    connection->m_outlier_state.store(outlier_state::PROBING);
+
+    auto handler = std::make_shared<response_handler_impl<void>>([](protocol::reader &) {},
+        [self_weak = weak_from_this(), connection_weak = std::weak_ptr(connection)](ignite_result<void> &&res) {
+            auto self = self_weak.lock();
+            auto connection = connection_weak.lock();
+            if (!self || !connection)
+                return;
+
+            if (res.has_error()) {
+                self->eject(*connection, "probe failed: " + res.error().what_str());
+                return;
+            }
+
+            connection->m_stats.reset();
+            connection->m_outlier_state.store(outlier_state::HEALTHY);
+
+            self->m_logger->log_info(
+                "Connection is returned to routing. Connection ID: " + std::to_string(connection->id()));
+        });
+
+    bool sent = connection->perform_request(client_operation::HEARTBEAT, [](protocol::writer &) {}, handler);
+    if (!sent)
+        connection->m_outlier_state.store(outlier_state::EJECTED);
+}
+
+void cluster_connection::apply_topology(const std::vector<network::end_point> &nodes) {
+    std::vector<network::tcp_range> addrs;
+    {
+        std::lock_guard<std::mutex> lock(m_addrs_mutex);
+
+        addrs = m_configured_addrs;
+        for (const auto &node : nodes) {
+            bool known = std::any_of(addrs.begin(), addrs.end(), [&node](const network::tcp_range &range) {
+                return range.host == node.host && node.port >= range.port && node.port <= range.port + range.range;
+            });
+
+            if (!known)
+                addrs.emplace_back(node.host, node.port);
+        }
+
+        if (addrs == m_addrs)
+            return;
+
+        m_addrs = addrs;
+    }
+
+    m_logger->log_info("Cluster topology changed, connecting to " + std::to_string(addrs.size()) + " addresses");
+
+    m_pool->update_addresses(std::move(addrs));
+}
+
 void cluster_connection::initial_connect_result(ignite_result<void> &&res) {
     [[maybe_unused]] std::lock_guard<std::mutex> lock(m_on_initial_connect_mutex);
 
@@ -161,18 +556,240 @@ void cluster_connection::initial_connect_result(ignite_result<void> &&res) {
     m_on_initial_connect = {};
 }
 
+void cluster_connection::start_warmup() {
+    auto warmup = std::exchange(m_warmup, {});
+    if (!warmup) {
+        initial_connect_result({});
+        return;
+    }
+
+    m_logger->log_debug("Warming up after " + std::to_string(m_min_connections) + " connections are established");
+
+    auto res = result_of_operation<void>([&]() {
+        warmup([self_weak = weak_from_this()](ignite_result<void> &&res) {
+            if (auto self = self_weak.lock())
+                self->initial_connect_result(std::move(res));
+        });
+    });
+
+    if (res.has_error())
+        initial_connect_result(std::move(res));
+}
+
+bool cluster_connection::is_idempotent(client_operation op) {
+    switch (op) {
+        case client_operation::HEARTBEAT:
+        case client_operation::TABLES_GET:
+        case client_operation::TABLE_GET:
+        case client_operation::SCHEMAS_GET:
+        case client_operation::TUPLE_GET:
+        case client_operation::TUPLE_GET_ALL:
+        case client_operation::PARTITION_ASSIGNMENT_GET:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::optional<std::chrono::milliseconds> cluster_connection::get_retry_delay(
+    std::int32_t attempts, std::chrono::steady_clock::time_point deadline) {
+    const auto &policy = m_configuration.get_retry_policy();
+    if (attempts >= policy.get_max_attempts())
+        return std::nullopt;
+
+    auto backoff = policy.get_initial_backoff();
+    for (std::int32_t i = 1; i < attempts && backoff < policy.get_max_backoff(); ++i)
+        backoff *= 2;
+
+    backoff = std::min(backoff, policy.get_max_backoff());
+
+    // Jitter spreads the retries of many clients that lost their connections at the same time.
+    std::uniform_int_distribution<std::chrono::milliseconds::rep> distrib(backoff.count() / 2, backoff.count());
+    std::chrono::milliseconds delay(distrib(random_generator()));
+
+    if (std::chrono::steady_clock::now() + delay >= deadline)
+        return std::nullopt;
+
+    return delay;
+}
+
 std::shared_ptr<node_connection> cluster_connection::get_random_channel() {
-    [[maybe_unused]] std::unique_lock<std::recursive_mutex> lock(m_connections_mutex);
+    auto connections = m_connections.values();
+    if (connections.empty())
+        return {};
+
+    std::vector<std::shared_ptr<node_connection>> ready;
+    std::vector<std::shared_ptr<node_connection>> healthy;
+    ready.reserve(connections.size());
+    healthy.reserve(connections.size());
+    for (auto &connection : connections) {
+        if (!connection->is_handshake_complete())
+            continue;
+
+        ready.push_back(connection);
+        if (!connection->is_suspect() && connection->is_routable() && !connection->is_send_queue_saturated())
+            healthy.push_back(connection);
+    }
 
-    if (m_connections.empty())
+    auto &candidates = healthy.empty() ? ready : healthy;
+    if (candidates.empty())
         return {};
 
-    if (m_connections.size() == 1)
-        return m_connections.begin()->second;
+    if (candidates.size() == 1)
+        return candidates.front();
+
+    std::uniform_int_distribution<size_t> distrib(0, candidates.size() - 1);
+    return candidates[distrib(random_generator())];
+}
+
+std::shared_ptr<node_connection> cluster_connection::get_node_channel(const std::string &node_id) {
+    for (auto &connection : m_connections.values()) {
+        if (!connection->is_handshake_complete() || connection->node_id() != node_id)
+            continue;
 
-    std::uniform_int_distribution<size_t> distrib(0, m_connections.size() - 1);
-    auto idx = ptrdiff_t(distrib(m_generator));
-    return std::next(m_connections.begin(), idx)->second;
+        if (!connection->is_suspect() && connection->is_routable() && !connection->is_send_queue_saturated())
+            return connection;
+    }
+
+    return {};
+}
+
+bool cluster_connection::is_node_connected(const std::string &node_id) {
+    for (auto &connection : m_connections.values()) {
+        if (connection->is_handshake_complete() && connection->node_id() == node_id)
+            return true;
+    }
+
+    return false;
+}
+
+bool cluster_connection::enqueue_pending(
+    std::uint64_t drains, std::function<bool(node_connection &)> send, std::shared_ptr<response_handler> handler) {
+    {
+        std::lock_guard<std::mutex> lock(m_pending_requests_mutex);
+
+        // A connection became ready after the caller looked for it, and the queue may have been drained.
+        if (drains != m_pending_drains.load())
+            return false;
+
+        if (m_pending_requests.size() < m_configuration.get_pending_requests_limit()) {
+            auto deadline = std::chrono::steady_clock::now() + m_configuration.get_pending_request_timeout();
+            m_pending_requests.push_back({std::move(send), std::move(handler), deadline});
+            schedule_pending_expiration_locked();
+
+            return true;
+        }
+    }
+
+    fail_request(*handler, ignite_error(status_code::NETWORK, "No nodes connected and too many requests are pending"));
+
+    return true;
+}
+
+void cluster_connection::drain_pending_requests(std::shared_ptr<node_connection> connection) {
+    // Incremented before the queue is taken, so enqueue_pending() never adds to a queue that is already drained.
+    ++m_pending_drains;
+
+    std::deque<pending_request> pending;
+    {
+        std::lock_guard<std::mutex> lock(m_pending_requests_mutex);
+        std::swap(pending, m_pending_requests);
+    }
+
+    if (pending.empty())
+        return;
+
+    m_logger->log_debug("Sending " + std::to_string(pending.size()) + " pending requests");
+
+    while (!pending.empty()) {
+        auto sent = result_of_operation<bool>([&]() { return pending.front().send(*connection); });
+        if (sent.has_error()) {
+            // The rest waits until a send queue drains.
+            if (sent.error().get_status_code() == status_code::BACKPRESSURE)
+                break;
+
+            // Only the request that could not be sent fails, the rest is still sent.
+            auto request = std::move(pending.front());
+            pending.pop_front();
+
+            fail_request(*request.handler, std::move(sent).error());
+            continue;
+        }
+
+        if (!sent.value()) {
+            remove_client(connection->id());
+
+            connection = get_random_channel();
+            if (!connection)
+                break;
+
+            continue;
+        }
+
+        pending.pop_front();
+    }
+
+    if (pending.empty())
+        return;
+
+    // All connections were closed or saturated while draining. The requests wait for the next handshake or drain.
+    std::lock_guard<std::mutex> lock(m_pending_requests_mutex);
+
+    m_pending_requests.insert(m_pending_requests.begin(), std::make_move_iterator(pending.begin()),
+        std::make_move_iterator(pending.end()));
+
+    schedule_pending_expiration_locked();
+}
+
+void cluster_connection::expire_pending_requests() {
+    std::vector<pending_request> expired;
+    {
+        std::lock_guard<std::mutex> lock(m_pending_requests_mutex);
+        m_pending_expiration_scheduled = false;
+
+        auto now = std::chrono::steady_clock::now();
+        while (!m_pending_requests.empty() && m_pending_requests.front().deadline <= now) {
+            expired.push_back(std::move(m_pending_requests.front()));
+            m_pending_requests.pop_front();
+        }
+
+        schedule_pending_expiration_locked();
+    }
+
+    if (!expired.empty())
+        m_logger->log_warning("No connection was available in time, failing " + std::to_string(expired.size())
+            + " pending requests");
+
+    for (auto &request : expired) {
+        fail_request(*request.handler,
+            ignite_error(status_code::NETWORK, "Timed out waiting for a connection to send the request"));
+    }
+}
+
+void cluster_connection::schedule_pending_expiration_locked() {
+    if (m_pending_expiration_scheduled || m_pending_requests.empty() || !m_timer)
+        return;
+
+    auto delay = std::chrono::ceil<std::chrono::milliseconds>(
+        m_pending_requests.front().deadline - std::chrono::steady_clock::now());
+
+    m_pending_expiration_scheduled = true;
+    schedule(std::max(delay, std::chrono::milliseconds(0)), [self_weak = weak_from_this()]() {
+        if (auto self = self_weak.lock())
+            self->expire_pending_requests();
+    });
+}
+
+void cluster_connection::fail_request(response_handler &handler, ignite_error err) {
+    auto res = result_of_operation<void>([&]() {
+        auto handling_res = handler.set_error(std::move(err));
+        if (handling_res.has_error())
+            m_logger->log_error(
+                "Uncaught user callback exception while handling operation error: " + handling_res.error().what_str());
+    });
+
+    if (res.has_error())
+        m_logger->log_error("Uncaught user callback exception: " + res.error().what_str());
 }
 
 } // namespace ignite::detail
@@ -21,20 +21,30 @@
 #include <ignite/client/detail/node_connection.h>
 #include <ignite/client/detail/protocol_context.h>
 #include <ignite/client/detail/response_handler.h>
+#include <ignite/client/detail/thread_pool.h>
+#include <ignite/client/detail/thread_timer.h>
 #include <ignite/client/ignite_client_configuration.h>
 
 #include <ignite/common/ignite_result.h>
 #include <ignite/network/async_client_pool.h>
+#include <ignite/network/detail/connection_table.h>
+#include <ignite/network/end_point.h>
+#include <ignite/network/tcp_range.h>
+#include <ignite/protocol/buffer_adapter.h>
 #include <ignite/protocol/reader.h>
 #include <ignite/protocol/writer.h>
 
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
 #include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
-#include <random>
-#include <unordered_map>
+#include <optional>
+#include <string>
+#include <vector>
 
 namespace ignite::protocol {
 
@@ -61,7 +71,19 @@ public:
      * @return New instance.
      */
     static std::shared_ptr<cluster_connection> create(ignite_client_configuration configuration) {
-        return std::shared_ptr<cluster_connection>(new cluster_connection(std::move(configuration)));
+        return std::shared_ptr<cluster_connection>(new cluster_connection(std::move(configuration), {}));
+    }
+
+    /**
+     * Create new instance of the object that connects over the provided pool instead of the default one.
+     *
+     * @param configuration Configuration.
+     * @param pool Client pool. Started on start_async().
+     * @return New instance.
+     */
+    static std::shared_ptr<cluster_connection> create(
+        ignite_client_configuration configuration, std::shared_ptr<network::async_client_pool> pool) {
+        return std::shared_ptr<cluster_connection>(new cluster_connection(std::move(configuration), std::move(pool)));
     }
 
     // Deleted
@@ -77,11 +99,22 @@ public:
     ~cluster_connection() override { stop(); }
 
     /**
-     * Start establishing connection.
+     * Start establishing connection. The start completes once the minimum number of connections of the warm-up
+     * settings is established and the warm-up function completes.
      *
      * @param callback Callback.
+     * @param warmup Function to call once the connections are established. Receives the callback to complete the
+     *   start with. Can be empty.
      */
-    void start_async(std::function<void(ignite_result<void>)> callback);
+    void start_async(
+        std::function<void(ignite_result<void>)> callback, std::function<void(ignite_callback<void>)> warmup = {});
+
+    /**
+     * Fail the start if the connection is not established within the timeout.
+     *
+     * @param timeout Timeout.
+     */
+    void set_start_timeout(std::chrono::milliseconds timeout);
 
     /**
      * Stop connection.
@@ -89,28 +122,68 @@ public:
     void stop();
 
     /**
-     * Perform request.
+     * Get configuration.
+     *
+     * @return Configuration.
+     */
+    [[nodiscard]] const ignite_client_configuration &get_configuration() const { return m_configuration; }
+
+    /**
+     * Get pool of threads for batch operations.
+     *
+     * @return Thread pool, or @c nullptr if batches should be processed by a single thread.
+     */
+    [[nodiscard]] thread_pool *get_batch_pool() const { return m_batch_pool.get(); }
+
+    /**
+     * Get version of the partition assignments. It changes whenever the cached partition assignments may be stale:
+     * when the server reports a change of the assignment, and when a connection is established or closed.
+     *
+     * @return Partition assignment version.
+     */
+    [[nodiscard]] std::uint64_t get_assignment_version() const { return m_assignment_version.load(); }
+
+    /**
+     * Check whether there is a connection to the node with the completed handshake.
+     *
+     * @param node_id Node ID.
+     * @return @c true if the node is connected.
+     */
+    [[nodiscard]] bool is_node_connected(const std::string &node_id);
+
+    /**
+     * Perform request. Idempotent requests that failed due to the connection loss are retried according to the
+     * retry policy.
      *
      * @tparam T Result type.
      * @param op Operation code.
      * @param wr Request writer function.
      * @param rd Response reader function.
      * @param callback Callback to call on result.
+     * @param node_id ID of the node to send the request to if it is connected and healthy. Empty for any node.
      */
     template<typename T>
     void perform_request(client_operation op, const std::function<void(protocol::writer &)> &wr,
-        std::function<T(protocol::reader &)> rd, ignite_callback<T> callback) {
-        auto handler = std::make_shared<response_handler_impl<T>>(std::move(rd), std::move(callback));
-
-        while (true) {
-            auto channel = get_random_channel();
-            if (!channel)
-                throw ignite_error("No nodes connected");
-
-            auto res = channel->perform_request(op, wr, handler);
-            if (res)
-                return;
+        std::function<T(protocol::reader &)> rd, ignite_callback<T> callback, const std::string &node_id = {}) {
+        if (is_idempotent(op) && m_configuration.get_retry_policy().get_max_attempts() > 1 && m_timer) {
+            // Writer function may refer to the caller's state, so the request is serialized once and resent as is.
+            std::vector<std::byte> payload;
+            {
+                protocol::buffer_adapter buffer(payload);
+                protocol::writer writer(buffer);
+                wr(writer);
+            }
+
+            auto deadline = std::chrono::steady_clock::now() + m_configuration.get_retry_policy().get_deadline();
+            auto request = std::make_shared<retryable_request<T>>(
+                op, std::move(payload), std::move(rd), std::move(callback), deadline, node_id);
+
+            perform_attempt(request);
+            return;
         }
+
+        auto handler = std::make_shared<response_handler_impl<T>>(std::move(rd), std::move(callback));
+        send_or_enqueue(op, wr, handler, {}, node_id);
     }
 
     /**
@@ -142,20 +215,392 @@ public:
             op, wr, [](protocol::reader &) {}, std::move(callback));
     }
 
+    /**
+     * Perform request that creates a resource bound to the connection, e.g. a SQL cursor. The request is sent over a
+     * random connection, which ID is passed to the response reader, so the subsequent requests to the resource can be
+     * sent with perform_request_on(). The request is never retried.
+     *
+     * @tparam T Result type.
+     * @param op Operation code.
+     * @param wr Request writer function.
+     * @param rd Response reader function. Receives the ID of the connection that the request was sent over.
+     * @param callback Callback to call on result.
+     */
+    template<typename T>
+    void perform_request_bound(client_operation op, const std::function<void(protocol::writer &)> &wr,
+        std::function<T(protocol::reader &, std::uint64_t)> rd, ignite_callback<T> callback) {
+        auto connection_id = std::make_shared<std::atomic<std::uint64_t>>(0);
+        auto handler = std::make_shared<response_handler_impl<T>>(
+            [rd = std::move(rd), connection_id](protocol::reader &reader) { return rd(reader, connection_id->load()); },
+            std::move(callback));
+
+        send_or_enqueue(op, wr, handler, connection_id);
+    }
+
+    /**
+     * Perform request over the specified connection. The request fails with status_code::NETWORK if the connection is
+     * closed, as the resources bound to it are lost.
+     *
+     * @tparam T Result type.
+     * @param connection_id Connection ID.
+     * @param op Operation code.
+     * @param wr Request writer function.
+     * @param rd Response reader function.
+     * @param callback Callback to call on result.
+     */
+    template<typename T>
+    void perform_request_on(std::uint64_t connection_id, client_operation op,
+        const std::function<void(protocol::writer &)> &wr, std::function<T(protocol::reader &)> rd,
+        ignite_callback<T> callback) {
+        auto handler = std::make_shared<response_handler_impl<T>>(std::move(rd), std::move(callback));
+
+        auto connection = find_client(connection_id);
+        try {
+            if (connection && connection->perform_request(op, wr, handler))
+                return;
+        } catch (const ignite_error &err) {
+            fail_request(*handler, err);
+            return;
+        }
+
+        fail_request(*handler,
+            ignite_error(status_code::NETWORK, "Connection " + std::to_string(connection_id) + " is closed"));
+    }
+
+    /**
+     * Read CLUSTER_GET_NODES response.
+     *
+     * The server writes an array header followed by the flat ID, name, host and cluster network port of every node.
+     * Clients connect to the client connector, so the port of the connection the nodes are requested over is used.
+     *
+     * @param reader Reader.
+     * @param client_port Client connector port.
+     * @return Addresses of the nodes.
+     */
+    [[nodiscard]] static std::vector<network::end_point> read_cluster_nodes(
+        protocol::reader &reader, std::uint16_t client_port);
+
 private:
     /**
-     * Get random node connection.
+     * Request that can be resent.
+     */
+    template<typename T>
+    struct retryable_request {
+        /**
+         * Constructor.
+         *
+         * @param op Operation code.
+         * @param payload Serialized request.
+         * @param rd Response reader function.
+         * @param callback Callback to call on result.
+         * @param deadline Deadline.
+         * @param node_id ID of the node to send the request to, or empty.
+         */
+        retryable_request(client_operation op, std::vector<std::byte> &&payload,
+            std::function<T(protocol::reader &)> &&rd, ignite_callback<T> &&callback,
+            std::chrono::steady_clock::time_point deadline, std::string node_id)
+            : op(op)
+            , payload(std::move(payload))
+            , reader(std::move(rd))
+            , deadline(deadline)
+            , node_id(std::move(node_id))
+            , m_callback(std::move(callback)) {}
+
+        /**
+         * Destructor. Fails the request if it was dropped without a result, e.g. when the client is stopped while
+         * the next attempt is pending.
+         */
+        ~retryable_request() {
+            (void) complete({ignite_error(status_code::NETWORK, "Client is stopped")});
+        }
+
+        /**
+         * Complete the request. Only the first call has effect.
+         *
+         * @param res Result.
+         * @return Result of the callback.
+         */
+        ignite_result<void> complete(ignite_result<T> &&res) {
+            ignite_callback<T> callback;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                std::swap(callback, m_callback);
+            }
+
+            if (!callback)
+                return {};
+
+            return result_of_operation<void>([&]() { callback(std::move(res)); });
+        }
+
+        /** Operation code. */
+        const client_operation op;
+
+        /** Serialized request. */
+        const std::vector<std::byte> payload;
+
+        /** Response reader function. */
+        const std::function<T(protocol::reader &)> reader;
+
+        /** Deadline. */
+        const std::chrono::steady_clock::time_point deadline;
+
+        /** ID of the node to send the request to, or empty. */
+        const std::string node_id;
+
+        /** Number of attempts made. */
+        std::int32_t attempts{0};
+
+    private:
+        /** Callback. Reset once called. */
+        ignite_callback<T> m_callback;
+
+        /** Callback mutex. */
+        std::mutex m_mutex;
+    };
+
+    /**
+     * Check whether the operation can be safely resent.
+     *
+     * @param op Operation code.
+     * @return @c true if the operation is idempotent.
+     */
+    [[nodiscard]] static bool is_idempotent(client_operation op);
+
+    /**
+     * Get delay before the next attempt.
+     *
+     * @param attempts Number of attempts made.
+     * @param deadline Deadline of the operation.
+     * @return Delay or nullopt if the operation should not be retried.
+     */
+    [[nodiscard]] std::optional<std::chrono::milliseconds> get_retry_delay(
+        std::int32_t attempts, std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * Request waiting for a connection to be established.
+     */
+    struct pending_request {
+        /** Function that sends the request over the connection. Returns @c false if the connection is closed. */
+        std::function<bool(node_connection &)> send;
+
+        /** Response handler. */
+        std::shared_ptr<response_handler> handler;
+
+        /** Time after which the request fails. */
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    /**
+     * Send the request over a random connection.
+     *
+     * @tparam T Result type.
+     * @param op Operation code.
+     * @param wr Request writer function.
+     * @param handler Response handler.
+     * @param bound_id If set, receives the ID of the connection before the request is sent over it.
+     * @param node_id If not empty, the connection to this node is used if it is healthy.
+     * @return @c true if the request was sent and @c false if there are no connections.
+     *
+     * @throw ignite_error with status_code::BACKPRESSURE if the send queue of the connection is saturated.
+     */
+    template<typename T>
+    bool send_to_random_channel(client_operation op, const std::function<void(protocol::writer &)> &wr,
+        const std::shared_ptr<response_handler_impl<T>> &handler,
+        const std::shared_ptr<std::atomic<std::uint64_t>> &bound_id = {}, const std::string &node_id = {}) {
+        while (true) {
+            std::shared_ptr<node_connection> channel;
+            if (!node_id.empty())
+                channel = get_node_channel(node_id);
+
+            if (!channel)
+                channel = get_random_channel();
+
+            if (!channel)
+                return false;
+
+            if (bound_id)
+                bound_id->store(channel->id());
+
+            if (channel->perform_request(op, wr, handler))
+                return true;
+
+            // Connection is closed, but the event is not processed yet. Removing it ensures the loop terminates.
+            remove_client(channel->id());
+        }
+    }
+
+    /**
+     * Send the request over a random connection. If there are no connections with completed handshake, the request
+     * waits in the pending queue until a handshake succeeds. If the send queues are saturated, the request fails or
+     * waits in the pending queue until a send queue drains, depending on the backpressure mode.
+     *
+     * @tparam T Result type.
+     * @param op Operation code.
+     * @param wr Request writer function.
+     * @param handler Response handler.
+     * @param bound_id If set, receives the ID of the connection before the request is sent over it.
+     * @param node_id If not empty, the connection to this node is used if it is healthy.
+     */
+    template<typename T>
+    void send_or_enqueue(client_operation op, const std::function<void(protocol::writer &)> &wr,
+        const std::shared_ptr<response_handler_impl<T>> &handler,
+        const std::shared_ptr<std::atomic<std::uint64_t>> &bound_id = {}, const std::string &node_id = {}) {
+        while (true) {
+            auto drains = m_pending_drains.load();
+            try {
+                if (send_to_random_channel(op, wr, handler, bound_id, node_id))
+                    return;
+            } catch (const ignite_error &err) {
+                if (err.get_status_code() != status_code::BACKPRESSURE)
+                    throw;
+
+                if (m_configuration.get_backpressure().get_mode() == backpressure_mode::FAIL) {
+                    fail_request(*handler, err);
+                    return;
+                }
+            }
+
+            // Writer function may refer to the caller's state, so the request is serialized now.
+            std::vector<std::byte> payload;
+            {
+                protocol::buffer_adapter buffer(payload);
+                protocol::writer writer(buffer);
+                wr(writer);
+            }
+
+            auto send = [op, payload = std::move(payload), handler, bound_id](node_connection &connection) {
+                if (bound_id)
+                    bound_id->store(connection.id());
+
+                return connection.perform_request(
+                    op, [&payload](protocol::writer &writer) { writer.write_raw(payload); }, handler);
+            };
+
+            if (enqueue_pending(drains, std::move(send), handler))
+                return;
+        }
+    }
+
+    /**
+     * Put the request into the pending queue.
+     *
+     * @param drains Number of pending queue drains observed before the request was found to have no connection.
+     * @param send Function that sends the request.
+     * @param handler Response handler.
+     * @return @c false if the queue has been drained since, and the caller should try to send the request again.
+     */
+    bool enqueue_pending(
+        std::uint64_t drains, std::function<bool(node_connection &)> send, std::shared_ptr<response_handler> handler);
+
+    /**
+     * Send all pending requests. Called once a handshake succeeds or a send queue drains.
+     *
+     * @param connection Connection that can accept requests.
+     */
+    void drain_pending_requests(std::shared_ptr<node_connection> connection);
+
+    /**
+     * Fail pending requests that waited for too long.
+     */
+    void expire_pending_requests();
+
+    /**
+     * Schedule expiration of pending requests if it is not scheduled yet. Should be called with the pending
+     * requests lock held.
+     */
+    void schedule_pending_expiration_locked();
+
+    /**
+     * Fail the request.
+     *
+     * @param handler Response handler.
+     * @param err Error.
+     */
+    void fail_request(response_handler &handler, ignite_error err);
+
+    /**
+     * Send the request over a random connection.
      *
-     * @return Random node connection or nullptr if there are no active connections.
+     * @tparam T Result type.
+     * @param request Request.
+     */
+    template<typename T>
+    void perform_attempt(const std::shared_ptr<retryable_request<T>> &request) {
+        ++request->attempts;
+
+        auto handler = std::make_shared<response_handler_impl<T>>(
+            request->reader, [self_weak = weak_from_this(), request](ignite_result<T> &&res) {
+                if (res.has_error()) {
+                    auto self = self_weak.lock();
+                    if (self && self->schedule_retry(request, res.error()))
+                        return;
+                }
+
+                auto handling_res = request->complete(std::move(res));
+                if (handling_res.has_error())
+                    throw ignite_error(handling_res.error());
+            });
+
+        send_or_enqueue<T>(
+            request->op, [&request](protocol::writer &writer) { writer.write_raw(request->payload); }, handler, {},
+            request->node_id);
+    }
+
+    /**
+     * Schedule the next attempt, if the error is caused by the connection loss and the retry policy allows it.
+     *
+     * @tparam T Result type.
+     * @param request Request.
+     * @param err Error of the last attempt.
+     * @return @c true if the next attempt is scheduled.
+     */
+    template<typename T>
+    bool schedule_retry(const std::shared_ptr<retryable_request<T>> &request, const ignite_error &err) {
+        if (err.get_status_code() != status_code::NETWORK)
+            return false;
+
+        auto delay = get_retry_delay(request->attempts, request->deadline);
+        if (!delay)
+            return false;
+
+        m_logger->log_debug("Retrying operation " + std::to_string(int(request->op)) + " in "
+            + std::to_string(delay->count()) + "ms after error: " + err.what_str());
+
+        // Attempts are never made from the response handler, as it can be called with the connection lock held.
+        // The request is failed by its destructor if the client is stopped before the attempt.
+        schedule(*delay, [self_weak = weak_from_this(), request]() {
+            if (auto self = self_weak.lock())
+                self->perform_attempt(request);
+        });
+
+        return true;
+    }
+
+    /**
+     * Get random node connection with completed handshake. Suspect connections, connections ejected as outliers and
+     * connections with saturated send queues are only used when there are no other connections.
+     *
+     * @return Random node connection or nullptr if there are no connections with completed handshake.
      */
     std::shared_ptr<node_connection> get_random_channel();
 
+    /**
+     * Get connection to the node if its handshake is complete and it is neither suspect, nor ejected as an outlier,
+     * nor saturated.
+     *
+     * @param node_id Node ID.
+     * @return Node connection or nullptr if there is no such connection.
+     */
+    std::shared_ptr<node_connection> get_node_channel(const std::string &node_id);
+
     /**
      * Constructor.
      *
      * @param configuration Configuration.
+     * @param pool Client pool. The default pool is made on start if empty.
      */
-    explicit cluster_connection(ignite_client_configuration configuration);
+    cluster_connection(ignite_client_configuration configuration, std::shared_ptr<network::async_client_pool> pool);
 
     /**
      * Callback that called on successful connection establishment.
@@ -196,6 +641,27 @@ private:
      */
     void on_message_sent(uint64_t id) override;
 
+    /**
+     * Callback that called when the send queue of the connection becomes saturated or drains.
+     *
+     * @param id Async client ID.
+     * @param saturated @c true if the queue has become saturated.
+     */
+    void on_send_queue_saturation(uint64_t id, bool saturated) override;
+
+    /**
+     * Callback that called when the total size of the send queues becomes saturated or drains.
+     *
+     * @param saturated @c true if the total size has become saturated.
+     */
+    void on_total_send_queue_saturation(bool saturated) override;
+
+    /**
+     * Check whether the total size or the send queues of all the connections are saturated, and notify the
+     * backpressure listener if this has changed.
+     */
+    void update_send_queue_saturation();
+
     /**
      * Remove client.
      *
@@ -203,6 +669,63 @@ private:
      */
     void remove_client(uint64_t id);
 
+    /**
+     * Schedule timer callback. The callback is not called once the connection is stopped or destroyed.
+     *
+     * @param timeout Timeout.
+     * @param callback Callback.
+     */
+    void schedule(std::chrono::milliseconds timeout, std::function<void()> callback);
+
+    /**
+     * Schedule next heartbeat for the connection.
+     *
+     * @param connection Connection.
+     */
+    void schedule_heartbeat(const std::shared_ptr<node_connection> &connection);
+
+    /**
+     * Schedule next topology refresh.
+     */
+    void schedule_topology_refresh();
+
+    /**
+     * Request cluster nodes and update addresses of the pool.
+     */
+    void refresh_topology();
+
+    /**
+     * Schedule next outlier detection.
+     */
+    void schedule_outlier_detection();
+
+    /**
+     * Eject outlier connections from routing and probe the connections whose ejection time has passed.
+     */
+    void detect_outliers();
+
+    /**
+     * Eject connection from routing.
+     *
+     * @param connection Connection.
+     * @param reason Reason of the ejection.
+     */
+    void eject(node_connection &connection, const std::string &reason);
+
+    /**
+     * Send probe to the ejected connection, and return it to routing if the probe succeeds.
+     *
+     * @param connection Connection.
+     */
+    void probe(const std::shared_ptr<node_connection> &connection);
+
+    /**
+     * Update addresses of the pool with discovered nodes.
+     *
+     * @param nodes Addresses of the discovered nodes.
+     */
+    void apply_topology(const std::vector<network::end_point> &nodes);
+
     /**
      * Handle initial connection result.
      *
@@ -211,7 +734,12 @@ private:
     void initial_connect_result(ignite_result<void> &&res);
 
     /**
-     * Find and return client.
+     * Call the warm-up function, if any, and complete the start.
+     */
+    void start_warmup();
+
+    /**
+     * Find and return client. Lock-free.
      *
      * @param id Client ID.
      * @return Client if found and nullptr otherwise.
@@ -221,26 +749,71 @@ private:
     /** Configuration. */
     const ignite_client_configuration m_configuration;
 
+    /** Pool of threads for batch operations. */
+    std::unique_ptr<thread_pool> m_batch_pool;
+
     /** Callback to call on initial connect. */
     std::function<void(ignite_result<void>)> m_on_initial_connect;
 
     /** Initial connect mutex. */
     std::mutex m_on_initial_connect_mutex;
 
+    /** Warm-up function. Reset once called. */
+    std::function<void(ignite_callback<void>)> m_warmup;
+
+    /** Number of connections to establish before the warm-up. */
+    std::uint32_t m_min_connections{1};
+
+    /** Number of successful handshakes. */
+    std::atomic_uint32_t m_handshakes{0};
+
     /** Connection pool. */
     std::shared_ptr<network::async_client_pool> m_pool;
 
+    /** Pool provided on creation. */
+    std::shared_ptr<network::async_client_pool> m_provided_pool;
+
     /** Logger. */
     std::shared_ptr<ignite_logger> m_logger;
 
+    /** Timer. */
+    std::shared_ptr<thread_timer> m_timer;
+
+    /** Flag indicating that the connection is stopped. */
+    std::atomic_bool m_stopped{false};
+
     /** Node connections. */
-    std::unordered_map<uint64_t, std::shared_ptr<node_connection>> m_connections;
+    network::detail::connection_table<node_connection> m_connections;
+
+    /** Requests waiting for a connection. */
+    std::deque<pending_request> m_pending_requests;
+
+    /** Pending requests mutex. */
+    std::mutex m_pending_requests_mutex;
+
+    /** Whether expiration of pending requests is scheduled. */
+    bool m_pending_expiration_scheduled{false};
+
+    /** Number of pending queue drains. */
+    std::atomic_uint64_t m_pending_drains{0};
+
+    /** Whether the total size of the send queues is saturated. */
+    std::atomic_bool m_total_send_queue_saturated{false};
+
+    /** Whether the send queues of all the connections are saturated. */
+    std::atomic_bool m_send_queues_saturated{false};
+
+    /** Partition assignment version. */
+    std::atomic_uint64_t m_assignment_version{0};
+
+    /** Configured addresses. */
+    std::vector<network::tcp_range> m_configured_addrs;
 
-    /** Connections mutex. */
-    std::recursive_mutex m_connections_mutex;
+    /** Addresses of the pool including discovered nodes. */
+    std::vector<network::tcp_range> m_addrs;
 
-    /** Generator. */
-    std::mt19937 m_generator;
+    /** Addresses mutex. */
+    std::mutex m_addrs_mutex;
 };
 
 } // namespace ignite::detail
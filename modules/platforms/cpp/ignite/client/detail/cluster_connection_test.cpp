@@ -0,0 +1,767 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cluster_connection.h"
+
+#include <ignite/network/detail/send_queue_limiter.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <map>
+#include <set>
+#include <thread>
+
+using namespace ignite;
+using namespace ignite::detail;
+using namespace std::chrono_literals;
+
+namespace {
+
+/**
+ * Make a view of the test bytes.
+ */
+template<std::size_t N>
+bytes_view make_view(const std::array<std::uint8_t, N> &data) {
+    return {reinterpret_cast<const std::byte *>(data.data()), data.size()};
+}
+
+/**
+ * Logger that drops everything.
+ */
+class null_logger : public ignite_logger {
+public:
+    void log_error(std::string_view) override {}
+    void log_warning(std::string_view) override {}
+    void log_info(std::string_view) override {}
+    void log_debug(std::string_view) override {}
+};
+
+/**
+ * Pool that connects nowhere. The test opens the connections and answers the requests. Sent data stays in the send
+ * queues until the test flushes them, and is accounted in the send queue limiter the same way the platform pools do.
+ */
+class fake_pool : public network::async_client_pool {
+public:
+    /**
+     * Request sent over a connection.
+     */
+    struct request {
+        /** Connection ID. */
+        std::uint64_t connection_id{0};
+
+        /** Operation. */
+        client_operation op{};
+
+        /** Request ID. */
+        std::int64_t id{0};
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param limit High watermark of a connection queue. Zero means no limit.
+     * @param total_limit High watermark of the total size of all the queues. Zero means no limit.
+     */
+    fake_pool(std::size_t limit, std::size_t total_limit)
+        : m_limiter(limit, 0, total_limit) {
+        m_limiter.set_total_saturation_listener([this](bool saturated) {
+            if (auto handler = m_handler.lock())
+                handler->on_total_send_queue_saturation(saturated);
+        });
+    }
+
+    void start(std::vector<network::tcp_range>, uint32_t) override {}
+
+    void stop() override {}
+
+    void update_addresses(std::vector<network::tcp_range>) override {}
+
+    void set_handler(std::weak_ptr<network::async_handler> handler) override { m_handler = std::move(handler); }
+
+    bool send(uint64_t id, std::vector<std::byte> &&data) override {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        auto it = m_connections.find(id);
+        if (it == m_connections.end())
+            return false;
+
+        auto &queue = *it->second;
+        bool handshake = !std::exchange(queue.handshake_sent, true);
+        if (!handshake && m_failing_sends.count(m_sends++))
+            throw ignite_error(status_code::GENERIC, "Send failed");
+
+        if (!handshake) {
+            // Length header is followed by the operation code and the request ID.
+            protocol::reader reader(bytes_view{data}.substr(4));
+            auto op = client_operation(reader.read_int32());
+            m_requests.push_back({id, op, reader.read_int64()});
+        }
+
+        lock.unlock();
+
+        using network::detail::send_queue_limiter;
+
+        auto reserved = m_limiter.acquire(queue.limiter_queue, data.size());
+        if (reserved == send_queue_limiter::acquire_result::REJECTED) {
+            if (!handshake) {
+                lock.lock();
+                m_requests.pop_back();
+            }
+
+            throw ignite_error(status_code::BACKPRESSURE, "Send queue of the connection is full");
+        }
+
+        if (reserved == send_queue_limiter::acquire_result::SATURATED)
+            handler()->on_send_queue_saturation(id, true);
+
+        return true;
+    }
+
+    void close(uint64_t id, std::optional<ignite_error> err) override {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_connections.erase(id))
+                return;
+        }
+
+        handler()->on_connection_closed(id, std::move(err));
+    }
+
+    /**
+     * Open connection and complete the handshake.
+     *
+     * @param id Connection ID.
+     * @param node_id ID of the node.
+     */
+    void connect(std::uint64_t id, const std::string &node_id) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_connections.emplace(id, std::make_unique<connection>());
+        }
+
+        handler()->on_connection_success({"127.0.0.1", std::uint16_t(10800 + id)}, id);
+        flush(id);
+
+        std::vector<std::byte> message;
+        {
+            protocol::buffer_adapter buffer(message);
+            protocol::writer writer(buffer);
+
+            auto ver = protocol_context::CURRENT_VERSION;
+            writer.write(ver.major());
+            writer.write(ver.minor());
+            writer.write(ver.patch());
+            writer.write_nil(); // Error.
+            writer.write(std::int64_t(0)); // Idle timeout.
+            writer.write(node_id);
+            writer.write(node_id); // Node name.
+            writer.write_nil(); // Cluster ID.
+            writer.write_binary_empty(); // Features.
+            writer.write_map_empty(); // Extensions.
+        }
+
+        handler()->on_message_received(id, message);
+    }
+
+    /**
+     * Write all the data queued on the connection, as the platform pools do once the socket becomes writable.
+     *
+     * @param id Connection ID.
+     */
+    void flush(std::uint64_t id) {
+        connection *conn;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            conn = m_connections.at(id).get();
+        }
+
+        if (m_limiter.release_all(conn->limiter_queue))
+            handler()->on_send_queue_saturation(id, false);
+    }
+
+    /**
+     * Answer the request.
+     *
+     * @param req Request.
+     * @param err Error to answer with, if any.
+     * @param flags Response flags.
+     */
+    void respond(const request &req, std::optional<status_code> err = {}, std::int32_t flags = 0) {
+        std::vector<std::byte> message;
+        {
+            protocol::buffer_adapter buffer(message);
+            protocol::writer writer(buffer);
+
+            writer.write(std::int32_t(message_type::RESPONSE));
+            writer.write(req.id);
+            writer.write(flags);
+            if (err) {
+                writer.write(uuid(1, 2)); // Trace ID.
+                writer.write(std::int32_t(*err));
+                writer.write("IgniteException");
+                writer.write("Test error");
+            } else
+                writer.write_nil();
+        }
+
+        handler()->on_message_received(req.connection_id, message);
+    }
+
+    /**
+     * Make the send of the request fail.
+     *
+     * @param index Index of the request among all the requests sent over the pool, except for the handshakes.
+     */
+    void fail_send(std::size_t index) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_failing_sends.insert(index);
+    }
+
+    /**
+     * Take the requests sent since the last call.
+     *
+     * @return Requests, except for the handshakes.
+     */
+    std::vector<request> take_requests() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        return std::exchange(m_requests, {});
+    }
+
+private:
+    /**
+     * Connection state.
+     */
+    struct connection {
+        /** Whether the handshake is sent. */
+        bool handshake_sent{false};
+
+        /** Send queue. */
+        network::detail::send_queue_limiter::queue limiter_queue;
+    };
+
+    /**
+     * Get handler.
+     *
+     * @return Handler.
+     */
+    std::shared_ptr<network::async_handler> handler() {
+        auto handler = m_handler.lock();
+        if (!handler)
+            throw ignite_error("Handler is not set");
+
+        return handler;
+    }
+
+    /** Handler. */
+    std::weak_ptr<network::async_handler> m_handler;
+
+    /** Send queue limiter. */
+    network::detail::send_queue_limiter m_limiter;
+
+    /** Mutex. */
+    std::mutex m_mutex;
+
+    /** Open connections. */
+    std::map<std::uint64_t, std::unique_ptr<connection>> m_connections;
+
+    /** Sent requests. */
+    std::vector<request> m_requests;
+
+    /** Number of the requests sent, except for the handshakes. */
+    std::size_t m_sends{0};
+
+    /** Indices of the requests which sends fail. */
+    std::set<std::size_t> m_failing_sends;
+};
+
+/** Server error code of an unexpected error: the common error group, code 1. */
+constexpr auto UNEXPECTED_ERR = status_code(0x10001);
+
+/** Server error code of a missing table: the table error group, code 2. */
+constexpr auto TABLE_NOT_FOUND_ERR = status_code(0x20002);
+
+/**
+ * Make configuration of the client that connects over the fake pool. Periodic requests are disabled, so the test
+ * sees only the requests it makes.
+ *
+ * @return Configuration.
+ */
+ignite_client_configuration make_configuration() {
+    ignite_client_configuration cfg{"127.0.0.1:10801", "127.0.0.1:10802", "127.0.0.1:10803"};
+    cfg.set_logger(std::make_shared<null_logger>());
+    cfg.set_heartbeat_interval(std::chrono::milliseconds(0));
+    cfg.set_topology_refresh_interval(std::chrono::milliseconds(0));
+
+    return cfg;
+}
+
+/**
+ * Make writer of the request with the payload of the specified size.
+ *
+ * @param size Payload size.
+ * @return Request writer.
+ */
+std::function<void(protocol::writer &)> payload_of(std::size_t size) {
+    return [size](protocol::writer &writer) {
+        std::vector<std::byte> payload(size);
+        writer.write_binary(payload);
+    };
+}
+
+/**
+ * Start connection over the fake pool and connect it to the nodes.
+ *
+ * @param cfg Configuration.
+ * @param pool Pool.
+ * @param nodes IDs of the nodes to connect to. Connection IDs start from one.
+ * @return Connection.
+ */
+std::shared_ptr<cluster_connection> start_connection(const ignite_client_configuration &cfg,
+    const std::shared_ptr<fake_pool> &pool, const std::vector<std::string> &nodes) {
+    auto connection = cluster_connection::create(cfg, pool);
+
+    // The connection can be started after the function returns, if there are no nodes to connect to.
+    auto started = std::make_shared<std::optional<ignite_result<void>>>();
+    connection->start_async([started](ignite_result<void> &&res) { *started = std::move(res); });
+
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+        pool->connect(i + 1, nodes[i]);
+
+    EXPECT_EQ(!nodes.empty(), *started && !(*started)->has_error());
+
+    return connection;
+}
+
+/**
+ * Run the timer callbacks of the external runtime until the predicate holds.
+ *
+ * @param runtime Runtime.
+ * @param pred Predicate.
+ * @return @c true if the predicate holds.
+ */
+bool run_timers_until(client_runtime &runtime, const std::function<bool()> &pred) {
+    auto deadline = std::chrono::steady_clock::now() + 10s;
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+
+        std::this_thread::sleep_for(1ms);
+        runtime.on_timer();
+    }
+
+    return true;
+}
+
+/**
+ * Make callback that stores the result.
+ *
+ * @param results Results.
+ * @return Callback.
+ */
+ignite_callback<void> store_to(std::vector<ignite_result<void>> &results) {
+    return [&results](ignite_result<void> &&res) { results.push_back(std::move(res)); };
+}
+
+} // namespace
+
+TEST(cluster_connection, read_cluster_nodes) {
+    // CLUSTER_GET_NODES response of a two-node cluster as the server writes it: an array header followed by the flat
+    // ID, name, host and cluster network port of every node.
+    const std::array<std::uint8_t, 115> data{0x92, 0xd9, 0x24, 0x32, 0x66, 0x30, 0x65, 0x34, 0x62, 0x36, 0x63, 0x2d,
+        0x36, 0x61, 0x31, 0x65, 0x2d, 0x34, 0x64, 0x36, 0x62, 0x2d, 0x39, 0x66, 0x33, 0x65, 0x2d, 0x31, 0x63, 0x32,
+        0x64, 0x33, 0x65, 0x34, 0x66, 0x35, 0x61, 0x36, 0x62, 0xa6, 0x6e, 0x6f, 0x64, 0x65, 0x2d, 0x31, 0xa8, 0x31,
+        0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x31, 0xcd, 0x0d, 0x10, 0xd9, 0x24, 0x37, 0x61, 0x38, 0x62, 0x39, 0x63,
+        0x30, 0x64, 0x2d, 0x31, 0x65, 0x32, 0x66, 0x2d, 0x34, 0x61, 0x35, 0x62, 0x2d, 0x38, 0x63, 0x36, 0x64, 0x2d,
+        0x37, 0x65, 0x38, 0x66, 0x39, 0x61, 0x30, 0x62, 0x31, 0x63, 0x32, 0x64, 0xa6, 0x6e, 0x6f, 0x64, 0x65, 0x2d,
+        0x32, 0xa8, 0x31, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x32, 0xcd, 0x0d, 0x11};
+
+    protocol::reader reader(make_view(data));
+    auto nodes = cluster_connection::read_cluster_nodes(reader, 10800);
+
+    ASSERT_EQ(2, nodes.size());
+    EXPECT_EQ(network::end_point("10.0.0.1", 10800), nodes[0]);
+    EXPECT_EQ(network::end_point("10.0.0.2", 10800), nodes[1]);
+}
+
+TEST(cluster_connection, read_cluster_nodes_empty) {
+    const std::array<std::uint8_t, 1> data{0x90};
+
+    protocol::reader reader(make_view(data));
+
+    EXPECT_TRUE(cluster_connection::read_cluster_nodes(reader, 10800).empty());
+}
+
+TEST(cluster_connection, total_send_queue_saturation) {
+    auto cfg = make_configuration();
+
+    std::vector<bool> reported;
+    backpressure settings;
+    settings.set_total_send_queue_limit(100);
+    settings.set_listener([&reported](bool saturated) { reported.push_back(saturated); });
+    cfg.set_backpressure(settings);
+
+    // Requests that are not answered fail when the connection is destroyed, so the results outlive it.
+    std::vector<ignite_result<void>> results;
+
+    auto pool = std::make_shared<fake_pool>(0, 100);
+    auto connection = cluster_connection::create(cfg, pool);
+
+    std::optional<ignite_result<void>> started;
+    connection->start_async([&started](ignite_result<void> &&res) { started = std::move(res); });
+
+    pool->connect(1, "node-a");
+    pool->connect(2, "node-b");
+    ASSERT_TRUE(started && !started->has_error());
+
+    auto send = [&](const std::string &node_id, std::size_t size) {
+        connection->perform_request<void>(
+            client_operation::TUPLE_UPSERT, payload_of(size), [](protocol::reader &) {},
+            [&results](ignite_result<void> &&res) { results.push_back(std::move(res)); }, node_id);
+    };
+
+    // The total size crosses the high watermark on the connection to node A, while most of the data is queued on
+    // the connection to node B.
+    send("node-b", 70);
+    send("node-a", 30);
+    EXPECT_EQ(std::vector<bool>{true}, reported);
+
+    send("node-a", 1);
+    ASSERT_EQ(1, results.size());
+    EXPECT_EQ(status_code::BACKPRESSURE, results.back().error().get_status_code());
+
+    // Drains on the connection to node B, which makes both connections routable again.
+    pool->flush(2);
+    EXPECT_EQ((std::vector<bool>{true, false}), reported);
+
+    pool->take_requests();
+    for (int i = 0; i < 10; ++i) {
+        send("node-a", 1);
+        pool->flush(1);
+    }
+
+    auto requests = pool->take_requests();
+    ASSERT_EQ(10, requests.size());
+    for (auto &req : requests)
+        EXPECT_EQ(1, req.connection_id);
+}
+
+TEST(cluster_connection, idempotent_request_is_retried) {
+    auto runtime = client_runtime::create_external();
+    auto cfg = make_configuration();
+    cfg.set_runtime(runtime);
+
+    retry_policy policy;
+    policy.set_max_attempts(2);
+    policy.set_initial_backoff(1ms);
+    policy.set_max_backoff(1ms);
+    cfg.set_retry_policy(policy);
+
+    std::vector<ignite_result<void>> results;
+
+    auto pool = std::make_shared<fake_pool>(0, 0);
+    auto connection = start_connection(cfg, pool, {"node-a", "node-b"});
+
+    connection->perform_request<void>(
+        client_operation::TUPLE_GET, payload_of(1), [](protocol::reader &) {}, store_to(results));
+
+    auto first = pool->take_requests();
+    ASSERT_EQ(1, first.size());
+
+    // The connection loss is not reported, the request is sent again over the other connection.
+    pool->close(first[0].connection_id, ignite_error(status_code::NETWORK, "Connection lost"));
+    EXPECT_TRUE(results.empty());
+
+    std::vector<fake_pool::request> second;
+    ASSERT_TRUE(run_timers_until(runtime, [&] { return !(second = pool->take_requests()).empty(); }));
+    ASSERT_EQ(1, second.size());
+    EXPECT_EQ(client_operation::TUPLE_GET, second[0].op);
+    EXPECT_NE(first[0].connection_id, second[0].connection_id);
+
+    // No attempts are left.
+    pool->close(second[0].connection_id, ignite_error(status_code::NETWORK, "Connection lost"));
+    ASSERT_EQ(1, results.size());
+    EXPECT_EQ(status_code::NETWORK, results[0].error().get_status_code());
+}
+
+TEST(cluster_connection, retried_request_succeeds) {
+    auto runtime = client_runtime::create_external();
+    auto cfg = make_configuration();
+    cfg.set_runtime(runtime);
+
+    retry_policy policy;
+    policy.set_max_attempts(4);
+    policy.set_initial_backoff(1ms);
+    policy.set_max_backoff(1ms);
+    cfg.set_retry_policy(policy);
+
+    std::vector<ignite_result<void>> results;
+
+    auto pool = std::make_shared<fake_pool>(0, 0);
+    auto connection = start_connection(cfg, pool, {"node-a", "node-b"});
+
+    connection->perform_request<void>(
+        client_operation::TUPLE_GET, payload_of(1), [](protocol::reader &) {}, store_to(results));
+
+    auto first = pool->take_requests();
+    ASSERT_EQ(1, first.size());
+    pool->close(first[0].connection_id, ignite_error(status_code::NETWORK, "Connection lost"));
+
+    std::vector<fake_pool::request> second;
+    ASSERT_TRUE(run_timers_until(runtime, [&] { return !(second = pool->take_requests()).empty(); }));
+    ASSERT_EQ(1, second.size());
+
+    pool->respond(second[0]);
+    ASSERT_EQ(1, results.size());
+    EXPECT_FALSE(results[0].has_error());
+}
+
+TEST(cluster_connection, non_idempotent_request_is_not_retried) {
+    auto runtime = client_runtime::create_external();
+    auto cfg = make_configuration();
+    cfg.set_runtime(runtime);
+
+    retry_policy policy;
+    policy.set_max_attempts(4);
+    policy.set_initial_backoff(1ms);
+    policy.set_max_backoff(1ms);
+    cfg.set_retry_policy(policy);
+
+    std::vector<ignite_result<void>> results;
+
+    auto pool = std::make_shared<fake_pool>(0, 0);
+    auto connection = start_connection(cfg, pool, {"node-a", "node-b"});
+
+    connection->perform_request<void>(
+        client_operation::TUPLE_UPSERT, payload_of(1), [](protocol::reader &) {}, store_to(results));
+
+    auto requests = pool->take_requests();
+    ASSERT_EQ(1, requests.size());
+
+    pool->close(requests[0].connection_id, ignite_error(status_code::NETWORK, "Connection lost"));
+    ASSERT_EQ(1, results.size());
+    EXPECT_EQ(status_code::NETWORK, results[0].error().get_status_code());
+
+    // Server errors of idempotent requests are not retried either.
+    connection->perform_request<void>(
+        client_operation::TUPLE_GET, payload_of(1), [](protocol::reader &) {}, store_to(results));
+
+    requests = pool->take_requests();
+    ASSERT_EQ(1, requests.size());
+
+    pool->respond(requests[0], status_code::GENERIC);
+    ASSERT_EQ(2, results.size());
+    EXPECT_EQ(status_code::GENERIC, results[1].error().get_status_code());
+
+    std::this_thread::sleep_for(5ms);
+    runtime.on_timer();
+    EXPECT_TRUE(pool->take_requests().empty());
+}
+
+TEST(cluster_connection, pending_request_is_sent_on_handshake) {
+    auto cfg = make_configuration();
+
+    std::vector<ignite_result<void>> results;
+
+    auto pool = std::make_shared<fake_pool>(0, 0);
+    auto connection = start_connection(cfg, pool, {});
+
+    connection->perform_request<void>(
+        client_operation::TUPLE_UPSERT, payload_of(1), [](protocol::reader &) {}, store_to(results));
+
+    EXPECT_TRUE(pool->take_requests().empty());
+
+    pool->connect(1, "node-a");
+
+    auto requests = pool->take_requests();
+    ASSERT_EQ(1, requests.size());
+    EXPECT_EQ(1, requests[0].connection_id);
+
+    pool->respond(requests[0]);
+    ASSERT_EQ(1, results.size());
+    EXPECT_FALSE(results[0].has_error());
+}
+
+TEST(cluster_connection, pending_request_send_fails) {
+    auto cfg = make_configuration();
+
+    std::vector<ignite_result<void>> results;
+
+    auto pool = std::make_shared<fake_pool>(0, 0);
+    auto connection = start_connection(cfg, pool, {});
+
+    for (int i = 0; i < 3; ++i) {
+        connection->perform_request<void>(
+            client_operation::TUPLE_UPSERT, payload_of(1), [](protocol::reader &) {}, store_to(results));
+    }
+
+    // The second request fails to be sent while the queue is drained on handshake.
+    pool->fail_send(1);
+    pool->connect(1, "node-a");
+
+    ASSERT_EQ(1, results.size());
+    EXPECT_EQ(status_code::GENERIC, results[0].error().get_status_code());
+
+    auto requests = pool->take_requests();
+    ASSERT_EQ(2, requests.size());
+    for (auto &req : requests)
+        pool->respond(req);
+
+    ASSERT_EQ(3, results.size());
+    EXPECT_FALSE(results[1].has_error());
+    EXPECT_FALSE(results[2].has_error());
+}
+
+TEST(cluster_connection, pending_request_expires) {
+    auto runtime = client_runtime::create_external();
+    auto cfg = make_configuration();
+    cfg.set_runtime(runtime);
+    cfg.set_pending_request_timeout(20ms);
+
+    std::vector<ignite_result<void>> results;
+
+    auto pool = std::make_shared<fake_pool>(0, 0);
+    auto connection = start_connection(cfg, pool, {});
+
+    auto start = std::chrono::steady_clock::now();
+    connection->perform_request<void>(
+        client_operation::TUPLE_UPSERT, payload_of(1), [](protocol::reader &) {}, store_to(results));
+
+    ASSERT_TRUE(run_timers_until(runtime, [&] { return !results.empty(); }));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+
+    ASSERT_EQ(1, results.size());
+    EXPECT_EQ(status_code::NETWORK, results[0].error().get_status_code());
+
+    // The expired request is not sent once a connection is ready.
+    pool->connect(1, "node-a");
+    EXPECT_TRUE(pool->take_requests().empty());
+}
+
+TEST(cluster_connection, assignment_version_changes) {
+    auto cfg = make_configuration();
+
+    std::vector<ignite_result<void>> results;
+
+    auto pool = std::make_shared<fake_pool>(0, 0);
+    auto connection = start_connection(cfg, pool, {"node-a"});
+
+    EXPECT_TRUE(connection->is_node_connected("node-a"));
+    EXPECT_FALSE(connection->is_node_connected("node-b"));
+
+    auto version = connection->get_assignment_version();
+
+    connection->perform_request<void>(
+        client_operation::TUPLE_GET, payload_of(1), [](protocol::reader &) {}, store_to(results));
+    pool->respond(pool->take_requests().at(0));
+    EXPECT_EQ(version, connection->get_assignment_version());
+
+    connection->perform_request<void>(
+        client_operation::TUPLE_GET, payload_of(1), [](protocol::reader &) {}, store_to(results));
+    pool->respond(pool->take_requests().at(0), {}, std::int32_t(response_flag::PARTITION_ASSIGNMENT_CHANGED));
+    EXPECT_LT(version, connection->get_assignment_version());
+    version = connection->get_assignment_version();
+
+    pool->connect(2, "node-b");
+    EXPECT_TRUE(connection->is_node_connected("node-b"));
+    EXPECT_LT(version, connection->get_assignment_version());
+    version = connection->get_assignment_version();
+
+    pool->close(2, ignite_error(status_code::NETWORK, "Connection lost"));
+    EXPECT_FALSE(connection->is_node_connected("node-b"));
+    EXPECT_LT(version, connection->get_assignment_version());
+
+    ASSERT_EQ(2, results.size());
+}
+
+TEST(cluster_connection, outlier_is_ejected_and_readmitted) {
+    auto runtime = client_runtime::create_external();
+    auto cfg = make_configuration();
+    cfg.set_runtime(runtime);
+
+    outlier_detection detection;
+    detection.set_interval(5ms);
+    detection.set_min_requests(4);
+    detection.set_error_rate_threshold(0.5);
+    detection.set_base_ejection_time(20ms);
+    detection.set_max_ejected_fraction(0.5);
+    cfg.set_outlier_detection(detection);
+
+    std::vector<ignite_result<void>> results;
+
+    auto pool = std::make_shared<fake_pool>(0, 0);
+    auto connection = start_connection(cfg, pool, {"node-a", "node-b"});
+
+    // Sends a request to the node and answers it. Returns the ID of the connection the request is routed to.
+    auto route = [&](const std::string &node_id, std::optional<status_code> err = {}) {
+        connection->perform_request<void>(
+            client_operation::TUPLE_UPSERT, payload_of(1), [](protocol::reader &) {}, store_to(results), node_id);
+
+        auto requests = pool->take_requests();
+        EXPECT_EQ(1, requests.size());
+        pool->respond(requests.at(0), err);
+
+        return requests.at(0).connection_id;
+    };
+
+    // Waits for the probe of the ejected connection.
+    auto wait_probe = [&] {
+        std::optional<fake_pool::request> probe;
+        EXPECT_TRUE(run_timers_until(runtime, [&] {
+            for (auto &req : pool->take_requests()) {
+                if (req.op == client_operation::HEARTBEAT)
+                    probe = req;
+            }
+
+            return probe.has_value();
+        }));
+
+        return probe.value_or(fake_pool::request{});
+    };
+
+    // Application errors, like a missing table, do not make the node an outlier.
+    for (int i = 0; i < 4; ++i)
+        EXPECT_EQ(1, route("node-a", TABLE_NOT_FOUND_ERR));
+
+    std::this_thread::sleep_for(10ms);
+    runtime.on_timer();
+    EXPECT_EQ(1, route("node-a"));
+
+    // Internal errors do. The window still holds the requests above, so the rate needs more of them to reach the limit.
+    for (int i = 0; i < 8; ++i)
+        EXPECT_EQ(1, route("node-a", UNEXPECTED_ERR));
+
+    // Requests to the ejected node go to the other one. Detection runs without traffic, which would lower the rate.
+    std::this_thread::sleep_for(10ms);
+    runtime.on_timer();
+    for (int i = 0; i < 5; ++i)
+        EXPECT_EQ(2, route("node-a"));
+
+    // A failed probe ejects the connection again.
+    auto probe = wait_probe();
+    EXPECT_EQ(1, probe.connection_id);
+    pool->respond(probe, UNEXPECTED_ERR);
+    EXPECT_EQ(2, route("node-a"));
+
+    // A successful probe returns the connection to routing.
+    probe = wait_probe();
+    EXPECT_EQ(1, probe.connection_id);
+    pool->respond(probe);
+    EXPECT_EQ(1, route("node-a"));
+}
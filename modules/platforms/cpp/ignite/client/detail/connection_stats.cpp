@@ -0,0 +1,62 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "connection_stats.h"
+
+#include <algorithm>
+
+namespace ignite::detail {
+
+void connection_stats::record(std::chrono::microseconds latency, bool error) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto idx = m_count % WINDOW_SIZE;
+    m_latencies[idx] = latency.count();
+    m_errors[idx] = error;
+    ++m_count;
+}
+
+connection_stats::snapshot connection_stats::get_snapshot() const {
+    std::array<std::int64_t, WINDOW_SIZE> latencies{};
+
+    snapshot res;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        res.requests = std::min(m_count, WINDOW_SIZE);
+        std::copy_n(m_latencies.begin(), res.requests, latencies.begin());
+        res.errors = std::size_t(std::count(m_errors.begin(), m_errors.begin() + res.requests, true));
+    }
+
+    if (!res.requests)
+        return res;
+
+    auto p90 = latencies.begin() + (res.requests * 9) / 10;
+    std::nth_element(latencies.begin(), p90, latencies.begin() + res.requests);
+    res.latency_p90 = std::chrono::microseconds(*p90);
+
+    return res;
+}
+
+void connection_stats::reset() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_count = 0;
+    m_errors.fill(false);
+}
+
+} // namespace ignite::detail
@@ -0,0 +1,91 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace ignite::detail {
+
+/**
+ * Outcomes of the recent requests of a connection.
+ */
+class connection_stats {
+public:
+    /** Number of the recent requests to keep. */
+    static constexpr std::size_t WINDOW_SIZE = 128;
+
+    /**
+     * Statistics snapshot.
+     */
+    struct snapshot {
+        /** Number of requests. */
+        std::size_t requests{0};
+
+        /** Number of failed requests. */
+        std::size_t errors{0};
+
+        /** 90th percentile of latency. */
+        std::chrono::microseconds latency_p90{0};
+
+        /**
+         * Get error rate.
+         *
+         * @return Error rate from 0 to 1.
+         */
+        [[nodiscard]] double error_rate() const { return requests ? double(errors) / double(requests) : 0.0; }
+    };
+
+    /**
+     * Record request outcome.
+     *
+     * @param latency Request latency.
+     * @param error Whether the request failed.
+     */
+    void record(std::chrono::microseconds latency, bool error);
+
+    /**
+     * Get statistics of the recent requests.
+     *
+     * @return Snapshot.
+     */
+    [[nodiscard]] snapshot get_snapshot() const;
+
+    /**
+     * Forget all recorded requests.
+     */
+    void reset();
+
+private:
+    /** Mutex. */
+    mutable std::mutex m_mutex;
+
+    /** Latencies in microseconds. Ring buffer. */
+    std::array<std::int64_t, WINDOW_SIZE> m_latencies{};
+
+    /** Error flags. Ring buffer. */
+    std::array<bool, WINDOW_SIZE> m_errors{};
+
+    /** Total number of recorded requests. */
+    std::size_t m_count{0};
+};
+
+} // namespace ignite::detail
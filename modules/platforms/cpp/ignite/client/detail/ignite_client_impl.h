@@ -18,13 +18,17 @@
 #pragma once
 
 #include <ignite/client/detail/cluster_connection.h>
+#include <ignite/client/detail/sql/sql_impl.h>
 #include <ignite/client/detail/table/tables_impl.h>
 #include <ignite/client/ignite_client_configuration.h>
 
 #include <ignite/common/ignite_result.h>
 
+#include <functional>
 #include <future>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace ignite::detail {
 
@@ -48,7 +52,8 @@ public:
     explicit ignite_client_impl(ignite_client_configuration configuration)
         : m_configuration(std::move(configuration))
         , m_connection(cluster_connection::create(m_configuration))
-        , m_tables(std::make_shared<tables_impl>(m_connection)) {}
+        , m_tables(std::make_shared<tables_impl>(m_connection))
+        , m_sql(std::make_shared<sql_impl>(m_connection)) {}
 
     /**
      * Destructor.
@@ -61,7 +66,20 @@ public:
      * @param timeout Timeout.
      * @param callback Callback.
      */
-    void start(std::function<void(ignite_result<void>)> callback) { m_connection->start_async(std::move(callback)); }
+    void start(std::function<void(ignite_result<void>)> callback) {
+        m_connection->start_async(std::move(callback), make_warmup());
+    }
+
+    /**
+     * Start client. The start fails if the connection is not established within the timeout.
+     *
+     * @param timeout Timeout.
+     * @param callback Callback.
+     */
+    void start(std::chrono::milliseconds timeout, std::function<void(ignite_result<void>)> callback) {
+        m_connection->start_async(std::move(callback), make_warmup());
+        m_connection->set_start_timeout(timeout);
+    }
 
     /**
      * Stop client.
@@ -82,7 +100,37 @@ public:
      */
     [[nodiscard]] std::shared_ptr<tables_impl> get_tables_impl() const { return m_tables; }
 
+    /**
+     * Get SQL API implementation.
+     *
+     * @return SQL API implementation.
+     */
+    [[nodiscard]] std::shared_ptr<sql_impl> get_sql_impl() const { return m_sql; }
+
 private:
+    /**
+     * Make the warm-up function that loads the tables of the warm-up settings.
+     *
+     * @return Warm-up function. Empty if there are no tables to load.
+     */
+    [[nodiscard]] std::function<void(ignite_callback<void>)> make_warmup() const {
+        auto tables = m_configuration.get_warmup().get_tables();
+        if (tables.empty())
+            return {};
+
+        // The function is kept by the connection, which is kept by the tables, so the tables are not owned.
+        return [tables_weak = std::weak_ptr<tables_impl>(m_tables), tables = std::move(tables)](
+                   ignite_callback<void> callback) {
+            auto impl = tables_weak.lock();
+            if (!impl) {
+                callback({ignite_error("Client is stopped")});
+                return;
+            }
+
+            impl->preload_async(tables, std::move(callback));
+        };
+    }
+
     /** Configuration. */
     const ignite_client_configuration m_configuration;
 
@@ -91,6 +139,9 @@ private:
 
     /** Tables. */
     std::shared_ptr<tables_impl> m_tables;
+
+    /** SQL. */
+    std::shared_ptr<sql_impl> m_sql;
 };
 
 } // namespace ignite::detail
@@ -19,19 +19,55 @@
 
 #include <ignite/protocol/utils.h>
 
+#include <algorithm>
+
 namespace ignite::detail {
 
-node_connection::node_connection(
-    uint64_t id, std::shared_ptr<network::async_client_pool> pool, std::shared_ptr<ignite_logger> logger)
+/**
+ * Check whether the error response tells about a failure of the node rather than of the request. Application errors,
+ * e.g. a missing table or an invalid query, say nothing about the health of the node.
+ *
+ * @param err Error from the server.
+ * @return @c true if the error is counted by the outlier detection.
+ */
+bool is_node_failure(const ignite_error &err) {
+    // Server error code holds the error group in the high 16 bits and the code within the group in the low ones.
+    constexpr std::int32_t COMMON_GROUP = 1;
+    constexpr std::int32_t UNEXPECTED_ERR = 1;
+    constexpr std::int32_t NODE_STOPPING_ERR = 2;
+    constexpr std::int32_t COMPONENT_NOT_STARTED_ERR = 3;
+    constexpr std::int32_t UNKNOWN_ERR = 0xFFFF;
+
+    auto code = std::int32_t(err.get_status_code());
+    if (code >> 16 != COMMON_GROUP)
+        return false;
+
+    switch (code & 0xFFFF) {
+        case UNEXPECTED_ERR:
+        case NODE_STOPPING_ERR:
+        case COMPONENT_NOT_STARTED_ERR:
+        case UNKNOWN_ERR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+node_connection::node_connection(uint64_t id, network::end_point address,
+    std::shared_ptr<network::async_client_pool> pool, std::shared_ptr<ignite_logger> logger,
+    std::function<void()> on_assignment_changed)
     : m_id(id)
+    , m_address(std::move(address))
     , m_pool(std::move(pool))
-    , m_logger(std::move(logger)) {
+    , m_logger(std::move(logger))
+    , m_on_assignment_changed(std::move(on_assignment_changed)) {
 }
 
 node_connection::~node_connection() {
-    for (auto &handler : m_request_handlers) {
+    for (auto &request : m_request_handlers) {
         auto handlingRes = result_of_operation<void>([&]() {
-            auto res = handler.second->set_error(ignite_error("Connection closed before response was received"));
+            auto res = request.second.handler->set_error(
+                ignite_error(status_code::NETWORK, "Connection closed before response was received"));
             if (res.has_error())
                 m_logger->log_error(
                     "Uncaught user callback exception while handling operation error: " + res.error().what_str());
@@ -69,7 +105,48 @@ bool node_connection::handshake() {
     return m_pool->send(m_id, std::move(message));
 }
 
+bool node_connection::send_heartbeat() {
+    if (m_heartbeat_pending.exchange(true)) {
+        auto missed = ++m_missed_heartbeats;
+        if (!m_suspect.exchange(true))
+            m_logger->log_warning("Heartbeat is not answered, connection is suspect. Connection ID: "
+                + std::to_string(m_id));
+
+        if (missed >= MAX_MISSED_HEARTBEATS)
+            return false;
+    }
+
+    auto sent = std::chrono::steady_clock::now();
+    auto handler = std::make_shared<response_handler_impl<void>>(
+        [](protocol::reader &) {}, [this, sent](ignite_result<void> &&res) {
+            if (res.has_error())
+                return;
+
+            auto rtt = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - sent);
+            m_rtt_us.store(rtt.count(), std::memory_order_relaxed);
+        });
+
+    // Failure to send means the connection is already closing.
+    try {
+        perform_request<void>(
+            client_operation::HEARTBEAT, [](protocol::writer &) {}, std::move(handler));
+    } catch (const ignite_error &err) {
+        if (err.get_status_code() != status_code::BACKPRESSURE)
+            throw;
+
+        // The node does not read the queued requests. The heartbeat is counted as missed.
+    }
+
+    return true;
+}
+
 void node_connection::process_message(bytes_view msg) {
+    // Any message from the server proves that the connection is alive.
+    m_heartbeat_pending.store(false);
+    m_missed_heartbeats.store(0);
+    if (m_suspect.exchange(false))
+        m_logger->log_info("Connection is alive again. Connection ID: " + std::to_string(m_id));
+
     protocol::reader reader(msg);
     auto responseType = reader.read_int32();
     if (message_type(responseType) != message_type::RESPONSE) {
@@ -79,9 +156,10 @@ void node_connection::process_message(bytes_view msg) {
 
     auto reqId = reader.read_int64();
     auto flags = reader.read_int32();
-    (void) flags; // Flags are unused for now.
+    if ((flags & std::int32_t(response_flag::PARTITION_ASSIGNMENT_CHANGED)) && m_on_assignment_changed)
+        m_on_assignment_changed();
 
-    auto handler = get_and_remove_handler(reqId);
+    auto [handler, sent] = get_and_remove_request(reqId);
 
     if (!handler) {
         m_logger->log_error("Missing handler for request with id=" + std::to_string(reqId));
@@ -89,6 +167,10 @@ void node_connection::process_message(bytes_view msg) {
     }
 
     auto err = protocol::read_error(reader);
+
+    auto latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - sent);
+    m_stats.record(latency, err && is_node_failure(*err));
+
     if (err) {
         m_logger->log_error("Error: " + err->what_str());
         auto res = handler->set_error(std::move(err.value()));
@@ -123,8 +205,8 @@ ignite_result<void> node_connection::process_handshake_rsp(bytes_view msg) {
     if (err)
         return {ignite_error(err.value())};
 
-    (void) reader.read_int64(); // TODO: IGNITE-17606 Implement heartbeats
-    (void) reader.read_string_nullable(); // Cluster node ID. Needed for partition-aware compute.
+    auto idle_timeout = reader.read_int64();
+    auto node_id = reader.read_string_nullable();
     (void) reader.read_string_nullable(); // Cluster node name. Needed for partition-aware compute.
 
     reader.skip(); // TODO: IGNITE-18053 Get and verify cluster id on connection
@@ -132,12 +214,14 @@ ignite_result<void> node_connection::process_handshake_rsp(bytes_view msg) {
     reader.skip(); // Extensions.
 
     m_protocol_context.set_version(ver);
+    m_idle_timeout = std::chrono::milliseconds(std::max(idle_timeout, int64_t(0)));
+    m_node_id = node_id.value_or(std::string());
     m_handshake_complete = true;
 
     return {};
 }
 
-std::shared_ptr<response_handler> node_connection::get_and_remove_handler(int64_t req_id) {
+node_connection::pending_request node_connection::get_and_remove_request(int64_t req_id) {
     std::lock_guard<std::mutex> lock(m_request_handlers_mutex);
 
     auto it = m_request_handlers.find(req_id);
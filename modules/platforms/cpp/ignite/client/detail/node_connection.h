@@ -18,25 +18,44 @@
 #pragma once
 
 #include <ignite/client/detail/client_operation.h>
+#include <ignite/client/detail/connection_stats.h>
 #include <ignite/client/detail/protocol_context.h>
 #include <ignite/client/detail/response_handler.h>
 #include <ignite/client/ignite_client_configuration.h>
 
 #include <ignite/common/utils.h>
 #include <ignite/network/async_client_pool.h>
+#include <ignite/network/end_point.h>
 #include <ignite/protocol/reader.h>
 #include <ignite/protocol/writer.h>
 
 #include <atomic>
+#include <chrono>
+#include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 
 namespace ignite::detail {
 
 class cluster_connection;
 
+/**
+ * Outlier detection state of a connection.
+ */
+enum class outlier_state {
+    /** Connection is used for routing. */
+    HEALTHY,
+
+    /** Connection is ejected from routing. */
+    EJECTED,
+
+    /** Ejection time has passed, and the connection is being probed. */
+    PROBING,
+};
+
 /**
  * Represents connection to the cluster.
  *
@@ -46,6 +65,12 @@ class node_connection {
     friend class cluster_connection;
 
 public:
+    /** Minimal heartbeat interval. */
+    static constexpr std::chrono::milliseconds MIN_HEARTBEAT_INTERVAL{500};
+
+    /** Number of heartbeats in a row without a response, after which connection is considered dead. */
+    static constexpr std::int32_t MAX_MISSED_HEARTBEATS = 3;
+
     // Deleted
     node_connection() = delete;
     node_connection(node_connection &&) = delete;
@@ -62,11 +87,13 @@ public:
      * Constructor.
      *
      * @param id Connection ID.
+     * @param address Remote address.
      * @param pool Connection pool.
      * @param logger Logger.
+     * @param on_assignment_changed Called when the server reports a change of the partition assignment.
      */
-    node_connection(
-        uint64_t id, std::shared_ptr<network::async_client_pool> pool, std::shared_ptr<ignite_logger> logger);
+    node_connection(uint64_t id, network::end_point address, std::shared_ptr<network::async_client_pool> pool,
+        std::shared_ptr<ignite_logger> logger, std::function<void()> on_assignment_changed = {});
 
     /**
      * Get connection ID.
@@ -75,12 +102,57 @@ public:
      */
     [[nodiscard]] uint64_t id() const { return m_id; }
 
+    /**
+     * Get remote address.
+     *
+     * @return Address.
+     */
+    [[nodiscard]] const network::end_point &address() const { return m_address; }
+
     /**
      * Check whether handshake complete.
      *
      * @return @c true if the handshake complete.
      */
-    [[nodiscard]] bool is_handshake_complete() const { return m_handshake_complete; }
+    [[nodiscard]] bool is_handshake_complete() const { return m_handshake_complete.load(); }
+
+    /**
+     * Get server idle timeout received in handshake.
+     *
+     * @return Idle timeout. Zero if the server does not close idle connections.
+     */
+    [[nodiscard]] std::chrono::milliseconds get_idle_timeout() const { return m_idle_timeout; }
+
+    /**
+     * Get ID of the cluster node received in handshake.
+     *
+     * @return Node ID. Empty until the handshake is complete.
+     */
+    [[nodiscard]] const std::string &node_id() const { return m_node_id; }
+
+    /**
+     * Check whether the connection is suspect, i.e. the last heartbeat was not answered in time. Suspect connections
+     * should not be used for new requests.
+     *
+     * @return @c true if the connection is suspect.
+     */
+    [[nodiscard]] bool is_suspect() const { return m_suspect.load(std::memory_order_relaxed); }
+
+    /**
+     * Get round-trip time measured with the last answered heartbeat.
+     *
+     * @return Round-trip time or negative value if it was not measured yet.
+     */
+    [[nodiscard]] std::chrono::microseconds get_rtt() const {
+        return std::chrono::microseconds(m_rtt_us.load(std::memory_order_relaxed));
+    }
+
+    /**
+     * Send heartbeat. If the previous heartbeat is not answered yet, the connection is marked suspect.
+     *
+     * @return @c false if too many heartbeats in a row were not answered, and the connection should be closed.
+     */
+    bool send_heartbeat();
 
     /**
      * Send request.
@@ -90,6 +162,8 @@ public:
      * @param wr Writer function.
      * @param handler Response handler.
      * @return @c true on success and @c false otherwise.
+     *
+     * @throw ignite_error with status_code::BACKPRESSURE if the send queue is saturated. The handler is not called.
      */
     template<typename T>
     bool perform_request(client_operation op, const std::function<void(protocol::writer &)> &wr,
@@ -109,13 +183,21 @@ public:
 
             {
                 std::lock_guard<std::mutex> lock(m_request_handlers_mutex);
-                m_request_handlers[reqId] = std::move(handler);
+                m_request_handlers[reqId] = {std::move(handler), std::chrono::steady_clock::now()};
             }
         }
 
-        bool sent = m_pool->send(m_id, std::move(message));
+        bool sent;
+        try {
+            sent = m_pool->send(m_id, std::move(message));
+        } catch (...) {
+            // E.g. the send queue is full. The caller decides what to do with the request.
+            get_and_remove_request(reqId);
+            throw;
+        }
+
         if (!sent) {
-            get_and_remove_handler(reqId);
+            get_and_remove_request(reqId);
             return false;
         }
         return true;
@@ -142,24 +224,104 @@ public:
      */
     ignite_result<void> process_handshake_rsp(bytes_view msg);
 
+    /**
+     * Get statistics of the recent requests.
+     *
+     * @return Statistics.
+     */
+    [[nodiscard]] const connection_stats &get_stats() const { return m_stats; }
+
+    /**
+     * Get outlier detection state.
+     *
+     * @return State.
+     */
+    [[nodiscard]] outlier_state get_outlier_state() const { return m_outlier_state.load(); }
+
+    /**
+     * Check whether the connection can be used for routing, i.e. it is not ejected as an outlier.
+     *
+     * @return @c true if the connection is not ejected.
+     */
+    [[nodiscard]] bool is_routable() const { return m_outlier_state.load() == outlier_state::HEALTHY; }
+
+    /**
+     * Check whether the send queue of the connection is saturated, i.e. the node does not read requests as fast as
+     * they are made. Saturated connections should not be used for new requests.
+     *
+     * @return @c true if the send queue is saturated.
+     */
+    [[nodiscard]] bool is_send_queue_saturated() const { return m_send_queue_saturated.load(); }
+
+    /**
+     * Set send queue saturation flag.
+     *
+     * @param saturated Saturation flag.
+     */
+    void set_send_queue_saturated(bool saturated) { m_send_queue_saturated.store(saturated); }
+
 private:
     /**
-     * Generate next request ID.
+     * Pending request.
+     */
+    struct pending_request {
+        /** Response handler. */
+        std::shared_ptr<response_handler> handler;
+
+        /** Time the request was sent at. */
+        std::chrono::steady_clock::time_point sent;
+    };
+
+    /**
+     * Get and remove pending request.
      *
-     * @return New request ID.
+     * @param req_id Request ID.
+     * @return Pending request. Handler is null if there is no request with the ID.
      */
-    [[nodiscard]] int64_t generate_request_id() { return m_req_id_gen.fetch_add(1, std::memory_order_relaxed); }
+    pending_request get_and_remove_request(int64_t req_id);
 
     /**
-     * Get and remove request handler.
+     * Generate next request ID.
      *
-     * @param reqId Request ID.
-     * @return Handler.
+     * @return New request ID.
      */
-    std::shared_ptr<response_handler> get_and_remove_handler(int64_t req_id);
+    [[nodiscard]] int64_t generate_request_id() { return m_req_id_gen.fetch_add(1, std::memory_order_relaxed); }
 
     /** Handshake complete. */
-    bool m_handshake_complete{false};
+    std::atomic_bool m_handshake_complete{false};
+
+    /** Server idle timeout. */
+    std::chrono::milliseconds m_idle_timeout{0};
+
+    /** Cluster node ID. */
+    std::string m_node_id;
+
+    /** Suspect flag. */
+    std::atomic_bool m_suspect{false};
+
+    /** Number of heartbeats in a row that were not answered. */
+    std::atomic_int32_t m_missed_heartbeats{0};
+
+    /** Heartbeat is sent, but nothing is received since then. */
+    std::atomic_bool m_heartbeat_pending{false};
+
+    /** Send queue saturation flag. */
+    std::atomic_bool m_send_queue_saturated{false};
+
+    /** Round-trip time in microseconds. */
+    std::atomic_int64_t m_rtt_us{-1};
+
+    /** Statistics of the recent requests. */
+    connection_stats m_stats;
+
+    /** Outlier detection state. */
+    std::atomic<outlier_state> m_outlier_state{outlier_state::HEALTHY};
+
+    /** Time the ejection ends at. Only accessed by the outlier detection. */
+    std::chrono::steady_clock::time_point m_ejected_until;
+
+    /** Number of ejections in a row. Only accessed by the outlier detection. */
+    std::int32_t m_ejections{0};
 
     /** Protocol context. */
     protocol_context m_protocol_context;
@@ -167,6 +329,9 @@ private:
     /** Connection ID. */
     uint64_t m_id{0};
 
+    /** Remote address. */
+    network::end_point m_address;
+
     /** Connection pool. */
     std::shared_ptr<network::async_client_pool> m_pool;
 
@@ -174,13 +339,16 @@ private:
     std::atomic_int64_t m_req_id_gen{0};
 
     /** Pending request handlers. */
-    std::unordered_map<int64_t, std::shared_ptr<response_handler>> m_request_handlers;
+    std::unordered_map<int64_t, pending_request> m_request_handlers;
 
     /** Handlers map mutex. */
     std::mutex m_request_handlers_mutex;
 
     /** Logger. */
     std::shared_ptr<ignite_logger> m_logger;
+
+    /** Partition assignment change callback. */
+    std::function<void()> m_on_assignment_changed;
 };
 
 } // namespace ignite::detail
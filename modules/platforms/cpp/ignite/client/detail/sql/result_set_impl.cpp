@@ -0,0 +1,279 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/client/detail/sql/result_set_impl.h"
+#include "ignite/client/detail/table/tuple_codec.h"
+
+#include "ignite/common/ignite_error.h"
+#include "ignite/protocol/utils.h"
+
+namespace ignite::detail {
+
+/**
+ * Read the rows of a page: an array of binary tuples.
+ *
+ * @param reader Reader.
+ * @param sch Schema of the result.
+ * @param options Batch options.
+ * @return Rows.
+ */
+std::vector<ignite_tuple> read_page(protocol::reader &reader, const schema *sch, const batch_options &options) {
+    auto count = reader.read_array_header();
+
+    return read_tuples(reader, count, sch, false, options);
+}
+
+result_set_impl::~result_set_impl() {
+    if (m_closed || !m_has_more || !m_resource_id)
+        return;
+
+    // Nobody waits for the result, so the cursor is closed in the background.
+    auto resource_id = *m_resource_id;
+    m_connection->perform_request_on<void>(
+        m_connection_id, client_operation::SQL_CURSOR_CLOSE,
+        [resource_id](protocol::writer &writer) { writer.write(resource_id); }, [](protocol::reader &) {},
+        [](ignite_result<void> &&) {});
+}
+
+/**
+ * Get Ignite type from the SQL column type code that the server sends in the result metadata.
+ *
+ * The codes follow the order of SqlColumnType rather than the one of ignite_type.
+ *
+ * @param val SQL column type code.
+ * @return Matching Ignite type.
+ */
+ignite_type ignite_type_from_sql_column_type(std::int32_t val) {
+    switch (val) {
+        case 0:
+            // Booleans are transferred as a single byte.
+            return ignite_type::INT8;
+        case 1:
+            return ignite_type::INT8;
+        case 2:
+            return ignite_type::INT16;
+        case 3:
+            return ignite_type::INT32;
+        case 4:
+            return ignite_type::INT64;
+        case 5:
+            return ignite_type::FLOAT;
+        case 6:
+            return ignite_type::DOUBLE;
+        case 7:
+            return ignite_type::DECIMAL;
+        case 8:
+            return ignite_type::DATE;
+        case 9:
+            return ignite_type::TIME;
+        case 10:
+            return ignite_type::DATETIME;
+        case 11:
+            return ignite_type::TIMESTAMP;
+        case 12:
+            return ignite_type::UUID;
+        case 13:
+            return ignite_type::BITMASK;
+        case 14:
+            return ignite_type::STRING;
+        case 15:
+            return ignite_type::BINARY;
+        case 18:
+            return ignite_type::NUMBER;
+        default:
+            throw ignite_error("SQL column type is not supported: " + std::to_string(val));
+    }
+}
+
+void result_set_impl::read(protocol::reader &reader) {
+    m_resource_id = reader.read_object_nullable<std::int64_t>();
+    m_has_rowset = reader.read_bool();
+    m_has_more = reader.read_bool();
+    m_was_applied = reader.read_bool();
+    m_affected_rows = reader.read_int64();
+
+    if (!m_has_rowset)
+        return;
+
+    // The fields of the columns follow the array header flat, rather than as an array per column.
+    auto columns_cnt = reader.read_array_header();
+
+    std::vector<column> columns;
+    columns.reserve(columns_cnt);
+    m_metadata.reserve(columns_cnt);
+    for (std::uint32_t i = 0; i < columns_cnt; ++i) {
+        auto name = reader.read_string();
+        auto nullable = reader.read_bool();
+        auto type = ignite_type_from_sql_column_type(reader.read_int32());
+        auto scale = reader.read_int32();
+        auto precision = reader.read_int32();
+
+        // The origin is not exposed: the column name, if differs, and the schema and the table, as names or as
+        // indexes of the columns that came from them first.
+        if (reader.read_bool()) {
+            reader.skip();
+            reader.skip();
+            reader.skip();
+        }
+
+        column col{};
+        col.name = name;
+        col.type = type;
+        col.nullable = nullable;
+        col.schema_index = std::int32_t(i);
+        col.scale = scale;
+
+        columns.emplace_back(std::move(col));
+        m_metadata.emplace_back(std::move(name), type, nullable, scale, precision);
+    }
+
+    m_schema = std::make_shared<schema>(0, 0, std::move(columns));
+    m_page = read_page(reader, m_schema.get(), get_batch_options(*m_connection));
+}
+
+bool result_set_impl::has_more_pages() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return !m_closed && (!m_pages.empty() || m_has_more);
+}
+
+void result_set_impl::fetch_next_page_async(ignite_callback<void> callback) {
+    std::optional<ignite_result<void>> res;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_closed)
+            throw ignite_error("Result set is closed");
+
+        if (m_waiter)
+            throw ignite_error("The next page is already being fetched");
+
+        if (m_pages.empty() && !m_has_more)
+            throw ignite_error("There are no more pages");
+
+        if (m_pages.empty())
+            m_waiter = std::move(callback);
+        else
+            res = pop_page_locked();
+    }
+
+    if (res)
+        callback(std::move(*res));
+
+    request_next_page();
+}
+
+void result_set_impl::close_async(ignite_callback<void> callback) {
+    bool close_cursor;
+    ignite_callback<void> waiter;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        close_cursor = !m_closed && m_has_more && m_resource_id;
+        m_closed = true;
+        m_pages.clear();
+        std::swap(waiter, m_waiter);
+    }
+
+    if (waiter)
+        waiter({ignite_error("Result set is closed")});
+
+    if (!close_cursor) {
+        callback({});
+        return;
+    }
+
+    auto resource_id = *m_resource_id;
+    m_connection->perform_request_on<void>(
+        m_connection_id, client_operation::SQL_CURSOR_CLOSE,
+        [resource_id](protocol::writer &writer) { writer.write(resource_id); }, [](protocol::reader &) {},
+        std::move(callback));
+}
+
+void result_set_impl::request_next_page() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        bool awaited = m_waiter || m_pages.size() < m_prefetch_pages;
+        if (m_closed || m_fetching || !m_has_more || !awaited)
+            return;
+
+        m_fetching = true;
+    }
+
+    auto resource_id = *m_resource_id;
+    auto reader_func = [sch = m_schema, options = get_batch_options(*m_connection)](protocol::reader &reader) {
+        page res;
+        res.rows = read_page(reader, sch.get(), options);
+        res.has_more = reader.read_bool();
+        return res;
+    };
+
+    // The pending request does not keep the result set alive, so the cursor is closed as soon as it is dropped.
+    m_connection->perform_request_on<page>(
+        m_connection_id, client_operation::SQL_CURSOR_NEXT_PAGE,
+        [resource_id](protocol::writer &writer) { writer.write(resource_id); }, std::move(reader_func),
+        [self_weak = weak_from_this()](ignite_result<page> &&res) {
+            if (auto self = self_weak.lock())
+                self->on_page(std::move(res));
+        });
+}
+
+void result_set_impl::on_page(ignite_result<page> &&res) {
+    ignite_callback<void> waiter;
+    ignite_result<void> waiter_res;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_fetching = false;
+        if (m_closed)
+            return;
+
+        if (res.has_error()) {
+            // The cursor state is unknown, so the error ends the result.
+            m_has_more = false;
+            m_pages.emplace_back(std::move(res).error());
+        } else {
+            auto fetched = std::move(res).value();
+            m_has_more = fetched.has_more;
+            m_pages.emplace_back(std::move(fetched.rows));
+        }
+
+        if (m_waiter) {
+            std::swap(waiter, m_waiter);
+            waiter_res = pop_page_locked();
+        }
+    }
+
+    if (waiter)
+        waiter(std::move(waiter_res));
+
+    request_next_page();
+}
+
+ignite_result<void> result_set_impl::pop_page_locked() {
+    auto fetched = std::move(m_pages.front());
+    m_pages.pop_front();
+
+    if (fetched.has_error())
+        return {std::move(fetched).error()};
+
+    m_page = std::move(fetched).value();
+    return {};
+}
+
+} // namespace ignite::detail
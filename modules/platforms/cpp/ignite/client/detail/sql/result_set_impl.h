@@ -0,0 +1,227 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/detail/cluster_connection.h"
+#include "ignite/client/detail/table/schema.h"
+#include "ignite/client/sql/column_metadata.h"
+#include "ignite/client/table/ignite_tuple.h"
+
+#include "ignite/common/ignite_result.h"
+#include "ignite/protocol/reader.h"
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Result set implementation.
+ *
+ * The server keeps the cursor on the node that executed the query, so all the requests to the cursor are sent over
+ * the same connection. At most one page is requested at a time to keep the pages in order.
+ */
+class result_set_impl : public std::enable_shared_from_this<result_set_impl> {
+public:
+    // Deleted
+    result_set_impl() = delete;
+    result_set_impl(result_set_impl &&) = delete;
+    result_set_impl(const result_set_impl &) = delete;
+    result_set_impl &operator=(result_set_impl &&) = delete;
+    result_set_impl &operator=(const result_set_impl &) = delete;
+
+    /**
+     * Constructor.
+     *
+     * @param connection Connection.
+     * @param connection_id ID of the node connection that the query was executed over.
+     * @param prefetch_pages Number of pages to fetch ahead of the current one.
+     */
+    result_set_impl(std::shared_ptr<cluster_connection> connection, std::uint64_t connection_id,
+        std::int32_t prefetch_pages)
+        : m_connection(std::move(connection))
+        , m_connection_id(connection_id)
+        , m_prefetch_pages(std::size_t(prefetch_pages)) {}
+
+    /**
+     * Destructor. Closes the server-side cursor if it is still open.
+     */
+    ~result_set_impl();
+
+    /**
+     * Read the query execution response, including the first page.
+     *
+     * @param reader Reader.
+     */
+    void read(protocol::reader &reader);
+
+    /**
+     * Start fetching the next pages in the background, if they are to be prefetched.
+     */
+    void prefetch() { request_next_page(); }
+
+    /**
+     * Get metadata of the result columns.
+     *
+     * @return Metadata.
+     */
+    [[nodiscard]] const std::vector<column_metadata> &metadata() const { return m_metadata; }
+
+    /**
+     * Check whether the query returns rows.
+     *
+     * @return @c true if the result contains rows.
+     */
+    [[nodiscard]] bool has_rowset() const { return m_has_rowset; }
+
+    /**
+     * Get the number of rows affected by the DML statement.
+     *
+     * @return Number of affected rows, or -1 if the statement is not DML.
+     */
+    [[nodiscard]] std::int64_t affected_rows() const { return m_affected_rows; }
+
+    /**
+     * Check whether the conditional DDL statement was applied.
+     *
+     * @return @c true if the statement was applied.
+     */
+    [[nodiscard]] bool was_applied() const { return m_was_applied; }
+
+    /**
+     * Get the current page.
+     *
+     * @return Rows of the current page.
+     */
+    [[nodiscard]] const std::vector<ignite_tuple> &current_page() const { return m_page; }
+
+    /**
+     * Take the rows of the current page, leaving the page empty.
+     *
+     * @return Rows of the current page.
+     */
+    [[nodiscard]] std::vector<ignite_tuple> take_current_page() { return std::exchange(m_page, {}); }
+
+    /**
+     * Check whether there are more pages.
+     *
+     * @return @c true if there are more pages to fetch.
+     */
+    [[nodiscard]] bool has_more_pages();
+
+    /**
+     * Make the next page current.
+     *
+     * @param callback Callback to be called once the page is fetched.
+     * @throw ignite_error if there are no more pages or the previous page is still being fetched.
+     */
+    void fetch_next_page_async(ignite_callback<void> callback);
+
+    /**
+     * Close the result set.
+     *
+     * @param callback Callback to be called once the result set is closed.
+     */
+    void close_async(ignite_callback<void> callback);
+
+private:
+    /**
+     * Page of the rows.
+     */
+    struct page {
+        /** Rows. */
+        std::vector<ignite_tuple> rows;
+
+        /** Whether there are more pages on the server. */
+        bool has_more{false};
+    };
+
+    /**
+     * Request the next page if it is awaited or can be prefetched, and no page is being fetched.
+     */
+    void request_next_page();
+
+    /**
+     * Handle the next page response.
+     *
+     * @param res Page or error.
+     */
+    void on_page(ignite_result<page> &&res);
+
+    /**
+     * Make the first of the fetched pages current. Should be called with the lock held.
+     *
+     * @return Result of the fetch of the page.
+     */
+    ignite_result<void> pop_page_locked();
+
+    /** Cluster connection. */
+    std::shared_ptr<cluster_connection> m_connection;
+
+    /** ID of the node connection holding the cursor. */
+    const std::uint64_t m_connection_id;
+
+    /** Number of pages to fetch ahead of the current one. */
+    const std::size_t m_prefetch_pages;
+
+    /** Cursor ID. Not set if the result is complete. */
+    std::optional<std::int64_t> m_resource_id;
+
+    /** Whether the query returns rows. */
+    bool m_has_rowset{false};
+
+    /** Number of affected rows. */
+    std::int64_t m_affected_rows{-1};
+
+    /** Whether the statement was applied. */
+    bool m_was_applied{false};
+
+    /** Column metadata. */
+    std::vector<column_metadata> m_metadata;
+
+    /** Schema the rows are decoded with. */
+    std::shared_ptr<schema> m_schema;
+
+    /** Current page. */
+    std::vector<ignite_tuple> m_page;
+
+    /** Mutex of the fetch state. */
+    std::mutex m_mutex;
+
+    /** Pages fetched ahead, in order. */
+    std::deque<ignite_result<std::vector<ignite_tuple>>> m_pages;
+
+    /** Whether there are pages on the server that are not requested yet. */
+    bool m_has_more{false};
+
+    /** Whether a page is being fetched. */
+    bool m_fetching{false};
+
+    /** Whether the result set is closed. */
+    bool m_closed{false};
+
+    /** Callback of the user waiting for the page that is being fetched. */
+    ignite_callback<void> m_waiter;
+};
+
+} // namespace ignite::detail
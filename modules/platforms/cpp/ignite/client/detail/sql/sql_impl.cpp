@@ -0,0 +1,143 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/client/detail/sql/sql_impl.h"
+#include "ignite/client/detail/sql/result_set_impl.h"
+#include "ignite/client/detail/table/tuple_codec.h"
+
+#include "ignite/common/ignite_error.h"
+#include "ignite/protocol/reader.h"
+#include "ignite/protocol/writer.h"
+#include "ignite/schema/binary_tuple_builder.h"
+
+namespace ignite::detail {
+
+/**
+ * Write statement arguments.
+ *
+ * The arguments are written as a single binary tuple. As there is no schema, every argument takes three elements:
+ * its type, scale and value.
+ *
+ * @param writer Writer.
+ * @param args Arguments.
+ */
+void write_args(protocol::writer &writer, const std::vector<primitive> &args) {
+    writer.write(std::int32_t(args.size()));
+    if (args.empty())
+        return;
+
+    binary_tuple_builder builder{std::int32_t(args.size() * 3)};
+
+    builder.start();
+    for (const auto &arg : args) {
+        if (arg.is_null()) {
+            builder.claim(std::nullopt);
+            builder.claim(std::nullopt);
+            builder.claim(std::nullopt);
+            continue;
+        }
+
+        builder.claim_int32(std::int32_t(arg.get_type()));
+        builder.claim_int32(0);
+        claim_column(builder, arg.get_type(), arg);
+    }
+
+    builder.layout();
+    for (const auto &arg : args) {
+        if (arg.is_null()) {
+            builder.append(std::nullopt);
+            builder.append(std::nullopt);
+            builder.append(std::nullopt);
+            continue;
+        }
+
+        builder.append_int32(std::int32_t(arg.get_type()));
+        builder.append_int32(0);
+        append_column(builder, arg.get_type(), arg);
+    }
+
+    writer.write_binary(builder.build());
+}
+
+/**
+ * Write session properties: the number of properties followed by a binary tuple with the name, type, scale and value
+ * of every property.
+ *
+ * The client sets no properties, so the tuple is empty.
+ *
+ * @param writer Writer.
+ */
+void write_properties(protocol::writer &writer) {
+    writer.write(std::int32_t(0));
+
+    binary_tuple_builder builder{0};
+    builder.start();
+    builder.layout();
+    writer.write_binary(builder.build());
+}
+
+void sql_impl::execute_async(transaction *tx, const sql_statement &statement, std::vector<primitive> &&args,
+    ignite_callback<result_set> &&callback) {
+    // TODO: IGNITE-17604 Implement transactions
+    if (tx)
+        throw ignite_error("Transactions are not implemented");
+
+    execute_cursor_async(statement, args,
+        [callback = std::move(callback)](ignite_result<std::shared_ptr<result_set_impl>> &&res) {
+            if (res.has_error()) {
+                callback({std::move(res).error()});
+                return;
+            }
+
+            auto impl = std::move(res).value();
+            impl->prefetch();
+
+            callback(result_set(std::move(impl)));
+        });
+}
+
+void sql_impl::execute_cursor_async(const sql_statement &statement, const std::vector<primitive> &args,
+    ignite_callback<std::shared_ptr<result_set_impl>> &&callback) {
+    auto writer_func = [&statement, &args](protocol::writer &writer) {
+        writer.write_nil(); // TODO: IGNITE-17604: write transaction ID here
+        writer.write(statement.schema());
+        writer.write(statement.page_size());
+
+        auto timeout = std::int64_t(statement.timeout().count());
+        if (timeout)
+            writer.write(timeout);
+        else
+            writer.write_nil();
+
+        writer.write_nil(); // Session idle timeout.
+        write_properties(writer);
+        writer.write(statement.query());
+        write_args(writer, args);
+    };
+
+    auto reader_func = [connection = m_connection, prefetch_pages = statement.prefetch_pages()](
+                           protocol::reader &reader, std::uint64_t connection_id) {
+        auto res = std::make_shared<result_set_impl>(connection, connection_id, prefetch_pages);
+        res->read(reader);
+        return res;
+    };
+
+    m_connection->perform_request_bound<std::shared_ptr<result_set_impl>>(
+        client_operation::SQL_EXEC, writer_func, std::move(reader_func), std::move(callback));
+}
+
+} // namespace ignite::detail
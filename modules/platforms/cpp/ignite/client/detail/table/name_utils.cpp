@@ -0,0 +1,98 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/client/detail/table/name_utils.h"
+
+#include "ignite/common/ignite_error.h"
+
+#include <cctype>
+
+namespace ignite::detail {
+
+std::vector<std::string> parse_qualified_name(std::string_view name) {
+    std::vector<std::string> parts;
+    std::size_t pos = 0;
+    while (true) {
+        std::string part;
+        if (pos < name.size() && name[pos] == '"') {
+            ++pos;
+            while (true) {
+                if (pos >= name.size())
+                    throw ignite_error("Quote is not closed in the name: " + std::string(name));
+
+                if (name[pos] == '"') {
+                    if (pos + 1 < name.size() && name[pos + 1] == '"') {
+                        part.push_back('"');
+                        pos += 2;
+                        continue;
+                    }
+
+                    ++pos;
+                    break;
+                }
+
+                part.push_back(name[pos++]);
+            }
+
+            if (pos < name.size() && name[pos] != '.')
+                throw ignite_error("Unexpected character after the quoted part of the name: " + std::string(name));
+        } else {
+            for (; pos < name.size() && name[pos] != '.'; ++pos)
+                part.push_back(char(std::toupper(static_cast<unsigned char>(name[pos]))));
+        }
+
+        if (part.empty())
+            throw ignite_error("Name can not have an empty part: " + std::string(name));
+
+        parts.push_back(std::move(part));
+
+        if (pos >= name.size())
+            return parts;
+
+        // Skip the dot.
+        ++pos;
+    }
+}
+
+std::string normalize_qualified_name(std::string_view name) {
+    std::string res;
+    for (const auto &part : parse_qualified_name(name)) {
+        if (!res.empty())
+            res.push_back('.');
+
+        res += quote_identifier(part);
+    }
+
+    return res;
+}
+
+std::string quote_identifier(std::string_view identifier) {
+    std::string res;
+    res.reserve(identifier.size() + 2);
+
+    res.push_back('"');
+    for (auto c : identifier) {
+        if (c == '"')
+            res.push_back('"');
+        res.push_back(c);
+    }
+    res.push_back('"');
+
+    return res;
+}
+
+} // namespace ignite::detail
@@ -0,0 +1,55 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Parse a name of a table or a column, optionally qualified with a schema.
+ *
+ * The parts of the name are separated by dots. An unquoted part is case-insensitive and is converted to upper case.
+ * A part in double quotes is used as is, with a doubled quote standing for a quote character.
+ *
+ * @param name Name, e.g. @c PUBLIC.TBL1 or @c "MySchema"."MyTable".
+ * @return Parts of the name.
+ * @throw ignite_error if the name or any of its parts is empty, or a quote is not closed.
+ */
+std::vector<std::string> parse_qualified_name(std::string_view name);
+
+/**
+ * Get the normalized form of a name, which is the same for all the spellings of the name.
+ *
+ * @param name Name, optionally qualified with a schema.
+ * @return Normalized name: the parsed parts, quoted and joined with dots.
+ * @throw ignite_error if the name is malformed.
+ */
+std::string normalize_qualified_name(std::string_view name);
+
+/**
+ * Quote an identifier for an SQL query.
+ *
+ * @param identifier Parsed identifier.
+ * @return Identifier in double quotes, with the quotes in it doubled.
+ */
+std::string quote_identifier(std::string_view identifier);
+
+} // namespace ignite::detail
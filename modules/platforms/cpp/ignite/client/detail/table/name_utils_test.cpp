@@ -0,0 +1,58 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "name_utils.h"
+
+#include "ignite/common/ignite_error.h"
+
+#include <gtest/gtest.h>
+
+using namespace ignite;
+using namespace ignite::detail;
+
+using parts = std::vector<std::string>;
+
+TEST(name_utils, unquoted_names_are_upper_case) {
+    EXPECT_EQ(parts{"TBL1"}, parse_qualified_name("tbl1"));
+    EXPECT_EQ((parts{"PUBLIC", "TBL1"}), parse_qualified_name("public.Tbl1"));
+}
+
+TEST(name_utils, quoted_names_are_used_as_is) {
+    EXPECT_EQ(parts{"MyTable"}, parse_qualified_name("\"MyTable\""));
+    EXPECT_EQ((parts{"My.Schema", "tbl"}), parse_qualified_name("\"My.Schema\".\"tbl\""));
+    EXPECT_EQ((parts{"PUBLIC", "a\"b"}), parse_qualified_name("public.\"a\"\"b\""));
+}
+
+TEST(name_utils, malformed_names) {
+    EXPECT_THROW((void) parse_qualified_name(""), ignite_error);
+    EXPECT_THROW((void) parse_qualified_name("a..b"), ignite_error);
+    EXPECT_THROW((void) parse_qualified_name("a."), ignite_error);
+    EXPECT_THROW((void) parse_qualified_name("\"abc"), ignite_error);
+    EXPECT_THROW((void) parse_qualified_name("\"a\"b"), ignite_error);
+    EXPECT_THROW((void) parse_qualified_name("\"\""), ignite_error);
+}
+
+TEST(name_utils, normalize) {
+    EXPECT_EQ("\"PUBLIC\".\"TBL1\"", normalize_qualified_name("public.tbl1"));
+    EXPECT_EQ(normalize_qualified_name("PUBLIC.TBL1"), normalize_qualified_name("public.\"TBL1\""));
+    EXPECT_NE(normalize_qualified_name("tbl1"), normalize_qualified_name("\"tbl1\""));
+}
+
+TEST(name_utils, quote) {
+    EXPECT_EQ("\"TBL1\"", quote_identifier("TBL1"));
+    EXPECT_EQ("\"a\"\"b\"", quote_identifier("a\"b"));
+}
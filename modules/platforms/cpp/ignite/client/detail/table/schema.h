@@ -48,6 +48,7 @@ struct column {
     ignite_type type{};
     bool nullable{false};
     bool is_key{false};
+    bool is_colocation{false};
     std::int32_t schema_index{0};
     std::int32_t scale{0};
 
@@ -71,6 +72,7 @@ struct column {
         res.type = ignite_type_from_int(protocol::unpack_object<std::int32_t>(arr.ptr[1]));
         res.is_key = protocol::unpack_object<bool>(arr.ptr[2]);
         res.nullable = protocol::unpack_object<bool>(arr.ptr[3]);
+        res.is_colocation = protocol::unpack_object<bool>(arr.ptr[4]);
         res.scale = protocol::unpack_object<std::int32_t>(arr.ptr[5]);
 
         return res;
@@ -85,6 +87,9 @@ struct schema {
     std::int32_t key_column_count{0};
     std::vector<column> columns;
 
+    /** Indices of the colocation columns. The key columns are used for colocation if no column is marked. */
+    std::vector<std::int32_t> colocation_columns;
+
     // Default
     schema() = default;
 
@@ -98,7 +103,17 @@ struct schema {
     schema(std::int32_t version, std::int32_t key_column_count, std::vector<column> &&columns)
         : version(version)
         , key_column_count(key_column_count)
-        , columns(std::move(columns)) {}
+        , columns(std::move(columns)) {
+        for (std::int32_t i = 0; i < std::int32_t(this->columns.size()); ++i) {
+            if (this->columns[i].is_colocation)
+                colocation_columns.push_back(i);
+        }
+
+        if (colocation_columns.empty()) {
+            for (std::int32_t i = 0; i < key_column_count; ++i)
+                colocation_columns.push_back(i);
+        }
+    }
 
     /**
      * Read schema using reader.
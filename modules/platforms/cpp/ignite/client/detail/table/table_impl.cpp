@@ -16,7 +16,13 @@
  */
 
 #include "ignite/client/detail/table/table_impl.h"
+#include "ignite/client/detail/sql/sql_impl.h"
+#include "ignite/client/detail/table/name_utils.h"
+#include "ignite/client/detail/table/table_scan_impl.h"
+#include "ignite/client/detail/table/tuple_codec.h"
+#include "ignite/client/table/binary_stream.h"
 
+#include "ignite/common/arena.h"
 #include "ignite/common/bits.h"
 #include "ignite/common/ignite_error.h"
 #include "ignite/protocol/bitset_span.h"
@@ -24,45 +30,100 @@
 #include "ignite/protocol/writer.h"
 #include "ignite/schema/binary_tuple_builder.h"
 #include "ignite/schema/binary_tuple_parser.h"
+#include "ignite/schema/hash_calculator.h"
+
+#include <map>
 
 namespace ignite::detail {
 
-/**
- * Claim space for the column.
- *
- * @param builder Binary tuple builder.
- * @param typ Column type.
- * @param index Tuple field index.
- * @param tuple Tuple.
- */
-void claim_column(binary_tuple_builder &builder, ignite_type typ, std::int32_t index, const ignite_tuple &tuple) {
+void claim_column(binary_tuple_builder &builder, ignite_type typ, const primitive &value) {
+    if (value.is_null()) {
+        builder.claim(std::nullopt);
+        return;
+    }
+
     switch (typ) {
         case ignite_type::INT8:
-            builder.claim_int8(tuple.get<std::int8_t>(index));
+            builder.claim_int8(value.get<std::int8_t>());
             break;
         case ignite_type::INT16:
-            builder.claim_int16(tuple.get<std::int16_t>(index));
+            builder.claim_int16(value.get<std::int16_t>());
             break;
         case ignite_type::INT32:
-            builder.claim_int32(tuple.get<std::int32_t>(index));
+            builder.claim_int32(value.get<std::int32_t>());
             break;
         case ignite_type::INT64:
-            builder.claim_int64(tuple.get<std::int64_t>(index));
+            builder.claim_int64(value.get<std::int64_t>());
             break;
         case ignite_type::FLOAT:
-            builder.claim_float(tuple.get<float>(index));
+            builder.claim_float(value.get<float>());
             break;
         case ignite_type::DOUBLE:
-            builder.claim_double(tuple.get<double>(index));
+            builder.claim_double(value.get<double>());
             break;
         case ignite_type::UUID:
-            builder.claim_uuid(tuple.get<uuid>(index));
+            builder.claim_uuid(value.get<uuid>());
             break;
         case ignite_type::STRING:
-            builder.claim(SizeT(tuple.get<const std::string &>(index).size()));
+            if (auto source = value.get_if<binary_source>())
+                builder.claim(SizeT(source->size()));
+            else
+                builder.claim(SizeT(value.get<const std::string &>().size()));
             break;
         case ignite_type::BINARY:
-            builder.claim(SizeT(tuple.get<const std::vector<std::byte> &>(index).size()));
+            if (auto source = value.get_if<binary_source>())
+                builder.claim(SizeT(source->size()));
+            else
+                builder.claim(SizeT(value.get<const std::vector<std::byte> &>().size()));
+            break;
+        default:
+            // TODO: IGNITE-18035 Support other types
+            throw ignite_error("Type with id " + std::to_string(int(typ)) + " is not yet supported");
+    }
+}
+
+void append_column(binary_tuple_builder &builder, ignite_type typ, const primitive &value) {
+    if (value.is_null()) {
+        builder.append(std::nullopt);
+        return;
+    }
+
+    switch (typ) {
+        case ignite_type::INT8:
+            builder.append_int8(value.get<std::int8_t>());
+            break;
+        case ignite_type::INT16:
+            builder.append_int16(value.get<std::int16_t>());
+            break;
+        case ignite_type::INT32:
+            builder.append_int32(value.get<std::int32_t>());
+            break;
+        case ignite_type::INT64:
+            builder.append_int64(value.get<std::int64_t>());
+            break;
+        case ignite_type::FLOAT:
+            builder.append_float(value.get<float>());
+            break;
+        case ignite_type::DOUBLE:
+            builder.append_double(value.get<double>());
+            break;
+        case ignite_type::UUID:
+            builder.append_uuid(value.get<uuid>());
+            break;
+        case ignite_type::STRING:
+        case ignite_type::BINARY:
+            if (auto source = value.get_if<binary_source>()) {
+                builder.append_bytes(SizeT(source->size()), [source](std::byte *dst, SizeT) { source->read_to(dst); });
+                break;
+            }
+
+            if (typ == ignite_type::BINARY) {
+                builder.append(typ, value.get<const std::vector<std::byte> &>());
+            } else {
+                const auto &str = value.get<const std::string &>();
+                bytes_view view{reinterpret_cast<const std::byte *>(str.data()), str.size()};
+                builder.append(typ, view);
+            }
             break;
         default:
             // TODO: IGNITE-18035 Support other types
@@ -71,44 +132,53 @@ void claim_column(binary_tuple_builder &builder, ignite_type typ, std::int32_t i
 }
 
 /**
- * Append column value to binary tuple.
+ * Append column value to the colocation hash.
  *
- * @param builder Binary tuple builder.
+ * @param calc Hash calculator.
  * @param typ Column type.
- * @param index Tuple field index.
- * @param tuple Tuple.
+ * @param value Value.
  */
-void append_column(binary_tuple_builder &builder, ignite_type typ, std::int32_t index, const ignite_tuple &tuple) {
+void append_column_hash(hash_calculator &calc, ignite_type typ, const primitive &value) {
+    if (value.is_null()) {
+        calc.append_null();
+        return;
+    }
+
     switch (typ) {
         case ignite_type::INT8:
-            builder.append_int8(tuple.get<std::int8_t>(index));
+            calc.append_int8(value.get<std::int8_t>());
             break;
         case ignite_type::INT16:
-            builder.append_int16(tuple.get<std::int16_t>(index));
+            calc.append_int16(value.get<std::int16_t>());
             break;
         case ignite_type::INT32:
-            builder.append_int32(tuple.get<std::int32_t>(index));
+            calc.append_int32(value.get<std::int32_t>());
             break;
         case ignite_type::INT64:
-            builder.append_int64(tuple.get<std::int64_t>(index));
+            calc.append_int64(value.get<std::int64_t>());
             break;
         case ignite_type::FLOAT:
-            builder.append_float(tuple.get<float>(index));
+            calc.append_float(value.get<float>());
             break;
         case ignite_type::DOUBLE:
-            builder.append_double(tuple.get<double>(index));
+            calc.append_double(value.get<double>());
             break;
         case ignite_type::UUID:
-            builder.append_uuid(tuple.get<uuid>(index));
+            calc.append_uuid(value.get<uuid>());
             break;
         case ignite_type::STRING: {
-            const auto &str = tuple.get<const std::string &>(index);
-            bytes_view view{reinterpret_cast<const std::byte *>(str.data()), str.size()};
-            builder.append(typ, view);
+            if (value.get_if<binary_source>())
+                throw ignite_error("Colocation hash can not be computed for a binary_source column value");
+
+            const auto &str = value.get<const std::string &>();
+            calc.append_bytes({reinterpret_cast<const std::byte *>(str.data()), str.size()});
             break;
         }
         case ignite_type::BINARY:
-            builder.append(typ, tuple.get<const std::vector<std::byte> &>(index));
+            if (value.get_if<binary_source>())
+                throw ignite_error("Colocation hash can not be computed for a binary_source column value");
+
+            calc.append_bytes(value.get<const std::vector<std::byte> &>());
             break;
         default:
             // TODO: IGNITE-18035 Support other types
@@ -123,7 +193,7 @@ void append_column(binary_tuple_builder &builder, ignite_type typ, std::int32_t
  * @param typ Column type.
  * @return Column value.
  */
-std::any read_next_column(binary_tuple_parser &parser, ignite_type typ) {
+primitive read_next_column(binary_tuple_parser &parser, ignite_type typ) {
     auto val_opt = parser.get_next();
     if (!val_opt)
         return {};
@@ -155,6 +225,49 @@ std::any read_next_column(binary_tuple_parser &parser, ignite_type typ) {
     }
 }
 
+/**
+ * Pass column value from binary tuple to the sink.
+ *
+ * @param parser Binary tuple parser.
+ * @param sink Sink.
+ * @return Column value: the sink, or null if the value is null.
+ */
+primitive read_next_column(binary_tuple_parser &parser, const binary_sink &sink) {
+    auto val_opt = parser.get_next();
+    if (!val_opt)
+        return {};
+
+    sink.write(val_opt.value());
+    return sink;
+}
+
+/**
+ * Make statement reading the whole table.
+ *
+ * @param table Table name.
+ * @param options Scan options.
+ * @return Statement.
+ */
+sql_statement make_scan_statement(const std::string &table, const table_scan_options &options) {
+    std::string query = "SELECT ";
+    if (options.columns().empty())
+        query += '*';
+
+    for (std::size_t i = 0; i < options.columns().size(); ++i) {
+        if (i)
+            query += ", ";
+        query += normalize_qualified_name(options.columns()[i]);
+    }
+
+    query += " FROM " + normalize_qualified_name(table);
+
+    sql_statement statement{std::move(query)};
+    statement.set_page_size(options.page_size());
+    statement.set_prefetch_pages(options.window());
+
+    return statement;
+}
+
 /**
  * Check transaction and throw an exception if it is not nullptr.
  *
@@ -187,7 +300,7 @@ std::vector<std::byte> pack_tuple(
         auto col_idx = tuple.column_ordinal(col.name);
 
         if (col_idx >= 0)
-            claim_column(builder, col.type, col_idx, tuple);
+            claim_column(builder, col.type, tuple.get(col_idx));
         else
             builder.claim(std::nullopt);
     }
@@ -198,7 +311,7 @@ std::vector<std::byte> pack_tuple(
         auto col_idx = tuple.column_ordinal(col.name);
 
         if (col_idx >= 0)
-            append_column(builder, col.type, col_idx, tuple);
+            append_column(builder, col.type, tuple.get(col_idx));
         else {
             builder.append(std::nullopt);
             no_value.set(std::size_t(i));
@@ -208,6 +321,60 @@ std::vector<std::byte> pack_tuple(
     return builder.build();
 }
 
+std::int32_t colocation_hash(const schema &sch, const ignite_tuple &tuple) {
+    hash_calculator calc;
+    for (auto idx : sch.colocation_columns) {
+        const auto &col = sch.columns[idx];
+        auto col_idx = tuple.column_ordinal(col.name);
+
+        if (col_idx >= 0)
+            append_column_hash(calc, col.type, tuple.get(col_idx));
+        else
+            calc.append_null();
+    }
+
+    return calc.get_hash();
+}
+
+std::int32_t colocation_hash(const schema &sch, bytes_view tuple, bool key_only) {
+    auto count = std::int32_t(key_only ? sch.key_column_count : sch.columns.size());
+    binary_tuple_parser parser(count, tuple);
+
+    // Colocation columns are in the schema order, so the tuple is read once up to the last of them.
+    hash_calculator calc;
+    std::int32_t column = 0;
+    for (auto idx : sch.colocation_columns) {
+        for (; column < idx; ++column)
+            parser.get_next();
+
+        calc.append(sch.columns[idx].type, parser.get_next());
+        ++column;
+    }
+
+    return calc.get_hash();
+}
+
+batch_options get_batch_options(const cluster_connection &connection) {
+    return {connection.get_configuration().is_response_arena_enabled(), connection.get_batch_pool()};
+}
+
+/**
+ * Get number of segments to split the batch rows into.
+ *
+ * @param pool Thread pool. Can be @c nullptr.
+ * @param count Number of rows.
+ * @return Number of segments. One means that the batch should be processed serially.
+ */
+std::size_t get_batch_segments(const thread_pool *pool, std::size_t count) {
+    // Smaller segments are not worth the synchronization.
+    constexpr std::size_t MIN_SEGMENT_ROWS = 512;
+
+    if (!pool)
+        return 1;
+
+    return std::max(std::size_t(1), std::min(std::size_t(pool->size()) + 1, count / MIN_SEGMENT_ROWS));
+}
+
 /**
  * Write tuple using table schema and writer.
  *
@@ -229,18 +396,30 @@ void write_tuple(protocol::writer &writer, const schema &sch, const ignite_tuple
     writer.write_binary(tuple_data);
 }
 
-/**
- * Write tuples using table schema and writer.
- *
- * @param writer Writer.
- * @param sch Schema.
- * @param tuples Tuples.
- * @param key_only Should only key fields be written or not.
- */
-void write_tuples(protocol::writer &writer, const schema &sch, const std::vector<ignite_tuple> &tuples, bool key_only) {
+void write_tuples(protocol::writer &writer, const schema &sch, const std::vector<ignite_tuple> &tuples, bool key_only,
+    thread_pool *pool) {
     writer.write(std::int32_t(tuples.size()));
-    for (auto &tuple : tuples)
-        write_tuple(writer, sch, tuple, key_only);
+
+    auto segments = get_batch_segments(pool, tuples.size());
+    if (segments == 1) {
+        for (auto &tuple : tuples)
+            write_tuple(writer, sch, tuple, key_only);
+
+        return;
+    }
+
+    // Rows are encoded into separate buffers that are then written in order.
+    std::vector<std::vector<std::byte>> encoded(segments);
+    pool->parallel_for(tuples.size(), segments, [&](std::size_t segment, std::size_t begin, std::size_t end) {
+        protocol::buffer_adapter buffer(encoded[segment]);
+        protocol::writer segment_writer(buffer);
+
+        for (auto i = begin; i < end; ++i)
+            write_tuple(segment_writer, sch, tuples[i], key_only);
+    });
+
+    for (auto &data : encoded)
+        writer.write_raw(data);
 }
 
 /**
@@ -276,7 +455,11 @@ ignite_tuple read_tuple(protocol::reader &reader, const schema *sch, const ignit
         if (i < sch->key_column_count) {
             res.set(column.name, key.get(column.name));
         } else {
-            res.set(column.name, read_next_column(parser, column.type));
+            auto key_idx = key.column_ordinal(column.name);
+            auto sink = key_idx >= 0 ? key.get(key_idx).get_if<binary_sink>() : nullptr;
+            bool streamed = sink && (column.type == ignite_type::BINARY || column.type == ignite_type::STRING);
+
+            res.set(column.name, streamed ? read_next_column(parser, *sink) : read_next_column(parser, column.type));
         }
     }
     return res;
@@ -285,16 +468,16 @@ ignite_tuple read_tuple(protocol::reader &reader, const schema *sch, const ignit
 /**
  * Read tuple.
  *
- * @param reader Reader.
+ * @param tuple_data Binary tuple.
  * @param sch Schema.
  * @param key_only Should only key fields be read or not.
+ * @param arena Memory arena to allocate the tuple from. Can be @c nullptr.
  * @return Tuple.
  */
-ignite_tuple read_tuple(protocol::reader &reader, const schema *sch, bool key_only) {
-    auto tuple_data = reader.read_binary();
-
+ignite_tuple read_tuple(bytes_view tuple_data, const schema *sch, bool key_only,
+    const std::shared_ptr<std::pmr::memory_resource> &arena) {
     auto columns_cnt = std::int32_t(key_only ? sch->key_column_count : sch->columns.size());
-    ignite_tuple res(columns_cnt);
+    ignite_tuple res(columns_cnt, arena);
     binary_tuple_parser parser(columns_cnt, tuple_data);
 
     for (std::int32_t i = 0; i < columns_cnt; ++i) {
@@ -304,51 +487,111 @@ ignite_tuple read_tuple(protocol::reader &reader, const schema *sch, bool key_on
     return res;
 }
 
+/**
+ * Make memory arena for the tuples of the response.
+ *
+ * @param sch Schema.
+ * @param key_only Whether only key fields are read.
+ * @param count Number of tuples.
+ * @param enabled Whether the arena is enabled.
+ * @return Memory arena or @c nullptr if disabled.
+ */
+std::shared_ptr<std::pmr::memory_resource> make_tuples_arena(
+    const schema *sch, bool key_only, std::int32_t count, bool enabled) {
+    if (!enabled || count <= 0)
+        return {};
+
+    // A column takes a name-value pair and an index node.
+    constexpr std::size_t COLUMN_SIZE_ESTIMATE = sizeof(std::pair<std::string, primitive>) + 64;
+
+    auto columns_cnt = std::size_t(key_only ? sch->key_column_count : sch->columns.size());
+    return std::make_shared<arena>(std::size_t(count) * columns_cnt * COLUMN_SIZE_ESTIMATE);
+}
+
 /**
  * Read tuples.
  *
+ * Rows are located first, so they can be decoded by several threads.
+ *
  * @param reader Reader.
  * @param sch Schema.
  * @param key_only Should only key fields be read or not.
+ * @param options Batch options.
  * @return Tuples.
  */
-std::vector<std::optional<ignite_tuple>> read_tuples_opt(protocol::reader &reader, const schema *sch, bool key_only) {
+std::vector<std::optional<ignite_tuple>> read_tuples_opt(
+    protocol::reader &reader, const schema *sch, bool key_only, const batch_options &options) {
     if (!sch)
         return {};
 
-    auto count = reader.read_int32();
-    std::vector<std::optional<ignite_tuple>> res;
-    res.reserve(std::size_t(count));
+    auto count = std::size_t(reader.read_int32());
 
-    for (std::int32_t i = 0; i < count; ++i) {
+    std::vector<std::optional<bytes_view>> rows;
+    rows.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
         auto exists = reader.read_bool();
-        if (!exists)
-            res.emplace_back(std::nullopt);
-        else
-            res.emplace_back(read_tuple(reader, sch, key_only));
+        rows.emplace_back(exists ? std::make_optional(reader.read_binary()) : std::nullopt);
     }
 
+    std::vector<std::optional<ignite_tuple>> res(count);
+    auto read_segment = [&](std::size_t, std::size_t begin, std::size_t end) {
+        auto arena = make_tuples_arena(sch, key_only, std::int32_t(end - begin), options.use_arena);
+        for (auto i = begin; i < end; ++i) {
+            if (rows[i])
+                res[i].emplace(read_tuple(*rows[i], sch, key_only, arena));
+        }
+    };
+
+    auto segments = get_batch_segments(options.pool, count);
+    if (segments == 1)
+        read_segment(0, 0, count);
+    else
+        options.pool->parallel_for(count, segments, read_segment);
+
     return res;
 }
 
-/**
- * Read tuples.
- *
- * @param reader Reader.
- * @param sch Schema.
- * @param key_only Should only key fields be read or not.
- * @return Tuples.
- */
-std::vector<ignite_tuple> read_tuples(protocol::reader &reader, const schema *sch, bool key_only) {
+std::vector<ignite_tuple> read_tuples(
+    protocol::reader &reader, const schema *sch, bool key_only, const batch_options &options) {
     if (!sch)
         return {};
 
-    auto count = reader.read_int32();
-    std::vector<ignite_tuple> res;
-    res.reserve(std::size_t(count));
+    auto count = std::size_t(reader.read_int32());
+
+    return read_tuples(reader, count, sch, key_only, options);
+}
 
-    for (std::int32_t i = 0; i < count; ++i)
-        res.emplace_back(read_tuple(reader, sch, key_only));
+std::vector<ignite_tuple> read_tuples(protocol::reader &reader, std::size_t count, const schema *sch, bool key_only,
+    const batch_options &options) {
+    auto segments = get_batch_segments(options.pool, count);
+    if (segments == 1) {
+        std::vector<ignite_tuple> res;
+        res.reserve(count);
+
+        auto arena = make_tuples_arena(sch, key_only, std::int32_t(count), options.use_arena);
+        for (std::size_t i = 0; i < count; ++i)
+            res.emplace_back(read_tuple(reader.read_binary(), sch, key_only, arena));
+
+        return res;
+    }
+
+    std::vector<bytes_view> rows;
+    rows.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        rows.emplace_back(reader.read_binary());
+
+    // Tuples are constructed in place rather than assigned, as an assigned tuple is not allocated from the arena.
+    std::vector<std::optional<ignite_tuple>> decoded(count);
+    options.pool->parallel_for(count, segments, [&](std::size_t, std::size_t begin, std::size_t end) {
+        auto arena = make_tuples_arena(sch, key_only, std::int32_t(end - begin), options.use_arena);
+        for (auto i = begin; i < end; ++i)
+            decoded[i].emplace(read_tuple(rows[i], sch, key_only, arena));
+    });
+
+    std::vector<ignite_tuple> res;
+    res.reserve(count);
+    for (auto &tuple : decoded)
+        res.emplace_back(std::move(*tuple));
 
     return res;
 }
@@ -394,50 +637,194 @@ void table_impl::load_schema_async(ignite_callback<std::shared_ptr<schema>> call
         client_operation::SCHEMAS_GET, writer_func, std::move(reader_func), std::move(callback));
 }
 
+/**
+ * Result of a batch read split between nodes. Rows are put in the order of the keys as the parts complete.
+ */
+class get_all_merge {
+public:
+    /**
+     * Constructor.
+     *
+     * @param count Number of keys.
+     * @param parts Number of parts.
+     * @param callback Callback to call once all the parts complete.
+     */
+    get_all_merge(
+        std::size_t count, std::size_t parts, ignite_callback<std::vector<std::optional<ignite_tuple>>> callback)
+        : m_rows(count)
+        , m_parts(parts)
+        , m_callback(std::move(callback)) {}
+
+    /**
+     * Complete a part.
+     *
+     * @param indices Indices of the keys of the part.
+     * @param res Rows of the part.
+     */
+    void complete(
+        const std::vector<std::size_t> &indices, ignite_result<std::vector<std::optional<ignite_tuple>>> &&res) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (res.has_error()) {
+                if (!m_error)
+                    m_error = std::move(res).error();
+            } else {
+                auto &rows = res.value();
+                for (std::size_t i = 0; i < indices.size() && i < rows.size(); ++i)
+                    m_rows[indices[i]] = std::move(rows[i]);
+            }
+
+            if (--m_parts)
+                return;
+        }
+
+        if (m_error)
+            m_callback({std::move(*m_error)});
+        else
+            m_callback(std::move(m_rows));
+    }
+
+private:
+    /** Mutex. */
+    std::mutex m_mutex;
+
+    /** Rows in the order of the keys. */
+    std::vector<std::optional<ignite_tuple>> m_rows;
+
+    /** Number of parts that are not complete yet. */
+    std::size_t m_parts;
+
+    /** First error. */
+    std::optional<ignite_error> m_error;
+
+    /** Callback. */
+    ignite_callback<std::vector<std::optional<ignite_tuple>>> m_callback;
+};
+
+std::string table_impl::get_read_node(
+    const partition_assignment *assignment, const schema &sch, const ignite_tuple &key) {
+    if (!assignment || assignment->empty())
+        return {};
+
+    std::int32_t hash;
+    try {
+        hash = colocation_hash(sch, key);
+    } catch (const ignite_error &) {
+        // The key is invalid or of an unsupported type. The read reports the error, if any.
+        return {};
+    }
+
+    const auto &node = (*assignment)[hash_calculator::get_partition(hash, std::int32_t(assignment->size()))];
+    if (node.empty())
+        return {};
+
+    if (!m_connection->is_node_connected(node)) {
+        // The primary replica has moved, or the node was restarted with a new ID, or it is just down.
+        drop_assignment(assignment);
+        return {};
+    }
+
+    return node;
+}
+
+void table_impl::drop_assignment(const partition_assignment *assignment) {
+    std::lock_guard<std::mutex> lock(m_assignment_mutex);
+    if (m_assignment.get() != assignment)
+        return;
+
+    // The node may be not connected for long, so the assignment is not reloaded on every read.
+    if (std::chrono::steady_clock::now() - m_assignment_loaded < ASSIGNMENT_MIN_AGE)
+        return;
+
+    m_assignment.reset();
+}
+
 void table_impl::get_async(
     transaction *tx, const ignite_tuple &key, ignite_callback<std::optional<ignite_tuple>> callback) {
     transactions_not_implemented(tx);
 
-    with_latest_schema_async<std::optional<ignite_tuple>>(std::move(callback),
+    with_read_assignment_async<std::optional<ignite_tuple>>(std::move(callback),
         [self = shared_from_this(), key = std::make_shared<ignite_tuple>(key)](
-            const schema &sch, auto callback) mutable {
-            auto writer_func = [self, key, &sch](protocol::writer &writer) {
-                write_table_operation_header(writer, self->m_id, sch);
-                write_tuple(writer, sch, *key, true);
-            };
+            std::shared_ptr<const partition_assignment> assignment, auto callback) mutable {
+            self->with_latest_schema_async<std::optional<ignite_tuple>>(std::move(callback),
+                [self, key, assignment = std::move(assignment)](const schema &sch, auto callback) mutable {
+                    auto writer_func = [self, key, &sch](protocol::writer &writer) {
+                        write_table_operation_header(writer, self->m_id, sch);
+                        write_tuple(writer, sch, *key, true);
+                    };
+
+                    auto reader_func = [self, key](protocol::reader &reader) -> std::optional<ignite_tuple> {
+                        std::shared_ptr<schema> sch = self->get_schema(reader);
+                        if (!sch)
+                            return std::nullopt;
+
+                        return read_tuple(reader, sch.get(), *key);
+                    };
+
+                    self->m_connection->perform_request<std::optional<ignite_tuple>>(client_operation::TUPLE_GET,
+                        writer_func, std::move(reader_func), std::move(callback),
+                        self->get_read_node(assignment.get(), sch, *key));
+                });
+        });
+}
 
-            auto reader_func = [self, key](protocol::reader &reader) -> std::optional<ignite_tuple> {
-                std::shared_ptr<schema> sch = self->get_schema(reader);
-                if (!sch)
-                    return std::nullopt;
+void table_impl::get_all_from_node(const schema &sch, std::shared_ptr<std::vector<ignite_tuple>> keys,
+    const std::string &node_id, ignite_callback<std::vector<std::optional<ignite_tuple>>> callback) {
+    auto writer_func = [this, &keys, &sch](protocol::writer &writer) {
+        write_table_operation_header(writer, m_id, sch);
+        write_tuples(writer, sch, *keys, true, m_connection->get_batch_pool());
+    };
 
-                return read_tuple(reader, sch.get(), *key);
-            };
+    auto reader_func = [self = shared_from_this()](
+                           protocol::reader &reader) -> std::vector<std::optional<ignite_tuple>> {
+        std::shared_ptr<schema> sch = self->get_schema(reader);
+        return read_tuples_opt(reader, sch.get(), false, get_batch_options(*self->m_connection));
+    };
 
-            self->m_connection->perform_request<std::optional<ignite_tuple>>(
-                client_operation::TUPLE_GET, writer_func, std::move(reader_func), std::move(callback));
-        });
+    m_connection->perform_request<std::vector<std::optional<ignite_tuple>>>(
+        client_operation::TUPLE_GET_ALL, writer_func, std::move(reader_func), std::move(callback), node_id);
 }
 
 void table_impl::get_all_async(transaction *tx, std::vector<ignite_tuple> keys,
     ignite_callback<std::vector<std::optional<ignite_tuple>>> callback) {
+    typedef std::vector<std::optional<ignite_tuple>> result_type;
+
     transactions_not_implemented(tx);
 
     auto shared_keys = std::make_shared<std::vector<ignite_tuple>>(std::move(keys));
-    with_latest_schema_async<std::vector<std::optional<ignite_tuple>>>(
-        std::move(callback), [self = shared_from_this(), keys = shared_keys](const schema &sch, auto callback) mutable {
-            auto writer_func = [self, keys, &sch](protocol::writer &writer) {
-                write_table_operation_header(writer, self->m_id, sch);
-                write_tuples(writer, sch, *keys, true);
-            };
-
-            auto reader_func = [self](protocol::reader &reader) -> std::vector<std::optional<ignite_tuple>> {
-                std::shared_ptr<schema> sch = self->get_schema(reader);
-                return read_tuples_opt(reader, sch.get(), false);
-            };
-
-            self->m_connection->perform_request<std::vector<std::optional<ignite_tuple>>>(
-                client_operation::TUPLE_GET_ALL, writer_func, std::move(reader_func), std::move(callback));
+    with_read_assignment_async<result_type>(std::move(callback),
+        [self = shared_from_this(), keys = shared_keys](
+            std::shared_ptr<const partition_assignment> assignment, auto callback) mutable {
+            self->with_latest_schema_async<result_type>(std::move(callback),
+                [self, keys, assignment = std::move(assignment)](const schema &sch, auto callback) mutable {
+                    if (!assignment || keys->empty()) {
+                        self->get_all_from_node(sch, keys, {}, std::move(callback));
+                        return;
+                    }
+
+                    // Keys are grouped by the node to read them from, keeping their order within the group.
+                    std::map<std::string, std::vector<std::size_t>> groups;
+                    for (std::size_t i = 0; i < keys->size(); ++i)
+                        groups[self->get_read_node(assignment.get(), sch, (*keys)[i])].push_back(i);
+
+                    if (groups.size() == 1) {
+                        self->get_all_from_node(sch, keys, groups.begin()->first, std::move(callback));
+                        return;
+                    }
+
+                    auto merge = std::make_shared<get_all_merge>(keys->size(), groups.size(), std::move(callback));
+                    for (auto &[node_id, indices] : groups) {
+                        auto group = std::make_shared<std::vector<ignite_tuple>>();
+                        group->reserve(indices.size());
+                        for (auto i : indices)
+                            group->emplace_back(std::move((*keys)[i]));
+
+                        self->get_all_from_node(sch, std::move(group), node_id,
+                            [merge, indices = std::move(indices)](ignite_result<result_type> &&res) {
+                                merge->complete(indices, std::move(res));
+                            });
+                    }
+                });
         });
 }
 
@@ -463,7 +850,7 @@ void table_impl::upsert_all_async(transaction *tx, std::vector<ignite_tuple> rec
         [self = shared_from_this(), records = shared_records](const schema &sch, auto callback) mutable {
             auto writer_func = [self, records, &sch](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, sch);
-                write_tuples(writer, sch, *records, false);
+                write_tuples(writer, sch, *records, false, self->m_connection->get_batch_pool());
             };
 
             self->m_connection->perform_request_wr(
@@ -521,12 +908,12 @@ void table_impl::insert_all_async(
         [self = shared_from_this(), records = shared_records](const schema &sch, auto callback) mutable {
             auto writer_func = [self, records, &sch](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, sch);
-                write_tuples(writer, sch, *records, false);
+                write_tuples(writer, sch, *records, false, self->m_connection->get_batch_pool());
             };
 
             auto reader_func = [self, records](protocol::reader &reader) -> std::vector<ignite_tuple> {
                 std::shared_ptr<schema> sch = self->get_schema(reader);
-                return read_tuples(reader, sch.get(), false);
+                return read_tuples(reader, sch.get(), false, get_batch_options(*self->m_connection));
             };
 
             self->m_connection->perform_request<std::vector<ignite_tuple>>(
@@ -663,12 +1050,12 @@ void table_impl::remove_all_async(
         std::move(callback), [self = shared_from_this(), keys = std::move(keys)](const schema &sch, auto callback) {
             auto writer_func = [self, &keys, &sch](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, sch);
-                write_tuples(writer, sch, keys, true);
+                write_tuples(writer, sch, keys, true, self->m_connection->get_batch_pool());
             };
 
             auto reader_func = [self](protocol::reader &reader) -> std::vector<ignite_tuple> {
                 std::shared_ptr<schema> sch = self->get_schema(reader);
-                return read_tuples(reader, sch.get(), true);
+                return read_tuples(reader, sch.get(), true, get_batch_options(*self->m_connection));
             };
 
             self->m_connection->perform_request<std::vector<ignite_tuple>>(
@@ -684,12 +1071,12 @@ void table_impl::remove_all_exact_async(
         [self = shared_from_this(), records = std::move(records)](const schema &sch, auto callback) {
             auto writer_func = [self, &records, &sch](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, sch);
-                write_tuples(writer, sch, records, false);
+                write_tuples(writer, sch, records, false, self->m_connection->get_batch_pool());
             };
 
             auto reader_func = [self](protocol::reader &reader) -> std::vector<ignite_tuple> {
                 std::shared_ptr<schema> sch = self->get_schema(reader);
-                return read_tuples(reader, sch.get(), false);
+                return read_tuples(reader, sch.get(), false, get_batch_options(*self->m_connection));
             };
 
             self->m_connection->perform_request<std::vector<ignite_tuple>>(
@@ -697,4 +1084,95 @@ void table_impl::remove_all_exact_async(
         });
 }
 
+void table_impl::get_partition_assignment_async(
+    ignite_callback<std::shared_ptr<const partition_assignment>> callback) {
+    auto version = m_connection->get_assignment_version();
+
+    std::shared_ptr<const partition_assignment> assignment;
+    {
+        std::lock_guard<std::mutex> lock(m_assignment_mutex);
+        if (m_assignment && m_assignment_version == version
+            && std::chrono::steady_clock::now() - m_assignment_loaded < ASSIGNMENT_TTL)
+            assignment = m_assignment;
+    }
+
+    if (assignment) {
+        callback({std::move(assignment)});
+        return;
+    }
+
+    auto writer_func = [&](protocol::writer &writer) { writer.write(m_id); };
+
+    // The response is an array with the ID of the primary replica node of every partition, or nil if unknown. The
+    // array is empty while the table is not assigned to the nodes yet.
+    auto reader_func = [](protocol::reader &reader) -> std::shared_ptr<const partition_assignment> {
+        auto res = std::make_shared<partition_assignment>();
+        res->reserve(reader.read_array_size());
+        reader.read_array_raw([&res](const msgpack_object &object) {
+            auto &node = res->emplace_back();
+            if (object.type != MSGPACK_OBJECT_NIL)
+                node = protocol::unpack_object<std::string>(object);
+        });
+
+        return res;
+    };
+
+    m_connection->perform_request<std::shared_ptr<const partition_assignment>>(
+        client_operation::PARTITION_ASSIGNMENT_GET, writer_func, std::move(reader_func),
+        [self = shared_from_this(), version, callback = std::move(callback)](
+            ignite_result<std::shared_ptr<const partition_assignment>> &&res) {
+            if (res.has_value() && !res.value()->empty()) {
+                // Stored with the version the request started at, so a change during the request reloads it again.
+                std::lock_guard<std::mutex> lock(self->m_assignment_mutex);
+                self->m_assignment = res.value();
+                self->m_assignment_version = version;
+                self->m_assignment_loaded = std::chrono::steady_clock::now();
+            }
+
+            callback(std::move(res));
+        });
+}
+
+void table_impl::get_partition_async(const ignite_tuple &key, ignite_callback<std::int32_t> callback) {
+    get_latest_schema_async([self = shared_from_this(), key, callback = std::move(callback)](
+                                ignite_result<std::shared_ptr<schema>> &&sch_res) mutable {
+        if (sch_res.has_error()) {
+            callback({std::move(sch_res).error()});
+            return;
+        }
+
+        std::int32_t hash;
+        try {
+            hash = colocation_hash(*sch_res.value(), key);
+        } catch (const ignite_error &err) {
+            callback({ignite_error(err)});
+            return;
+        }
+
+        self->get_partition_assignment_async(
+            [hash, callback = std::move(callback)](ignite_result<std::shared_ptr<const partition_assignment>> &&res) {
+                if (res.has_error()) {
+                    callback({std::move(res).error()});
+                    return;
+                }
+
+                auto partitions = std::int32_t(res.value()->size());
+                if (!partitions) {
+                    callback({ignite_error("Partition assignment of the table is not available yet")});
+                    return;
+                }
+
+                callback(hash_calculator::get_partition(hash, partitions));
+            });
+    });
+}
+
+void table_impl::scan_async(const table_scan_options &options, ignite_callback<table_scan> callback) {
+    auto scan = std::make_shared<table_scan_impl>(
+        std::make_shared<sql_impl>(m_connection), make_scan_statement(m_name, options));
+
+    scan->start();
+    callback(table_scan(std::move(scan)));
+}
+
 } // namespace ignite::detail
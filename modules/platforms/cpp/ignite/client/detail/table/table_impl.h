@@ -20,20 +20,38 @@
 #include "ignite/client/detail/cluster_connection.h"
 #include "ignite/client/detail/table/schema.h"
 #include "ignite/client/table/ignite_tuple.h"
+#include "ignite/client/table/table_scan.h"
+#include "ignite/client/table/table_scan_options.h"
 #include "ignite/client/transaction/transaction.h"
 #include "ignite/common/uuid.h"
 
+#include <chrono>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace ignite::detail {
 
+/**
+ * Partition assignment: ID of the node holding the primary replica of every partition. Empty for the partitions with
+ * unknown primary replica.
+ */
+typedef std::vector<std::string> partition_assignment;
+
 /**
  * Table view implementation.
  */
 class table_impl : public std::enable_shared_from_this<table_impl> {
 public:
+    /** Time after which the cached partition assignment is loaded again. */
+    static constexpr std::chrono::seconds ASSIGNMENT_TTL{30};
+
+    /** Minimal age of the partition assignment to load it again because the routed node is not connected. */
+    static constexpr std::chrono::seconds ASSIGNMENT_MIN_AGE{1};
+
     // Deleted
     table_impl(table_impl &&) = delete;
     table_impl(const table_impl &) = delete;
@@ -91,6 +109,28 @@ public:
         });
     }
 
+    /**
+     * Gets the partition assignment to route the key reads with, according to the read mode. The assignment is
+     * @c nullptr if the reads are not routed or the assignment can not be loaded.
+     *
+     * @param handler Callback to pass to @c callback.
+     * @param callback Callback to call with the assignment.
+     */
+    template<typename T>
+    void with_read_assignment_async(ignite_callback<T> handler,
+        std::function<void(std::shared_ptr<const partition_assignment>, ignite_callback<T>)> callback) {
+        if (m_connection->get_configuration().get_read_mode() != read_mode::PRIMARY) {
+            callback(nullptr, std::move(handler));
+            return;
+        }
+
+        get_partition_assignment_async([handler = std::move(handler), callback = std::move(callback)](
+                                           ignite_result<std::shared_ptr<const partition_assignment>> &&res) mutable {
+            // Reads do not fail because of the assignment, they are just not routed.
+            callback(res.has_value() ? res.value() : nullptr, std::move(handler));
+        });
+    }
+
     /**
      * Gets a record by key asynchronously.
      *
@@ -273,6 +313,33 @@ public:
     void remove_all_exact_async(
         transaction *tx, std::vector<ignite_tuple> records, ignite_callback<std::vector<ignite_tuple>> callback);
 
+    /**
+     * Gets the partition assignment. The assignment is cached until the assignment version of the connection changes,
+     * the assignment gets older than ASSIGNMENT_TTL, or it is dropped by drop_assignment(). An assignment that is not
+     * available yet is not cached.
+     *
+     * @param callback Callback.
+     */
+    void get_partition_assignment_async(ignite_callback<std::shared_ptr<const partition_assignment>> callback);
+
+    /**
+     * Gets the partition of the key asynchronously.
+     * See table::get_partition_async() for details.
+     *
+     * @param key Key.
+     * @param callback Callback.
+     */
+    void get_partition_async(const ignite_tuple &key, ignite_callback<std::int32_t> callback);
+
+    /**
+     * Scans the whole table asynchronously.
+     * See table::scan_async() for details.
+     *
+     * @param options Scan options.
+     * @param callback Callback.
+     */
+    void scan_async(const table_scan_options &options, ignite_callback<table_scan> callback);
+
 private:
     /**
      * Load latest schema from server asynchronously.
@@ -309,6 +376,35 @@ private:
         return it->second;
     }
 
+    /**
+     * Get the node to read the key from: the primary replica of the key partition. If the node is not connected, the
+     * assignment is dropped, so the next read loads it again.
+     *
+     * @param assignment Partition assignment. Can be @c nullptr.
+     * @param sch Schema.
+     * @param key Key.
+     * @return Node ID, or an empty string if the read can be sent to any node.
+     */
+    std::string get_read_node(const partition_assignment *assignment, const schema &sch, const ignite_tuple &key);
+
+    /**
+     * Drop the cached partition assignment, if it is still the cached one and is older than ASSIGNMENT_MIN_AGE.
+     *
+     * @param assignment Partition assignment.
+     */
+    void drop_assignment(const partition_assignment *assignment);
+
+    /**
+     * Gets multiple records by keys from the node.
+     *
+     * @param sch Schema.
+     * @param keys Keys.
+     * @param node_id ID of the node to read from, or an empty string for any node.
+     * @param callback Callback.
+     */
+    void get_all_from_node(const schema &sch, std::shared_ptr<std::vector<ignite_tuple>> keys,
+        const std::string &node_id, ignite_callback<std::vector<std::optional<ignite_tuple>>> callback);
+
     /**
      * Read schema version from reader and try and retrieve schema instance for it.
      *
@@ -340,6 +436,18 @@ private:
 
     /** Schemas. */
     std::unordered_map<int32_t, std::shared_ptr<schema>> m_schemas;
+
+    /** Partition assignment mutex. */
+    std::mutex m_assignment_mutex;
+
+    /** Partition assignment. */
+    std::shared_ptr<const partition_assignment> m_assignment;
+
+    /** Assignment version of the connection the partition assignment was loaded at. */
+    std::uint64_t m_assignment_version{0};
+
+    /** Time the partition assignment was loaded at. */
+    std::chrono::steady_clock::time_point m_assignment_loaded;
 };
 
 } // namespace ignite::detail
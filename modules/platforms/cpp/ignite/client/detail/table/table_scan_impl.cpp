@@ -0,0 +1,171 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/client/detail/table/table_scan_impl.h"
+
+#include "ignite/common/ignite_error.h"
+
+namespace ignite::detail {
+
+void table_scan_impl::start() {
+    try {
+        m_sql->execute_cursor_async(m_statement, {},
+            [self_weak = weak_from_this()](ignite_result<std::shared_ptr<result_set_impl>> &&res) {
+                if (auto self = self_weak.lock())
+                    self->on_open(std::move(res));
+            });
+    } catch (ignite_error &err) {
+        on_open({std::move(err)});
+    }
+}
+
+bool table_scan_impl::has_more_pages() {
+    std::shared_ptr<result_set_impl> cursor;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_closed)
+            return false;
+
+        if (m_opening || m_error || m_first_pending)
+            return true;
+
+        cursor = m_cursor;
+    }
+
+    return cursor && cursor->has_more_pages();
+}
+
+void table_scan_impl::next_page_async(ignite_callback<std::optional<scan_page>> callback) {
+    std::shared_ptr<result_set_impl> cursor;
+    std::optional<ignite_result<std::optional<scan_page>>> res;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_closed)
+            throw ignite_error("Table scan is closed");
+
+        if (m_waiter)
+            throw ignite_error("The next page is already being waited for");
+
+        if (m_opening) {
+            m_waiter = std::move(callback);
+            return;
+        }
+
+        if (m_error || m_first_pending)
+            res = take_first_locked();
+        else
+            cursor = m_cursor;
+    }
+
+    if (res) {
+        callback(std::move(*res));
+        return;
+    }
+
+    if (!cursor)
+        throw ignite_error("There are no more pages");
+
+    // The cursor throws if there are no more pages or the previous one is still being fetched.
+    cursor->fetch_next_page_async([cursor, callback = std::move(callback)](ignite_result<void> &&res) {
+        if (res.has_error()) {
+            callback({std::move(res).error()});
+            return;
+        }
+
+        callback(take_page(*cursor));
+    });
+}
+
+void table_scan_impl::close_async(ignite_callback<void> callback) {
+    std::shared_ptr<result_set_impl> cursor;
+    ignite_callback<std::optional<scan_page>> waiter;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_closed = true;
+        m_first_pending = false;
+        m_error.reset();
+        std::swap(cursor, m_cursor);
+        std::swap(waiter, m_waiter);
+    }
+
+    if (waiter)
+        waiter({ignite_error("Table scan is closed")});
+
+    // The cursor that is still being opened is closed once dropped.
+    if (!cursor) {
+        callback({});
+        return;
+    }
+
+    cursor->close_async(std::move(callback));
+}
+
+void table_scan_impl::on_open(ignite_result<std::shared_ptr<result_set_impl>> &&res) {
+    std::shared_ptr<result_set_impl> cursor;
+    ignite_callback<std::optional<scan_page>> waiter;
+    ignite_result<std::optional<scan_page>> waiter_res;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_opening = false;
+        if (m_closed)
+            return;
+
+        if (res.has_error()) {
+            m_error = std::move(res).error();
+        } else {
+            m_cursor = std::move(res).value();
+            m_first_pending = true;
+            cursor = m_cursor;
+        }
+
+        if (m_waiter) {
+            std::swap(waiter, m_waiter);
+            waiter_res = take_first_locked();
+        }
+    }
+
+    if (waiter)
+        waiter(std::move(waiter_res));
+
+    if (cursor)
+        cursor->prefetch();
+}
+
+ignite_result<std::optional<scan_page>> table_scan_impl::take_first_locked() {
+    if (m_error) {
+        auto err = std::move(*m_error);
+        m_error.reset();
+        return {std::move(err)};
+    }
+
+    m_first_pending = false;
+    return {take_page(*m_cursor)};
+}
+
+std::optional<scan_page> table_scan_impl::take_page(result_set_impl &cursor) {
+    auto rows = cursor.take_current_page();
+    if (rows.empty())
+        return std::nullopt;
+
+    return scan_page{std::move(rows)};
+}
+
+} // namespace ignite::detail
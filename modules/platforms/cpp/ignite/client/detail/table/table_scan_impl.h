@@ -0,0 +1,136 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/detail/sql/result_set_impl.h"
+#include "ignite/client/detail/sql/sql_impl.h"
+#include "ignite/client/sql/sql_statement.h"
+#include "ignite/client/table/table_scan.h"
+
+#include "ignite/common/ignite_result.h"
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace ignite::detail {
+
+/**
+ * Table scan implementation.
+ *
+ * The table is read with a single SQL cursor, which prefetches the pages up to the window of the scan.
+ */
+class table_scan_impl : public std::enable_shared_from_this<table_scan_impl> {
+public:
+    // Deleted
+    table_scan_impl() = delete;
+    table_scan_impl(table_scan_impl &&) = delete;
+    table_scan_impl(const table_scan_impl &) = delete;
+    table_scan_impl &operator=(table_scan_impl &&) = delete;
+    table_scan_impl &operator=(const table_scan_impl &) = delete;
+
+    /**
+     * Constructor.
+     *
+     * @param sql SQL implementation.
+     * @param statement Statement reading the whole table.
+     */
+    table_scan_impl(std::shared_ptr<sql_impl> sql, sql_statement statement)
+        : m_sql(std::move(sql))
+        , m_statement(std::move(statement)) {}
+
+    /**
+     * Start the scan.
+     */
+    void start();
+
+    /**
+     * Check whether there can be more pages.
+     *
+     * @return @c false if the scan is complete.
+     */
+    [[nodiscard]] bool has_more_pages();
+
+    /**
+     * Get the next page.
+     *
+     * @param callback Callback.
+     * @throw ignite_error if the scan is complete or closed, or the previous page is still being waited for.
+     */
+    void next_page_async(ignite_callback<std::optional<scan_page>> callback);
+
+    /**
+     * Close the scan.
+     *
+     * @param callback Callback.
+     */
+    void close_async(ignite_callback<void> callback);
+
+private:
+    /**
+     * Handle the opened cursor.
+     *
+     * @param res Cursor or error.
+     */
+    void on_open(ignite_result<std::shared_ptr<result_set_impl>> &&res);
+
+    /**
+     * Take the first page, or the error of the cursor opening. Should be called with the lock held.
+     *
+     * @return Page or error.
+     */
+    ignite_result<std::optional<scan_page>> take_first_locked();
+
+    /**
+     * Make page of the rows of the current page of the cursor.
+     *
+     * @param cursor Cursor.
+     * @return Page, or @c std::nullopt if the page is empty.
+     */
+    static std::optional<scan_page> take_page(result_set_impl &cursor);
+
+    /** SQL implementation. */
+    std::shared_ptr<sql_impl> m_sql;
+
+    /** Statement reading the whole table. */
+    const sql_statement m_statement;
+
+    /** Mutex. */
+    std::mutex m_mutex;
+
+    /** Whether the cursor is being opened. */
+    bool m_opening{true};
+
+    /** Cursor. Set once opened. */
+    std::shared_ptr<result_set_impl> m_cursor;
+
+    /** Whether the first page of the cursor, received with the query response, is not consumed yet. */
+    bool m_first_pending{false};
+
+    /** Error of the cursor opening, until consumed. */
+    std::optional<ignite_error> m_error;
+
+    /** Whether the scan is closed. */
+    bool m_closed{false};
+
+    /** Callback of the consumer waiting for the cursor to open. */
+    ignite_callback<std::optional<scan_page>> m_waiter;
+};
+
+} // namespace ignite::detail
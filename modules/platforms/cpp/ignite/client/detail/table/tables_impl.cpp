@@ -16,13 +16,109 @@
  */
 
 #include "ignite/client/detail/table/tables_impl.h"
+#include "ignite/client/detail/table/name_utils.h"
 
 #include <ignite/protocol/reader.h>
 #include <ignite/protocol/writer.h>
 
 namespace ignite::detail {
 
+/**
+ * Warm-up that completes once all of its steps complete, with the first error, if any.
+ */
+class warmup_latch {
+public:
+    /**
+     * Constructor.
+     *
+     * @param steps Initial number of steps.
+     * @param callback Callback to call once all the steps complete.
+     */
+    warmup_latch(std::size_t steps, ignite_callback<void> callback)
+        : m_steps(steps)
+        , m_callback(std::move(callback)) {}
+
+    /**
+     * Add a step. Should be called by a step that is not complete yet.
+     */
+    void add_step() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_steps;
+    }
+
+    /**
+     * Complete a step.
+     *
+     * @param res Result of the step.
+     */
+    void complete(ignite_result<void> &&res) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (res.has_error() && !m_error)
+                m_error = std::move(res).error();
+
+            if (--m_steps)
+                return;
+        }
+
+        if (m_error)
+            m_callback({std::move(*m_error)});
+        else
+            m_callback({});
+    }
+
+private:
+    /** Mutex. */
+    std::mutex m_mutex;
+
+    /** Number of steps that are not complete yet. */
+    std::size_t m_steps;
+
+    /** First error. */
+    std::optional<ignite_error> m_error;
+
+    /** Callback. */
+    ignite_callback<void> m_callback;
+};
+
+namespace {
+
+/**
+ * Get the key of a preloaded table.
+ *
+ * @param name Table name.
+ * @return Normalized name, or @c std::nullopt if the name is malformed, so it is left to the server to report.
+ */
+std::optional<std::string> preloaded_key(std::string_view name) {
+    try {
+        return normalize_qualified_name(name);
+    } catch (const ignite_error &) {
+        return std::nullopt;
+    }
+}
+
+} // namespace
+
 void tables_impl::get_table_async(std::string_view name, ignite_callback<std::optional<table>> callback) {
+    // A preloaded table is only handed out once: the table could be dropped or re-created after that, so the
+    // subsequent lookups go to the server.
+    if (auto key = preloaded_key(name)) {
+        std::shared_ptr<table_impl> impl;
+        {
+            std::lock_guard<std::mutex> lock(m_preloaded_mutex);
+            auto it = m_preloaded.find(*key);
+            if (it != m_preloaded.end()) {
+                impl = std::move(it->second);
+                m_preloaded.erase(it);
+            }
+        }
+
+        if (impl) {
+            callback(std::make_optional(table(std::move(impl))));
+            return;
+        }
+    }
+
     auto writer_func = [&name](protocol::writer &writer) { writer.write(name); };
 
     auto reader_func = [name, conn = m_connection](protocol::reader &reader) mutable -> std::optional<table> {
@@ -60,4 +156,53 @@ void tables_impl::get_tables_async(ignite_callback<std::vector<table>> callback)
         client_operation::TABLES_GET, std::move(reader_func), std::move(callback));
 }
 
+void tables_impl::preload_async(const std::vector<std::string> &names, ignite_callback<void> callback) {
+    if (names.empty()) {
+        callback({});
+        return;
+    }
+
+    bool load_assignment = m_connection->get_configuration().get_read_mode() == read_mode::PRIMARY;
+    auto latch = std::make_shared<warmup_latch>(names.size(), std::move(callback));
+
+    // Tables are requested at once, and the schema of every table is requested as soon as the table is resolved.
+    for (const auto &name : names) {
+        get_table_async(name,
+            [self = shared_from_this(), name, load_assignment, latch](
+                ignite_result<std::optional<table>> &&res) {
+                if (res.has_error()) {
+                    latch->complete({std::move(res).error()});
+                    return;
+                }
+
+                if (!res.value()) {
+                    latch->complete({ignite_error("Table does not exist: '" + name + "'")});
+                    return;
+                }
+
+                auto impl = res.value()->m_impl;
+                if (load_assignment) {
+                    latch->add_step();
+                    impl->get_partition_assignment_async(
+                        [latch](ignite_result<std::shared_ptr<const partition_assignment>> &&res) {
+                            latch->complete(res.has_error() ? ignite_result<void>{std::move(res).error()}
+                                                            : ignite_result<void>{});
+                        });
+                }
+
+                impl->get_latest_schema_async(
+                    [self, name, impl, latch](ignite_result<std::shared_ptr<schema>> &&res) {
+                        auto key = preloaded_key(name);
+                        if (res.has_value() && key) {
+                            std::lock_guard<std::mutex> lock(self->m_preloaded_mutex);
+                            self->m_preloaded.insert_or_assign(std::move(*key), impl);
+                        }
+
+                        latch->complete(res.has_error() ? ignite_result<void>{std::move(res).error()}
+                                                        : ignite_result<void>{});
+                    });
+            });
+    }
+}
+
 } // namespace ignite::detail
@@ -23,13 +23,17 @@
 
 #include <future>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace ignite::detail {
 
 /**
  * Table management.
  */
-class tables_impl {
+class tables_impl : public std::enable_shared_from_this<tables_impl> {
 public:
     // Deleted
     tables_impl(tables_impl &&) = delete;
@@ -64,9 +68,25 @@ public:
      */
     void get_tables_async(ignite_callback<std::vector<table>> callback);
 
+    /**
+     * Loads the tables and their latest schemas in parallel, and keeps them, so the first get_table_async() for
+     * each of them returns it without a request. The names are matched in the normalized form, so @c tbl1 and
+     * @c "TBL1" are the same table. With read_mode::PRIMARY, the partition assignments are loaded as well.
+     *
+     * @param names Table names.
+     * @param callback Callback to be called once all the tables are loaded. Fails if any of the tables does not exist.
+     */
+    void preload_async(const std::vector<std::string> &names, ignite_callback<void> callback);
+
 private:
     /** Cluster connection. */
     std::shared_ptr<cluster_connection> m_connection;
+
+    /** Preloaded tables mutex. */
+    std::mutex m_preloaded_mutex;
+
+    /** Preloaded tables by normalized name, each removed once it is returned. */
+    std::unordered_map<std::string, std::shared_ptr<table_impl>> m_preloaded;
 };
 
 } // namespace ignite::detail
@@ -0,0 +1,131 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/detail/cluster_connection.h"
+#include "ignite/client/detail/table/schema.h"
+#include "ignite/client/detail/thread_pool.h"
+#include "ignite/client/primitive.h"
+#include "ignite/client/table/ignite_tuple.h"
+#include "ignite/protocol/reader.h"
+#include "ignite/protocol/writer.h"
+#include "ignite/schema/binary_tuple_builder.h"
+
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Options of batch operations processing.
+ */
+struct batch_options {
+    /** Whether to allocate the tuples of a response from a memory arena. */
+    bool use_arena{false};
+
+    /** Pool to split the rows between, or @c nullptr. */
+    thread_pool *pool{nullptr};
+};
+
+/**
+ * Get options of batch operations processing.
+ *
+ * @param connection Cluster connection.
+ * @return Options.
+ */
+batch_options get_batch_options(const cluster_connection &connection);
+
+/**
+ * Claim space for the column.
+ *
+ * @param builder Binary tuple builder.
+ * @param typ Column type.
+ * @param value Value.
+ */
+void claim_column(binary_tuple_builder &builder, ignite_type typ, const primitive &value);
+
+/**
+ * Append column value to binary tuple.
+ *
+ * @param builder Binary tuple builder.
+ * @param typ Column type.
+ * @param value Value.
+ */
+void append_column(binary_tuple_builder &builder, ignite_type typ, const primitive &value);
+
+/**
+ * Compute the colocation hash of the tuple, the same way as the server does.
+ *
+ * @param sch Schema.
+ * @param tuple Tuple. Should contain at least the key columns. Missing columns are treated as null.
+ * @return Colocation hash.
+ *
+ * @throw ignite_error if a colocation column is of an unsupported type or is a binary_source.
+ */
+std::int32_t colocation_hash(const schema &sch, const ignite_tuple &tuple);
+
+/**
+ * Compute the colocation hash of the binary tuple, the same way as the server does.
+ *
+ * @param sch Schema.
+ * @param tuple Binary tuple packed using the schema.
+ * @param key_only Whether the binary tuple holds only the key columns.
+ * @return Colocation hash.
+ *
+ * @throw ignite_error if a colocation column is of an unsupported type.
+ */
+std::int32_t colocation_hash(const schema &sch, bytes_view tuple, bool key_only);
+
+/**
+ * Write tuples using table schema and writer: the number of tuples followed by the no-value set and a binary tuple
+ * for each of them.
+ *
+ * @param writer Writer.
+ * @param sch Schema.
+ * @param tuples Tuples.
+ * @param key_only Should only key fields be written or not.
+ * @param pool Pool to split the rows between. Can be @c nullptr.
+ */
+void write_tuples(protocol::writer &writer, const schema &sch, const std::vector<ignite_tuple> &tuples, bool key_only,
+    thread_pool *pool);
+
+/**
+ * Read tuples: the number of tuples followed by a binary tuple for each of them.
+ *
+ * @param reader Reader.
+ * @param sch Schema.
+ * @param key_only Should only key fields be read or not.
+ * @param options Batch options.
+ * @return Tuples.
+ */
+std::vector<ignite_tuple> read_tuples(
+    protocol::reader &reader, const schema *sch, bool key_only, const batch_options &options);
+
+/**
+ * Read tuples, the number of which is already known: a binary tuple for each of them.
+ *
+ * @param reader Reader.
+ * @param count Number of tuples.
+ * @param sch Schema.
+ * @param key_only Should only key fields be read or not.
+ * @param options Batch options.
+ * @return Tuples.
+ */
+std::vector<ignite_tuple> read_tuples(protocol::reader &reader, std::size_t count, const schema *sch, bool key_only,
+    const batch_options &options);
+
+} // namespace ignite::detail
@@ -0,0 +1,217 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tuple_codec.h"
+
+#include "ignite/protocol/buffer_adapter.h"
+#include "ignite/schema/binary_tuple_parser.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace ignite;
+using namespace ignite::detail;
+
+namespace {
+
+/** Number of rows, enough to split them between all the threads of the pool. */
+constexpr std::size_t ROWS = 3000;
+
+/**
+ * Make a schema with columns of all the supported types.
+ *
+ * @return Schema.
+ */
+schema make_schema() {
+    std::vector<column> columns{
+        {"KEY", ignite_type::INT64, false, true},
+        {"I8", ignite_type::INT8, true},
+        {"I16", ignite_type::INT16, true},
+        {"I32", ignite_type::INT32, true},
+        {"F", ignite_type::FLOAT, true},
+        {"D", ignite_type::DOUBLE, true},
+        {"ID", ignite_type::UUID, true},
+        {"STR", ignite_type::STRING, true},
+        {"BIN", ignite_type::BINARY, true},
+    };
+
+    return {1, 1, std::move(columns)};
+}
+
+/**
+ * Make tuples with distinct values and nulls.
+ *
+ * @return Tuples.
+ */
+std::vector<ignite_tuple> make_tuples() {
+    std::vector<ignite_tuple> tuples;
+    tuples.reserve(ROWS);
+
+    for (std::size_t i = 0; i < ROWS; ++i) {
+        auto val = std::int32_t(i);
+        tuples.push_back({
+            {"KEY", std::int64_t(i)},
+            {"I8", std::int8_t(i)},
+            {"I16", std::int16_t(i)},
+            {"I32", i % 7 ? primitive(val) : primitive{}},
+            {"F", float(i) / 3},
+            {"D", double(i) / 7},
+            {"ID", uuid(val, -val)},
+            {"STR", i % 5 ? primitive("s-" + std::to_string(i)) : primitive{}},
+            {"BIN", std::vector<std::byte>(i % 17, std::byte(i))},
+        });
+    }
+
+    return tuples;
+}
+
+/**
+ * Write tuples.
+ *
+ * @param sch Schema.
+ * @param tuples Tuples.
+ * @param pool Thread pool or @c nullptr.
+ * @return Written data.
+ */
+std::vector<std::byte> write(const schema &sch, const std::vector<ignite_tuple> &tuples, thread_pool *pool) {
+    std::vector<std::byte> data;
+    protocol::buffer_adapter buffer(data);
+    protocol::writer writer(buffer);
+
+    write_tuples(writer, sch, tuples, false, pool);
+
+    return data;
+}
+
+/**
+ * Encode tuples the way the server returns them: the number of tuples followed by a binary tuple for each of them.
+ *
+ * @param sch Schema.
+ * @param tuples Tuples.
+ * @return Encoded data.
+ */
+std::vector<std::byte> encode_response(const schema &sch, const std::vector<ignite_tuple> &tuples) {
+    std::vector<std::byte> data;
+    protocol::buffer_adapter buffer(data);
+    protocol::writer writer(buffer);
+
+    writer.write(std::int32_t(tuples.size()));
+    for (const auto &tuple : tuples) {
+        binary_tuple_builder builder{std::int32_t(sch.columns.size())};
+        builder.start();
+        for (const auto &col : sch.columns)
+            claim_column(builder, col.type, tuple.get(col.name));
+
+        builder.layout();
+        for (const auto &col : sch.columns)
+            append_column(builder, col.type, tuple.get(col.name));
+
+        writer.write_binary(builder.build());
+    }
+
+    return data;
+}
+
+} // namespace
+
+TEST(tuple_codec, null_values) {
+    const std::vector<std::pair<ignite_type, primitive>> columns{
+        {ignite_type::INT32, primitive(42)},
+        {ignite_type::INT32, primitive{}},
+        {ignite_type::STRING, primitive(nullptr)},
+        {ignite_type::BINARY, primitive{}},
+        {ignite_type::UUID, primitive{}},
+        {ignite_type::STRING, primitive("abc")},
+    };
+
+    binary_tuple_builder builder{std::int32_t(columns.size())};
+    builder.start();
+    for (const auto &[typ, value] : columns)
+        claim_column(builder, typ, value);
+
+    builder.layout();
+    for (const auto &[typ, value] : columns)
+        append_column(builder, typ, value);
+
+    auto data = builder.build();
+
+    binary_tuple_parser parser{std::int32_t(columns.size()), data};
+    EXPECT_EQ(42, binary_tuple_parser::get_int32(parser.get_next().value()));
+    EXPECT_FALSE(parser.get_next().has_value());
+    EXPECT_FALSE(parser.get_next().has_value());
+    EXPECT_FALSE(parser.get_next().has_value());
+    EXPECT_FALSE(parser.get_next().has_value());
+
+    auto str = parser.get_next().value();
+    EXPECT_EQ("abc", std::string(reinterpret_cast<const char *>(str.data()), str.size()));
+}
+
+TEST(tuple_codec, null_values_of_unsupported_types) {
+    binary_tuple_builder builder{1};
+    builder.start();
+    claim_column(builder, ignite_type::DATE, primitive{});
+    builder.layout();
+    append_column(builder, ignite_type::DATE, primitive{});
+
+    auto data = builder.build();
+
+    binary_tuple_parser parser{1, data};
+    EXPECT_FALSE(parser.get_next().has_value());
+}
+
+TEST(tuple_codec, type_mismatch) {
+    binary_tuple_builder builder{1};
+    builder.start();
+    EXPECT_THROW(claim_column(builder, ignite_type::INT64, primitive(42)), ignite_error);
+}
+
+TEST(tuple_codec, parallel_write_is_identical_to_serial) {
+    auto sch = make_schema();
+    auto tuples = make_tuples();
+    thread_pool pool{3};
+
+    auto serial = write(sch, tuples, nullptr);
+    auto parallel = write(sch, tuples, &pool);
+
+    EXPECT_EQ(serial, parallel);
+}
+
+TEST(tuple_codec, parallel_read_is_identical_to_serial) {
+    auto sch = make_schema();
+    auto tuples = make_tuples();
+    auto expected = write(sch, tuples, nullptr);
+    auto response = encode_response(sch, tuples);
+    thread_pool pool{3};
+
+    for (bool use_arena : {false, true}) {
+        SCOPED_TRACE("use_arena=" + std::to_string(use_arena));
+
+        protocol::reader serial_reader{response};
+        auto serial = read_tuples(serial_reader, &sch, false, {use_arena, nullptr});
+
+        protocol::reader parallel_reader{response};
+        auto parallel = read_tuples(parallel_reader, &sch, false, {use_arena, &pool});
+
+        ASSERT_EQ(ROWS, serial.size());
+        ASSERT_EQ(ROWS, parallel.size());
+
+        EXPECT_EQ(expected, write(sch, serial, nullptr));
+        EXPECT_EQ(expected, write(sch, parallel, nullptr));
+    }
+}
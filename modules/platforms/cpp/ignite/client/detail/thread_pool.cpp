@@ -0,0 +1,155 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace ignite::detail {
+
+namespace {
+
+/**
+ * State of a parallel_for() call shared with the pool threads.
+ */
+struct parallel_job {
+    /**
+     * Constructor.
+     *
+     * @param count Number of elements.
+     * @param segments Number of segments.
+     * @param func Segment function.
+     */
+    parallel_job(std::size_t count, std::size_t segments,
+        const std::function<void(std::size_t, std::size_t, std::size_t)> &func)
+        : count(count)
+        , segments(segments)
+        , func(func) {}
+
+    /**
+     * Process segments until none are left.
+     */
+    void process() {
+        while (true) {
+            auto segment = next.fetch_add(1);
+            if (segment >= segments)
+                return;
+
+            try {
+                func(segment, count * segment / segments, count * (segment + 1) / segments);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (++done == segments)
+                condition.notify_all();
+        }
+    }
+
+    /** Number of elements. */
+    const std::size_t count;
+
+    /** Number of segments. */
+    const std::size_t segments;
+
+    /** Segment function. Owned by the caller, which waits until all the segments are processed. */
+    const std::function<void(std::size_t, std::size_t, std::size_t)> &func;
+
+    /** Next segment to process. */
+    std::atomic_size_t next{0};
+
+    /** Mutex. */
+    std::mutex mutex;
+
+    /** Condition variable. */
+    std::condition_variable condition;
+
+    /** Number of processed segments. */
+    std::size_t done{0};
+
+    /** First error. */
+    std::exception_ptr error;
+};
+
+} // namespace
+
+thread_pool::thread_pool(std::uint32_t threads) {
+    m_threads.reserve(threads);
+    for (std::uint32_t i = 0; i < threads; ++i)
+        m_threads.emplace_back([this] { run(); });
+}
+
+thread_pool::~thread_pool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+
+    for (auto &thread : m_threads)
+        thread.join();
+}
+
+void thread_pool::parallel_for(std::size_t count, std::size_t segments,
+    const std::function<void(std::size_t segment, std::size_t begin, std::size_t end)> &func) {
+    if (!segments)
+        return;
+
+    auto job = std::make_shared<parallel_job>(count, segments, func);
+
+    auto helpers = std::min(std::size_t(m_threads.size()), segments - 1);
+    if (helpers) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (std::size_t i = 0; i < helpers; ++i)
+                m_tasks.emplace([job] { job->process(); });
+        }
+        m_condition.notify_all();
+    }
+
+    job->process();
+
+    std::unique_lock<std::mutex> lock(job->mutex);
+    job->condition.wait(lock, [&job] { return job->done == job->segments; });
+
+    if (job->error)
+        std::rethrow_exception(job->error);
+}
+
+void thread_pool::run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_condition.wait(lock, [this] { return m_stopping || !m_tasks.empty(); });
+        if (m_stopping)
+            return;
+
+        auto task = std::move(m_tasks.front());
+        m_tasks.pop();
+
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+
+} // namespace ignite::detail
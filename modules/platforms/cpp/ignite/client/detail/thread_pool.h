@@ -0,0 +1,96 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Fixed-size pool of threads that split work with the calling thread.
+ */
+class thread_pool {
+public:
+    // Deleted
+    thread_pool(const thread_pool &) = delete;
+    thread_pool &operator=(const thread_pool &) = delete;
+
+    /**
+     * Constructor. Starts the threads.
+     *
+     * @param threads Number of threads.
+     */
+    explicit thread_pool(std::uint32_t threads);
+
+    /**
+     * Destructor. Waits for the threads to finish.
+     */
+    ~thread_pool();
+
+    /**
+     * Get number of threads.
+     *
+     * @return Number of threads.
+     */
+    [[nodiscard]] std::uint32_t size() const noexcept { return std::uint32_t(m_threads.size()); }
+
+    /**
+     * Split the range into segments of about the same size and process them on the pool threads and on the calling
+     * thread. Blocks until all the segments are processed.
+     *
+     * The calling thread processes the segments too, so the call completes even if the pool threads are busy.
+     *
+     * @param count Number of elements in the range.
+     * @param segments Number of segments.
+     * @param func Function processing the segment. Takes the segment index and the element range.
+     *
+     * @throw Rethrows the first exception thrown by the function.
+     */
+    void parallel_for(std::size_t count, std::size_t segments,
+        const std::function<void(std::size_t segment, std::size_t begin, std::size_t end)> &func);
+
+private:
+    /**
+     * Run the thread loop.
+     */
+    void run();
+
+    /** Stopping flag. */
+    bool m_stopping{false};
+
+    /** Mutex. */
+    std::mutex m_mutex;
+
+    /** Condition variable. */
+    std::condition_variable m_condition;
+
+    /** Tasks. */
+    std::queue<std::function<void()>> m_tasks;
+
+    /** Threads. */
+    std::vector<std::thread> m_threads;
+};
+
+} // namespace ignite::detail
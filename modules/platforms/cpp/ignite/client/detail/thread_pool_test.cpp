@@ -0,0 +1,147 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "thread_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ignite::detail;
+
+namespace {
+
+/**
+ * Process the range and check that every element and every segment is processed exactly once.
+ *
+ * @param pool Thread pool.
+ * @param count Number of elements.
+ * @param segments Number of segments.
+ */
+void check_coverage(thread_pool &pool, std::size_t count, std::size_t segments) {
+    std::vector<std::atomic_int> elements(count);
+    std::vector<std::atomic_int> visited(segments);
+
+    pool.parallel_for(count, segments, [&](std::size_t segment, std::size_t begin, std::size_t end) {
+        ASSERT_LT(segment, segments);
+        ASSERT_LE(begin, end);
+        ASSERT_LE(end, count);
+
+        ++visited[segment];
+        for (auto i = begin; i < end; ++i)
+            ++elements[i];
+    });
+
+    for (auto &val : visited)
+        EXPECT_EQ(1, val.load());
+
+    for (auto &val : elements)
+        EXPECT_EQ(1, val.load());
+}
+
+} // namespace
+
+TEST(thread_pool, segment_coverage) {
+    thread_pool pool{3};
+
+    check_coverage(pool, 1000, 4);
+    check_coverage(pool, 1000, 7);
+    check_coverage(pool, 1001, 1);
+    check_coverage(pool, 3, 8);
+    check_coverage(pool, 0, 2);
+}
+
+TEST(thread_pool, no_segments) {
+    thread_pool pool{2};
+
+    bool called = false;
+    pool.parallel_for(10, 0, [&](std::size_t, std::size_t, std::size_t) { called = true; });
+
+    EXPECT_FALSE(called);
+}
+
+TEST(thread_pool, no_threads) {
+    thread_pool pool{0};
+
+    std::set<std::thread::id> threads;
+    check_coverage(pool, 100, 4);
+    pool.parallel_for(
+        100, 4, [&](std::size_t, std::size_t, std::size_t) { threads.insert(std::this_thread::get_id()); });
+
+    EXPECT_EQ(std::set<std::thread::id>{std::this_thread::get_id()}, threads);
+}
+
+TEST(thread_pool, exception_propagation) {
+    thread_pool pool{3};
+
+    std::atomic_int processed{0};
+    auto func = [&](std::size_t segment, std::size_t, std::size_t) {
+        ++processed;
+        if (segment == 2)
+            throw std::runtime_error("segment failed");
+    };
+
+    EXPECT_THROW(pool.parallel_for(100, 8, func), std::runtime_error);
+
+    // The other segments are still processed, and the pool keeps working.
+    EXPECT_EQ(8, processed.load());
+    check_coverage(pool, 100, 8);
+}
+
+TEST(thread_pool, busy_pool) {
+    thread_pool pool{1};
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    int entered = 0;
+    bool released = false;
+
+    // Occupy the only pool thread and the thread that started the job.
+    std::thread blocker([&] {
+        pool.parallel_for(2, 2, [&](std::size_t, std::size_t, std::size_t) {
+            std::unique_lock<std::mutex> lock(mutex);
+            ++entered;
+            condition.notify_all();
+            condition.wait(lock, [&] { return released; });
+        });
+    });
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&] { return entered == 2; });
+    }
+
+    // The calling thread processes all the segments itself.
+    std::set<std::thread::id> threads;
+    pool.parallel_for(
+        100, 4, [&](std::size_t, std::size_t, std::size_t) { threads.insert(std::this_thread::get_id()); });
+
+    EXPECT_EQ(std::set<std::thread::id>{std::this_thread::get_id()}, threads);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        released = true;
+    }
+    condition.notify_all();
+    blocker.join();
+}
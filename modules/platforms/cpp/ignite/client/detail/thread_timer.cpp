@@ -0,0 +1,130 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "thread_timer.h"
+
+#include <algorithm>
+
+namespace ignite::detail {
+
+thread_timer::~thread_timer() {
+    stop();
+}
+
+std::shared_ptr<thread_timer> thread_timer::start(std::function<void(ignite_error &&)> error_handler) {
+    std::shared_ptr<thread_timer> res{new thread_timer(std::move(error_handler))};
+
+    // The thread keeps the timer alive, so the timer can be safely released from a callback.
+    res->m_thread = std::thread([res] { res->run(); });
+
+    return res;
+}
+
+std::shared_ptr<thread_timer> thread_timer::create(std::function<void(ignite_error &&)> error_handler) {
+    return std::shared_ptr<thread_timer>{new thread_timer(std::move(error_handler))};
+}
+
+void thread_timer::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_stopping = true;
+        m_events = {};
+    }
+    m_condition.notify_one();
+
+    if (!m_thread.joinable())
+        return;
+
+    // Stop can be called from a callback.
+    if (m_thread.get_id() == std::this_thread::get_id())
+        m_thread.detach();
+    else
+        m_thread.join();
+}
+
+void thread_timer::add(std::chrono::milliseconds timeout, std::function<void()> callback) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stopping)
+            return;
+
+        m_events.push({std::chrono::steady_clock::now() + timeout, std::move(callback)});
+    }
+    m_condition.notify_one();
+}
+
+void thread_timer::run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopping) {
+        if (m_events.empty()) {
+            m_condition.wait(lock);
+            continue;
+        }
+
+        auto timeout = m_events.top().timeout;
+        if (std::chrono::steady_clock::now() < timeout) {
+            m_condition.wait_until(lock, timeout);
+            continue;
+        }
+
+        auto callback = m_events.top().callback;
+        m_events.pop();
+
+        lock.unlock();
+        invoke(callback);
+        lock.lock();
+    }
+}
+
+std::optional<std::chrono::milliseconds> thread_timer::get_timeout() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_stopping || m_events.empty())
+        return std::nullopt;
+
+    auto timeout = m_events.top().timeout - std::chrono::steady_clock::now();
+
+    return std::max(std::chrono::ceil<std::chrono::milliseconds>(timeout), std::chrono::milliseconds(0));
+}
+
+void thread_timer::process() {
+    auto now = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopping && !m_events.empty() && m_events.top().timeout <= now) {
+        auto callback = m_events.top().callback;
+        m_events.pop();
+
+        lock.unlock();
+        invoke(callback);
+        lock.lock();
+    }
+}
+
+void thread_timer::invoke(const std::function<void()> &callback) {
+    try {
+        callback();
+    } catch (const ignite_error &err) {
+        m_error_handler(ignite_error(err));
+    } catch (const std::exception &err) {
+        m_error_handler(ignite_error(err.what()));
+    } catch (...) {
+        m_error_handler(ignite_error("Unknown error in timer callback"));
+    }
+}
+
+} // namespace ignite::detail
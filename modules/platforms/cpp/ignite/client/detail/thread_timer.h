@@ -0,0 +1,145 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <ignite/common/ignite_error.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Timer that runs callbacks on a dedicated thread, or on the application thread that calls process().
+ */
+class thread_timer {
+public:
+    /**
+     * Destructor.
+     */
+    ~thread_timer();
+
+    /**
+     * Start the timer thread.
+     *
+     * @param error_handler Handler for exceptions thrown by callbacks.
+     * @return Timer.
+     */
+    static std::shared_ptr<thread_timer> start(std::function<void(ignite_error &&)> error_handler);
+
+    /**
+     * Create the timer without a thread. The callbacks are run by process().
+     *
+     * @param error_handler Handler for exceptions thrown by callbacks.
+     * @return Timer.
+     */
+    static std::shared_ptr<thread_timer> create(std::function<void(ignite_error &&)> error_handler);
+
+    /**
+     * Stop the timer thread. Pending callbacks are dropped. Should be called by the owner, as the thread keeps the
+     * timer alive until stopped.
+     */
+    void stop();
+
+    /**
+     * Schedule callback.
+     *
+     * @param timeout Timeout after which the callback is called.
+     * @param callback Callback.
+     */
+    void add(std::chrono::milliseconds timeout, std::function<void()> callback);
+
+    /**
+     * Get time until the earliest scheduled callback.
+     *
+     * @return Timeout, or @c std::nullopt if nothing is scheduled.
+     */
+    [[nodiscard]] std::optional<std::chrono::milliseconds> get_timeout();
+
+    /**
+     * Run the callbacks which are due. Used when the timer has no thread.
+     */
+    void process();
+
+private:
+    /**
+     * Timer event.
+     */
+    struct timer_event {
+        /** Time to run the callback at. */
+        std::chrono::steady_clock::time_point timeout;
+
+        /** Callback. */
+        std::function<void()> callback;
+
+        /**
+         * Comparison operator. Earlier events have higher priority.
+         *
+         * @param other Another instance.
+         * @return @c true if this event should run after the other one.
+         */
+        bool operator<(const timer_event &other) const { return timeout > other.timeout; }
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param error_handler Handler for exceptions thrown by callbacks.
+     */
+    explicit thread_timer(std::function<void(ignite_error &&)> error_handler)
+        : m_error_handler(std::move(error_handler)) {}
+
+    /**
+     * Run the timer loop.
+     */
+    void run();
+
+    /**
+     * Run callback and report its error, if any.
+     *
+     * @param callback Callback.
+     */
+    void invoke(const std::function<void()> &callback);
+
+    /** Error handler. */
+    std::function<void(ignite_error &&)> m_error_handler;
+
+    /** Stopping flag. */
+    bool m_stopping{false};
+
+    /** Mutex. */
+    std::mutex m_mutex;
+
+    /** Condition variable. */
+    std::condition_variable m_condition;
+
+    /** Scheduled events. */
+    std::priority_queue<timer_event> m_events;
+
+    /** Timer thread. */
+    std::thread m_thread;
+};
+
+} // namespace ignite::detail
@@ -0,0 +1,145 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "thread_timer.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ignite;
+using namespace ignite::detail;
+using namespace std::chrono_literals;
+
+TEST(thread_timer, process_runs_due_callbacks_in_order) {
+    std::vector<std::string> errors;
+    auto timer = thread_timer::create([&errors](ignite_error &&err) { errors.emplace_back(err.what()); });
+
+    EXPECT_FALSE(timer->get_timeout().has_value());
+
+    std::vector<int> order;
+    timer->add(200ms, [&order] { order.push_back(2); });
+    timer->add(0ms, [&order] { order.push_back(1); });
+    timer->add(1h, [&order] { order.push_back(3); });
+
+    EXPECT_EQ(0ms, timer->get_timeout());
+
+    timer->process();
+    ASSERT_EQ(std::vector<int>{1}, order);
+
+    // Asserted, so the test fails instead of sleeping for an hour if the order is wrong.
+    auto timeout = timer->get_timeout();
+    ASSERT_TRUE(timeout.has_value());
+    ASSERT_LE(*timeout, 200ms);
+
+    std::this_thread::sleep_for(*timeout);
+    timer->process();
+
+    EXPECT_EQ((std::vector<int>{1, 2}), order);
+    EXPECT_GT(timer->get_timeout(), 1min);
+    EXPECT_TRUE(errors.empty());
+
+    timer->stop();
+}
+
+TEST(thread_timer, callbacks_added_by_callback_run_on_next_process) {
+    auto timer = thread_timer::create([](ignite_error &&) {});
+
+    int calls = 0;
+    timer->add(0ms, [&] {
+        ++calls;
+        timer->add(0ms, [&calls] { ++calls; });
+    });
+
+    timer->process();
+    EXPECT_EQ(1, calls);
+
+    timer->process();
+    EXPECT_EQ(2, calls);
+
+    timer->stop();
+}
+
+TEST(thread_timer, errors_are_reported) {
+    std::vector<std::string> errors;
+    auto timer = thread_timer::create([&errors](ignite_error &&err) { errors.emplace_back(err.what()); });
+
+    bool after = false;
+    timer->add(0ms, [] { throw ignite_error("timer error"); });
+    timer->add(0ms, [] { throw std::runtime_error("std error"); });
+    timer->add(1ms, [&after] { after = true; });
+
+    std::this_thread::sleep_for(2ms);
+    timer->process();
+
+    EXPECT_EQ((std::vector<std::string>{"timer error", "std error"}), errors);
+    EXPECT_TRUE(after);
+
+    timer->stop();
+}
+
+TEST(thread_timer, stop_drops_callbacks) {
+    auto timer = thread_timer::create([](ignite_error &&) {});
+
+    bool called = false;
+    timer->add(0ms, [&] {
+        timer->stop();
+        timer->add(0ms, [&called] { called = true; });
+    });
+    timer->add(0ms, [&called] { called = true; });
+
+    timer->process();
+
+    EXPECT_FALSE(called);
+    EXPECT_FALSE(timer->get_timeout().has_value());
+}
+
+TEST(thread_timer, thread_runs_callbacks) {
+    auto timer = thread_timer::start([](ignite_error &&) {});
+
+    std::atomic_int calls{0};
+    timer->add(0ms, [&calls] { ++calls; });
+    timer->add(5ms, [&calls] { ++calls; });
+
+    auto deadline = std::chrono::steady_clock::now() + 10s;
+    while (calls < 2 && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(1ms);
+
+    EXPECT_EQ(2, calls.load());
+
+    timer->stop();
+}
+
+TEST(thread_timer, stop_from_thread_callback) {
+    auto timer = thread_timer::start([](ignite_error &&) {});
+
+    std::atomic_bool stopped{false};
+    timer->add(0ms, [timer, &stopped] {
+        timer->stop();
+        stopped = true;
+    });
+
+    auto deadline = std::chrono::steady_clock::now() + 10s;
+    while (!stopped && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(1ms);
+
+    EXPECT_TRUE(stopped);
+}
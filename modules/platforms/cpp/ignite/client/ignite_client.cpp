@@ -17,6 +17,7 @@
 
 #include "ignite_client.h"
 
+#include "detail/client_runtime_impl.h"
 #include "detail/ignite_client_impl.h"
 
 #include <ignite/common/ignite_error.h>
@@ -27,6 +28,27 @@ namespace ignite {
 
 void ignite_client::start_async(ignite_client_configuration configuration, std::chrono::milliseconds timeout,
     ignite_callback<ignite_client> callback) {
+    auto runtime = configuration.get_runtime().m_impl;
+    if (runtime) {
+        // The result is delivered through the timer of the runtime, so the client can be released by the callback
+        // without stopping the network threads from themselves. With an external runtime, this is the loop thread.
+        auto impl = std::make_shared<detail::ignite_client_impl>(std::move(configuration));
+        auto timer = runtime->get_timer();
+
+        impl->start(timeout, [impl, timer, callback = std::move(callback)](ignite_result<void> res) mutable {
+            timer->add(std::chrono::milliseconds(0),
+                [impl = std::move(impl), res = std::move(res), callback = std::move(callback)]() mutable {
+                    if (!res) {
+                        impl->stop();
+                        callback({std::move(res).error()});
+                    } else
+                        callback({ignite_client(std::move(impl))});
+                });
+        });
+
+        return;
+    }
+
     // TODO: IGNITE-17762 Async start should not require starting thread internally. Replace with async timer.
     (void) std::async([cfg = std::move(configuration), timeout, callback = std::move(callback)]() mutable {
         auto res =
@@ -36,6 +58,9 @@ void ignite_client::start_async(ignite_client_configuration configuration, std::
 }
 
 ignite_client ignite_client::start(ignite_client_configuration configuration, std::chrono::milliseconds timeout) {
+    if (configuration.get_runtime().is_external())
+        throw ignite_error("Client with an external event loop can only be started asynchronously");
+
     auto impl = std::make_shared<detail::ignite_client_impl>(std::move(configuration));
 
     auto promise = std::make_shared<std::promise<void>>();
@@ -55,6 +80,9 @@ ignite_client ignite_client::start(ignite_client_configuration configuration, st
         throw ignite_error("Can not establish connection within timeout");
     }
 
+    // Rethrows the error of the start, e.g. of the warm-up.
+    future.get();
+
     return ignite_client(std::move(impl));
 }
 
@@ -70,6 +98,10 @@ tables ignite_client::get_tables() const noexcept {
     return tables(impl().get_tables_impl());
 }
 
+sql ignite_client::get_sql() const noexcept {
+    return sql(impl().get_sql_impl());
+}
+
 detail::ignite_client_impl &ignite_client::impl() noexcept {
     return *((detail::ignite_client_impl *) (m_impl.get()));
 }
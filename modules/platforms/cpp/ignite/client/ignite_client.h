@@ -18,6 +18,7 @@
 #pragma once
 
 #include <ignite/client/ignite_client_configuration.h>
+#include <ignite/client/sql/sql.h>
 #include <ignite/client/table/tables.h>
 
 #include <ignite/common/config.h>
@@ -65,6 +66,9 @@ public:
      * connection to any node of the cluster. Upon this event, future will be set
      * with a usable ignite_client instance.
      *
+     * If the configuration has a client runtime, the callback is called from the runtime timer, which is the thread
+     * calling client_runtime::on_timer() for an external runtime.
+     *
      * @param configuration Client configuration.
      * @param timeout Operation timeout.
      * @param callback Callback to be called once operation is complete.
@@ -77,6 +81,8 @@ public:
      *
      * @see start_async for details.
      *
+     * Can not be used with an external client runtime.
+     *
      * @param configuration Client configuration.
      * @param timeout Operation timeout.
      * @return ignite_client instance.
@@ -97,6 +103,13 @@ public:
      */
     [[nodiscard]] IGNITE_API tables get_tables() const noexcept;
 
+    /**
+     * Get the SQL API.
+     *
+     * @return SQL API.
+     */
+    [[nodiscard]] IGNITE_API sql get_sql() const noexcept;
+
 private:
     /**
      * Constructor
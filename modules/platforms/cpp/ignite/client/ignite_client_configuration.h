@@ -17,8 +17,15 @@
 
 #pragma once
 
+#include <ignite/client/backpressure.h>
+#include <ignite/client/client_runtime.h>
 #include <ignite/client/ignite_logger.h>
+#include <ignite/client/outlier_detection.h>
+#include <ignite/client/retry_policy.h>
+#include <ignite/client/warmup.h>
 
+#include <chrono>
+#include <cstddef>
 #include <initializer_list>
 #include <memory>
 #include <string>
@@ -26,6 +33,32 @@
 
 namespace ignite {
 
+/**
+ * Socket tuning profile.
+ */
+enum class socket_profile {
+    /** Balanced settings. */
+    DEFAULT,
+
+    /** Minimal request latency at the cost of CPU usage. */
+    LOW_LATENCY,
+
+    /** Maximal throughput of bulk operations. */
+    THROUGHPUT,
+};
+
+/**
+ * Routing of the key reads, i.e. record_view::get() and record_view::get_all(). The reads are not balanced across the
+ * replicas of a partition.
+ */
+enum class read_mode {
+    /** Reads are sent over any connection, like the other requests. */
+    ANY,
+
+    /** Reads of a key are sent over the connection to the primary replica of its partition. */
+    PRIMARY,
+};
+
 /**
  * Ignite client configuration.
  */
@@ -66,7 +99,9 @@ public:
      *      lesser to greater until an open port is found;
      * - my-host.com - Default port is used, see DEFAULT_PORT;
      * - my-host.com:780 - Custom port;
-     * - my-host.com:780..787 - Custom port range.
+     * - my-host.com:780..787 - Custom port range;
+     * - unix:/var/run/ignite/client.sock - Unix domain socket of a node running on the same host. Not supported on
+     *      Windows.
      *
      * Default is "localhost"
      *
@@ -116,6 +151,394 @@ public:
      */
     void set_connection_limit(uint32_t limit) { m_connection_limit = limit; }
 
+    /**
+     * Get topology refresh interval.
+     *
+     * When enabled, the client periodically requests the list of cluster nodes over one of the established
+     * connections and connects to the nodes that are not listed in the endpoints. Connections to the discovered
+     * nodes that have left the cluster are closed. Configured endpoints are always kept. The nodes do not report
+     * their client ports, so the discovered nodes are expected to listen on the same client port as the node the
+     * list was received from.
+     *
+     * Zero value means that topology discovery is disabled.
+     *
+     * The default value is zero.
+     *
+     * @return Topology refresh interval.
+     */
+    [[nodiscard]] std::chrono::milliseconds get_topology_refresh_interval() const {
+        return m_topology_refresh_interval;
+    }
+
+    /**
+     * Set topology refresh interval.
+     *
+     * @see get_topology_refresh_interval() for details.
+     *
+     * @param interval Topology refresh interval.
+     */
+    void set_topology_refresh_interval(std::chrono::milliseconds interval) { m_topology_refresh_interval = interval; }
+
+    /**
+     * Get heartbeat interval.
+     *
+     * Heartbeats are sent to every connected node to keep idle connections open and to detect dead connections
+     * quickly. The actual interval is the smaller of this value and a third of the idle timeout reported by the
+     * node, but not less than 500 milliseconds. When a heartbeat is not answered before the next one is due, the
+     * connection is considered suspect and is not used for new requests until the node responds. A connection with
+     * three unanswered heartbeats in a row is closed.
+     *
+     * Zero value disables heartbeats.
+     *
+     * The default value is 30 seconds.
+     *
+     * @return Heartbeat interval.
+     */
+    [[nodiscard]] std::chrono::milliseconds get_heartbeat_interval() const { return m_heartbeat_interval; }
+
+    /**
+     * Set heartbeat interval.
+     *
+     * @see get_heartbeat_interval() for details.
+     *
+     * @param interval Heartbeat interval.
+     */
+    void set_heartbeat_interval(std::chrono::milliseconds interval) { m_heartbeat_interval = interval; }
+
+    /**
+     * Get retry policy.
+     *
+     * @see retry_policy for details.
+     *
+     * @return Retry policy.
+     */
+    [[nodiscard]] const retry_policy &get_retry_policy() const { return m_retry_policy; }
+
+    /**
+     * Set retry policy.
+     *
+     * @param policy Retry policy.
+     */
+    void set_retry_policy(retry_policy policy) { m_retry_policy = policy; }
+
+    /**
+     * Get outlier detection settings.
+     *
+     * @see outlier_detection for details.
+     *
+     * @return Outlier detection settings.
+     */
+    [[nodiscard]] const outlier_detection &get_outlier_detection() const { return m_outlier_detection; }
+
+    /**
+     * Set outlier detection settings.
+     *
+     * @param detection Outlier detection settings.
+     */
+    void set_outlier_detection(outlier_detection detection) { m_outlier_detection = detection; }
+
+    /**
+     * Get backpressure settings.
+     *
+     * @see backpressure for details.
+     *
+     * @return Backpressure settings.
+     */
+    [[nodiscard]] const backpressure &get_backpressure() const { return m_backpressure; }
+
+    /**
+     * Set backpressure settings.
+     *
+     * @param settings Backpressure settings.
+     */
+    void set_backpressure(backpressure settings) { m_backpressure = std::move(settings); }
+
+    /**
+     * Get pending requests limit.
+     *
+     * Requests made while there is no connection with completed handshake, e.g. right after start or while all
+     * nodes are being reconnected, wait in a queue and are sent once a handshake succeeds. Requests made when the
+     * queue is full fail immediately.
+     *
+     * The default value is 1024.
+     *
+     * @return Pending requests limit.
+     */
+    [[nodiscard]] std::uint32_t get_pending_requests_limit() const { return m_pending_requests_limit; }
+
+    /**
+     * Set pending requests limit.
+     *
+     * @see get_pending_requests_limit() for details.
+     *
+     * @param limit Pending requests limit.
+     */
+    void set_pending_requests_limit(std::uint32_t limit) { m_pending_requests_limit = limit; }
+
+    /**
+     * Get pending request timeout.
+     *
+     * Time a request waits in the pending queue for a connection before it fails.
+     *
+     * @see get_pending_requests_limit() for details.
+     *
+     * The default value is 10 seconds.
+     *
+     * @return Pending request timeout.
+     */
+    [[nodiscard]] std::chrono::milliseconds get_pending_request_timeout() const { return m_pending_request_timeout; }
+
+    /**
+     * Set pending request timeout.
+     *
+     * @see get_pending_request_timeout() for details.
+     *
+     * @param timeout Pending request timeout.
+     */
+    void set_pending_request_timeout(std::chrono::milliseconds timeout) { m_pending_request_timeout = timeout; }
+
+    /**
+     * Get shared memory enabled flag.
+     *
+     * When enabled, connections to the nodes running on the same host (endpoints with a loopback host) are made
+     * over shared memory ring buffers instead of TCP, which avoids system calls and kernel buffer copies on the data
+     * path. The node has to provide a shared memory segment for its client port. If it does not, or if it does not
+     * accept the connection in time, the client falls back to TCP for this endpoint.
+     *
+     * Ignite server nodes do not provide the segments yet, so the connections to them are always made over TCP.
+     *
+     * Only supported on Linux. Ignored on other platforms.
+     *
+     * The default value is @c false.
+     *
+     * @return @c true if shared memory connections are enabled.
+     */
+    [[nodiscard]] bool is_shared_memory_enabled() const { return m_shared_memory_enabled; }
+
+    /**
+     * Set shared memory enabled flag.
+     *
+     * @see is_shared_memory_enabled() for details.
+     *
+     * @param enabled Shared memory enabled flag.
+     */
+    void set_shared_memory_enabled(bool enabled) { m_shared_memory_enabled = enabled; }
+
+    /**
+     * Get submission queue enabled flag.
+     *
+     * When enabled, application threads do not write to the socket themselves. Instead, they put requests into a
+     * lock-free queue of the connection and wake the network thread, which writes all pending requests of the
+     * connection with a single system call. This avoids lock contention when many threads share a connection, at the
+     * cost of a thread hop per batch of requests.
+     *
+     * The default value is @c false.
+     *
+     * @return @c true if submission queue is enabled.
+     */
+    [[nodiscard]] bool is_submission_queue_enabled() const { return m_submission_queue_enabled; }
+
+    /**
+     * Set submission queue enabled flag.
+     *
+     * @see is_submission_queue_enabled() for details.
+     *
+     * @param enabled Submission queue enabled flag.
+     */
+    void set_submission_queue_enabled(bool enabled) { m_submission_queue_enabled = enabled; }
+
+    /**
+     * Get zero-copy send threshold.
+     *
+     * Requests not smaller than the threshold, e.g. large batches of tuples, are sent without copying them into the
+     * kernel (MSG_ZEROCOPY). This reduces CPU usage on bulk-ingest workloads, but only pays off for large requests,
+     * as every zero-copy send requires a completion notification from the kernel. Requests of smaller size are sent
+     * as usual.
+     *
+     * Only supported on Linux. Ignored on other platforms and for Unix domain sockets.
+     *
+     * Zero value means that zero-copy sends are disabled.
+     *
+     * The default value is zero.
+     *
+     * @return Zero-copy send threshold in bytes.
+     */
+    [[nodiscard]] std::size_t get_zero_copy_threshold() const { return m_zero_copy_threshold; }
+
+    /**
+     * Set zero-copy send threshold.
+     *
+     * @see get_zero_copy_threshold() for details.
+     *
+     * @param threshold Zero-copy send threshold in bytes.
+     */
+    void set_zero_copy_threshold(std::size_t threshold) { m_zero_copy_threshold = threshold; }
+
+    /**
+     * Get socket tuning profile.
+     *
+     * - socket_profile::DEFAULT - fixed 64 KiB socket buffers and no-delay mode.
+     * - socket_profile::LOW_LATENCY - sockets are busy polled by the kernel (SO_BUSY_POLL), and the network thread
+     *   spins for a short time before blocking, waiting for the responses. Reduces latency of requests at the cost of
+     *   CPU usage. Use set_io_thread_cpu() to additionally pin the network thread to a dedicated CPU.
+     * - socket_profile::THROUGHPUT - socket buffers are autotuned by the kernel, batched requests are coalesced into
+     *   full-sized segments, and a larger receive buffer is used. Suits bulk loads and large scans.
+     *
+     * Only supported on Linux. Other platforms always use the default profile.
+     *
+     * The default value is socket_profile::DEFAULT.
+     *
+     * @return Socket tuning profile.
+     */
+    [[nodiscard]] socket_profile get_socket_profile() const { return m_socket_profile; }
+
+    /**
+     * Set socket tuning profile.
+     *
+     * @see get_socket_profile() for details.
+     *
+     * @param profile Socket tuning profile.
+     */
+    void set_socket_profile(socket_profile profile) { m_socket_profile = profile; }
+
+    /**
+     * Get the CPU the network thread is pinned to.
+     *
+     * Negative value means that the network thread is not pinned.
+     *
+     * Only supported on Linux. Ignored on other platforms.
+     *
+     * The default value is -1.
+     *
+     * @return CPU index.
+     */
+    [[nodiscard]] int get_io_thread_cpu() const { return m_io_thread_cpu; }
+
+    /**
+     * Set the CPU the network thread is pinned to.
+     *
+     * @see get_io_thread_cpu() for details.
+     *
+     * @param cpu CPU index. Negative value disables pinning.
+     */
+    void set_io_thread_cpu(int cpu) { m_io_thread_cpu = cpu; }
+
+    /**
+     * Get client runtime.
+     *
+     * Clients configured with the same runtime share its network I/O and timer threads. If the runtime is empty, the
+     * client starts its own threads. The I/O thread CPU and the event loop spinning of the low-latency socket profile
+     * do not apply to the shared threads.
+     *
+     * The default value is an empty runtime.
+     *
+     * @return Client runtime.
+     */
+    [[nodiscard]] const client_runtime &get_runtime() const { return m_runtime; }
+
+    /**
+     * Set client runtime.
+     *
+     * @see get_runtime() for details.
+     *
+     * @param runtime Client runtime.
+     */
+    void set_runtime(client_runtime runtime) { m_runtime = std::move(runtime); }
+
+    /**
+     * Get response arena enabled flag.
+     *
+     * When enabled, the tuples of a multi-row result, e.g. of record_view::get_all(), are allocated from a single
+     * memory arena of the response instead of allocating every tuple separately. The arena is freed at once when the
+     * last tuple of the result is destroyed, so keeping a single tuple keeps the memory of the whole result. Copy the
+     * tuple to release the arena. Values of the columns are allocated as usual.
+     *
+     * The default value is @c false.
+     *
+     * @return @c true if response arena is enabled.
+     */
+    [[nodiscard]] bool is_response_arena_enabled() const { return m_response_arena_enabled; }
+
+    /**
+     * Set response arena enabled flag.
+     *
+     * @see is_response_arena_enabled() for details.
+     *
+     * @param enabled Response arena enabled flag.
+     */
+    void set_response_arena_enabled(bool enabled) { m_response_arena_enabled = enabled; }
+
+    /**
+     * Get number of batch threads.
+     *
+     * Large batch operations, e.g. record_view::upsert_all() and record_view::get_all(), encode the request rows and
+     * decode the response rows on the calling thread and the network thread respectively. When batch threads are
+     * enabled, rows of batches of at least 1024 rows are split between the batch threads and the thread that does the
+     * work. The order of rows is preserved.
+     *
+     * Zero value means that batches are processed by a single thread.
+     *
+     * The default value is zero.
+     *
+     * @return Number of batch threads.
+     */
+    [[nodiscard]] std::uint32_t get_batch_threads() const { return m_batch_threads; }
+
+    /**
+     * Set number of batch threads.
+     *
+     * @see get_batch_threads() for details.
+     *
+     * @param threads Number of batch threads.
+     */
+    void set_batch_threads(std::uint32_t threads) { m_batch_threads = threads; }
+
+    /**
+     * Get read mode.
+     *
+     * - read_mode::ANY - reads are sent over any connection.
+     * - read_mode::PRIMARY - the partition of every key is computed by the client, and the read is sent over the
+     *   connection to the primary replica of the partition, which saves a hop between the nodes. A batch read is
+     *   split into a batch per primary replica. The primary replicas are taken from the partition assignment of the
+     *   table, which is cached and reloaded when the server reports a change, when a connection is established or
+     *   lost, when the routed node is not connected, and periodically. Keys are read over any connection while the
+     *   primary replica of the partition is not connected or the assignment is unknown.
+     *
+     *   This is partition-aware routing, not read load balancing. The server reports only the primary replica of
+     *   every partition, so all the reads of a partition go to the same node, and the reads of a hot partition do
+     *   not scale with the number of its replicas.
+     *
+     * The default value is read_mode::ANY.
+     *
+     * @return Read mode.
+     */
+    [[nodiscard]] read_mode get_read_mode() const { return m_read_mode; }
+
+    /**
+     * Set read mode.
+     *
+     * @see get_read_mode() for details.
+     *
+     * @param mode Read mode.
+     */
+    void set_read_mode(read_mode mode) { m_read_mode = mode; }
+
+    /**
+     * Get warm-up settings.
+     *
+     * @see warmup for details.
+     *
+     * @return Warm-up settings.
+     */
+    [[nodiscard]] const warmup &get_warmup() const { return m_warmup; }
+
+    /**
+     * Set warm-up settings.
+     *
+     * @param settings Warm-up settings.
+     */
+    void set_warmup(warmup settings) { m_warmup = std::move(settings); }
+
 private:
     /** Endpoints. */
     std::vector<std::string> m_endpoints{"localhost"};
@@ -125,6 +548,57 @@ private:
 
     /** Active connections limit. */
     uint32_t m_connection_limit{0};
+
+    /** Topology refresh interval. */
+    std::chrono::milliseconds m_topology_refresh_interval{0};
+
+    /** Heartbeat interval. */
+    std::chrono::milliseconds m_heartbeat_interval{std::chrono::seconds(30)};
+
+    /** Retry policy. */
+    retry_policy m_retry_policy{};
+
+    /** Outlier detection settings. */
+    outlier_detection m_outlier_detection{};
+
+    /** Backpressure settings. */
+    backpressure m_backpressure{};
+
+    /** Pending requests limit. */
+    std::uint32_t m_pending_requests_limit{1024};
+
+    /** Pending request timeout. */
+    std::chrono::milliseconds m_pending_request_timeout{std::chrono::seconds(10)};
+
+    /** Shared memory enabled flag. */
+    bool m_shared_memory_enabled{false};
+
+    /** Submission queue enabled flag. */
+    bool m_submission_queue_enabled{false};
+
+    /** Zero-copy send threshold. */
+    std::size_t m_zero_copy_threshold{0};
+
+    /** Socket tuning profile. */
+    socket_profile m_socket_profile{socket_profile::DEFAULT};
+
+    /** CPU to pin the network thread to. */
+    int m_io_thread_cpu{-1};
+
+    /** Client runtime. */
+    client_runtime m_runtime{};
+
+    /** Response arena enabled flag. */
+    bool m_response_arena_enabled{false};
+
+    /** Number of batch threads. */
+    std::uint32_t m_batch_threads{0};
+
+    /** Read mode. */
+    read_mode m_read_mode{read_mode::ANY};
+
+    /** Warm-up settings. */
+    warmup m_warmup{};
 };
 
 } // namespace ignite
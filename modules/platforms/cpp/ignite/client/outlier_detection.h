@@ -0,0 +1,157 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace ignite {
+
+/**
+ * Outlier detection settings.
+ *
+ * The client tracks error rate and 90th percentile of response latency of the recent requests of every connection.
+ * A connection is ejected from request routing if its error rate exceeds the threshold, or if its latency exceeds
+ * the median latency of all connections by the latency factor. Once the ejection time passes, the connection is
+ * probed with a heartbeat and returned to routing if the node answers. Every subsequent ejection of the same
+ * connection lasts longer.
+ */
+class outlier_detection {
+public:
+    // Default
+    outlier_detection() = default;
+
+    /**
+     * Get detection interval.
+     *
+     * Zero value disables outlier detection.
+     *
+     * The default value is 10 seconds.
+     *
+     * @return Detection interval.
+     */
+    [[nodiscard]] std::chrono::milliseconds get_interval() const { return m_interval; }
+
+    /**
+     * Set detection interval.
+     *
+     * @param interval Detection interval.
+     */
+    void set_interval(std::chrono::milliseconds interval) { m_interval = interval; }
+
+    /**
+     * Get minimal number of recent requests of a connection required to consider it for ejection.
+     *
+     * The default value is 20.
+     *
+     * @return Minimal number of requests.
+     */
+    [[nodiscard]] std::uint32_t get_min_requests() const { return m_min_requests; }
+
+    /**
+     * Set minimal number of recent requests of a connection required to consider it for ejection.
+     *
+     * @param min_requests Minimal number of requests.
+     */
+    void set_min_requests(std::uint32_t min_requests) { m_min_requests = min_requests; }
+
+    /**
+     * Get error rate threshold, from 0 to 1.
+     *
+     * The default value is 0.5.
+     *
+     * @return Error rate threshold.
+     */
+    [[nodiscard]] double get_error_rate_threshold() const { return m_error_rate_threshold; }
+
+    /**
+     * Set error rate threshold.
+     *
+     * @param threshold Error rate threshold, from 0 to 1.
+     */
+    void set_error_rate_threshold(double threshold) { m_error_rate_threshold = threshold; }
+
+    /**
+     * Get latency factor.
+     *
+     * The default value is 10.
+     *
+     * @return Latency factor.
+     */
+    [[nodiscard]] double get_latency_factor() const { return m_latency_factor; }
+
+    /**
+     * Set latency factor.
+     *
+     * @param factor Latency factor.
+     */
+    void set_latency_factor(double factor) { m_latency_factor = factor; }
+
+    /**
+     * Get base ejection time. The n-th ejection in a row lasts n times longer, up to ten times.
+     *
+     * The default value is 30 seconds.
+     *
+     * @return Base ejection time.
+     */
+    [[nodiscard]] std::chrono::milliseconds get_base_ejection_time() const { return m_base_ejection_time; }
+
+    /**
+     * Set base ejection time.
+     *
+     * @param time Base ejection time.
+     */
+    void set_base_ejection_time(std::chrono::milliseconds time) { m_base_ejection_time = time; }
+
+    /**
+     * Get maximal fraction of connections that can be ejected at the same time, from 0 to 1.
+     *
+     * The default value is 0.5.
+     *
+     * @return Maximal ejected fraction.
+     */
+    [[nodiscard]] double get_max_ejected_fraction() const { return m_max_ejected_fraction; }
+
+    /**
+     * Set maximal fraction of connections that can be ejected at the same time.
+     *
+     * @param fraction Maximal ejected fraction, from 0 to 1.
+     */
+    void set_max_ejected_fraction(double fraction) { m_max_ejected_fraction = fraction; }
+
+private:
+    /** Detection interval. */
+    std::chrono::milliseconds m_interval{10000};
+
+    /** Minimal number of requests. */
+    std::uint32_t m_min_requests{20};
+
+    /** Error rate threshold. */
+    double m_error_rate_threshold{0.5};
+
+    /** Latency factor. */
+    double m_latency_factor{10.0};
+
+    /** Base ejection time. */
+    std::chrono::milliseconds m_base_ejection_time{30000};
+
+    /** Maximal ejected fraction. */
+    double m_max_ejected_fraction{0.5};
+};
+
+} // namespace ignite
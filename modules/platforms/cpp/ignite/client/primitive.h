@@ -0,0 +1,332 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/table/binary_stream.h"
+
+#include "ignite/common/ignite_error.h"
+#include "ignite/common/uuid.h"
+#include "ignite/schema/big_decimal.h"
+#include "ignite/schema/big_integer.h"
+#include "ignite/schema/ignite_date.h"
+#include "ignite/schema/ignite_date_time.h"
+#include "ignite/schema/ignite_time.h"
+#include "ignite/schema/ignite_timestamp.h"
+#include "ignite/schema/ignite_type.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace ignite {
+
+/**
+ * Value of a tuple column: a value of one of the Ignite types or null.
+ *
+ * The value is stored inline and its type is kept as a tag, so no allocation is made for values of fixed size and
+ * accessing the value does not require RTTI. Strings, byte arrays and big numbers keep their own storage.
+ *
+ * Besides the Ignite types, a primitive can hold a binary_source or a binary_sink to stream a large BINARY or STRING
+ * value. Bit masks are not supported.
+ */
+class primitive {
+public:
+    /** Value storage. The order of the alternatives is a part of the ABI. */
+    typedef std::variant<std::monostate, std::int8_t, std::int16_t, std::int32_t, std::int64_t, float, double,
+        big_decimal, uuid, std::string, std::vector<std::byte>, ignite_date, ignite_time, ignite_date_time,
+        ignite_timestamp, big_integer, binary_source, binary_sink>
+        value_type;
+
+    // Default
+    primitive() = default;
+
+    /**
+     * Null value.
+     */
+    primitive(std::nullptr_t) {} // NOLINT(google-explicit-constructor)
+
+    /**
+     * Constructor.
+     *
+     * @param value Value.
+     */
+    primitive(std::int8_t value) // NOLINT(google-explicit-constructor)
+        : m_value(value) {}
+
+    /**
+     * Constructor.
+     *
+     * @param value Value.
+     */
+    primitive(std::int16_t value) // NOLINT(google-explicit-constructor)
+        : m_value(value) {}
+
+    /**
+     * Constructor.
+     *
+     * @param value Value.
+     */
+    primitive(std::int32_t value) // NOLINT(google-explicit-constructor)
+        : m_value(value) {}
+
+    /**
+     * Constructor.
+     *
+     * @param value Value.
+     */
+    primitive(std::int64_t value) // NOLINT(google-explicit-constructor)
+        : m_value(value) {}
+
+    /**
+     * Constructor for the integer types other than the fixed-width signed ones, e.g. @c long @c long or
+     * @c std::size_t. A signed value is stored as the signed type of the same size. An unsigned value is stored as
+     * the narrowest signed type that holds all the values of @c T, so @c std::uint8_t is stored as INT16.
+     *
+     * @param value Value.
+     *
+     * @throw ignite_error if a 64-bit unsigned value does not fit INT64.
+     */
+    template<typename T,
+        std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, std::int8_t>
+                && !std::is_same_v<T, std::int16_t> && !std::is_same_v<T, std::int32_t>
+                && !std::is_same_v<T, std::int64_t>,
+            int> = 0>
+    primitive(T value) // NOLINT(google-explicit-constructor)
+        : m_value(from_integer(value)) {}
+
+    /**
+     * Deleted: there is no boolean Ignite type, and the value would otherwise be silently stored as INT32.
+     */
+    primitive(bool) = delete;
+
+    /**
+     * Constructor.
+     *
+     * @param value Value.
+     */
+    primitive(float value) // NOLINT(google-explicit-constructor)
+        : m_value(value) {}
+
+    /**
+     * Constructor.
+     *
+     * @param value Value.
+     */
+    primitive(double value) // NOLINT(google-explicit-constructor)
+        : m_value(value) {}
+
+    /**
+     * Constructor.
+     *
+     * @param value Value.
+     */
+    primitive(big_decimal value) // NOLINT(google-explicit-constructor)
+        : m_value(std::move(value)) {}
+
+    /**
+     * Constructor.
+     *
+     * @param value Value.
+     */
+    primitive(uuid value) // NOLINT(google-explicit-constructor)
+        : m_value(value) {}
+
+    /**
+     * Constructor.
+     *
+     * @param value Value.
+     */
+    primitive(std::string value) // NOLINT(google-explicit-constructor)
+        : m_value(std::move(value)) {}
+
+    /**
+     * Constructor.
+     *
+     * @param value Value.
+     */
+    primitive(const char *value) // NOLINT(google-explicit-constructor)
+        : m_value(std::string(value)) {}
+
+    /**
+     * Constructor.
+     *
+     * @param value Value.
+     */
+    primitive(std::vector<std::byte> value) // NOLINT(google-explicit-constructor)
+        : m_value(std::move(value)) {}
+
+    /**
+     * Constructor.
+     *
+     * @param value Value.
+     */
+    primitive(ignite_date value) // NOLINT(google-explicit-constructor)
+        : m_value(value) {}
+
+    /**
+     * Constructor.
+     *
+     * @param value Value.
+     */
+    primitive(ignite_time value) // NOLINT(google-explicit-constructor)
+        : m_value(value) {}
+
+    /**
+     * Constructor.
+     *
+     * @param value Value.
+     */
+    primitive(ignite_date_time value) // NOLINT(google-explicit-constructor)
+        : m_value(value) {}
+
+    /**
+     * Constructor.
+     *
+     * @param value Value.
+     */
+    primitive(ignite_timestamp value) // NOLINT(google-explicit-constructor)
+        : m_value(value) {}
+
+    /**
+     * Constructor.
+     *
+     * @param value Value.
+     */
+    primitive(big_integer value) // NOLINT(google-explicit-constructor)
+        : m_value(std::move(value)) {}
+
+    /**
+     * Constructor.
+     *
+     * @param value Value.
+     */
+    primitive(binary_source value) // NOLINT(google-explicit-constructor)
+        : m_value(std::move(value)) {}
+
+    /**
+     * Constructor.
+     *
+     * @param value Value.
+     */
+    primitive(binary_sink value) // NOLINT(google-explicit-constructor)
+        : m_value(std::move(value)) {}
+
+    /**
+     * Check whether the value is null.
+     *
+     * @return @c true if the value is null.
+     */
+    [[nodiscard]] bool is_null() const noexcept { return std::holds_alternative<std::monostate>(m_value); }
+
+    /**
+     * Get type of the value. Streamed values are of BINARY type.
+     *
+     * @return Value type.
+     *
+     * @throw ignite_error if the value is null.
+     */
+    [[nodiscard]] ignite_type get_type() const {
+        if (is_null())
+            throw ignite_error("Value is null");
+
+        return TYPES[m_value.index()];
+    }
+
+    /**
+     * Get the value.
+     *
+     * @tparam T Value type. Can be a const reference to avoid copying.
+     * @return Value.
+     *
+     * @throw ignite_error if the value is of another type or null.
+     */
+    template<typename T>
+    [[nodiscard]] T get() const {
+        if (auto res = get_if<std::remove_cv_t<std::remove_reference_t<T>>>())
+            return *res;
+
+        throw ignite_error("Type mismatch: the value is " + (is_null() ? std::string("null") : "of another type"));
+    }
+
+    /**
+     * Get pointer to the value if it is of the specified type.
+     *
+     * @tparam T Value type.
+     * @return Pointer to the value or @c nullptr if the value is of another type or null.
+     */
+    template<typename T>
+    [[nodiscard]] const T *get_if() const noexcept {
+        return std::get_if<T>(&m_value);
+    }
+
+private:
+    /**
+     * Convert an integer to the value storage.
+     *
+     * @tparam T Integer type.
+     * @param value Value.
+     * @return Value storage.
+     */
+    template<typename T>
+    static value_type from_integer(T value) {
+        if constexpr (std::is_signed_v<T>) {
+            static_assert(sizeof(T) <= sizeof(std::int64_t), "Integer type is too wide");
+            if constexpr (sizeof(T) == sizeof(std::int8_t))
+                return std::int8_t(value);
+            else if constexpr (sizeof(T) == sizeof(std::int16_t))
+                return std::int16_t(value);
+            else if constexpr (sizeof(T) == sizeof(std::int32_t))
+                return std::int32_t(value);
+            else
+                return std::int64_t(value);
+        } else {
+            static_assert(sizeof(T) <= sizeof(std::uint64_t), "Integer type is too wide");
+            if constexpr (sizeof(T) == sizeof(std::uint8_t))
+                return std::int16_t(value);
+            else if constexpr (sizeof(T) == sizeof(std::uint16_t))
+                return std::int32_t(value);
+            else if constexpr (sizeof(T) == sizeof(std::uint32_t))
+                return std::int64_t(value);
+            else {
+                if (value > std::uint64_t(std::numeric_limits<std::int64_t>::max()))
+                    throw ignite_error("Value is out of range of INT64: " + std::to_string(value));
+
+                return std::int64_t(value);
+            }
+        }
+    }
+
+    /** Types of the value alternatives. */
+    static constexpr ignite_type TYPES[] = {ignite_type::LAST, ignite_type::INT8, ignite_type::INT16,
+        ignite_type::INT32, ignite_type::INT64, ignite_type::FLOAT, ignite_type::DOUBLE, ignite_type::DECIMAL,
+        ignite_type::UUID, ignite_type::STRING, ignite_type::BINARY, ignite_type::DATE, ignite_type::TIME,
+        ignite_type::DATETIME, ignite_type::TIMESTAMP, ignite_type::NUMBER, ignite_type::BINARY, ignite_type::BINARY};
+
+    static_assert(std::size(TYPES) == std::variant_size_v<value_type>);
+
+    /** Value. */
+    value_type m_value;
+};
+
+} // namespace ignite
@@ -0,0 +1,105 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/client/primitive.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+using namespace ignite;
+
+static_assert(!std::is_constructible_v<primitive, bool>);
+
+TEST(primitive, type_tags) {
+    EXPECT_EQ(ignite_type::INT8, primitive(std::int8_t(1)).get_type());
+    EXPECT_EQ(ignite_type::INT16, primitive(std::int16_t(1)).get_type());
+    EXPECT_EQ(ignite_type::INT32, primitive(1).get_type());
+    EXPECT_EQ(ignite_type::INT64, primitive(std::int64_t(1)).get_type());
+    EXPECT_EQ(ignite_type::FLOAT, primitive(1.0f).get_type());
+    EXPECT_EQ(ignite_type::DOUBLE, primitive(1.0).get_type());
+    EXPECT_EQ(ignite_type::UUID, primitive(uuid(1, 2)).get_type());
+    EXPECT_EQ(ignite_type::STRING, primitive("abc").get_type());
+    EXPECT_EQ(ignite_type::STRING, primitive(std::string("abc")).get_type());
+    EXPECT_EQ(ignite_type::BINARY, primitive(std::vector<std::byte>{std::byte(1)}).get_type());
+    EXPECT_EQ(ignite_type::DATE, primitive(ignite_date(2022, 1, 2)).get_type());
+    EXPECT_EQ(ignite_type::TIME, primitive(ignite_time(1, 2, 3)).get_type());
+    EXPECT_EQ(ignite_type::DATETIME, primitive(ignite_date_time({2022, 1, 2}, {1, 2, 3})).get_type());
+    EXPECT_EQ(ignite_type::TIMESTAMP, primitive(ignite_timestamp(1, 2)).get_type());
+}
+
+TEST(primitive, other_integer_types) {
+    EXPECT_EQ(ignite_type::INT64, primitive(1LL).get_type());
+    EXPECT_EQ(5, primitive(5LL).get<std::int64_t>());
+
+    EXPECT_EQ(ignite_type::INT64, primitive(std::size_t(7)).get_type());
+    EXPECT_EQ(7, primitive(std::size_t(7)).get<std::int64_t>());
+
+    EXPECT_EQ(ignite_type::INT16, primitive(std::uint8_t(200)).get_type());
+    EXPECT_EQ(200, primitive(std::uint8_t(200)).get<std::int16_t>());
+    EXPECT_EQ(ignite_type::INT32, primitive(std::uint16_t(60000)).get_type());
+    EXPECT_EQ(ignite_type::INT64, primitive(4000000000U).get_type());
+    EXPECT_EQ(4000000000LL, primitive(4000000000U).get<std::int64_t>());
+
+    EXPECT_THROW(primitive(std::uint64_t(1) << 63), ignite_error);
+}
+
+TEST(primitive, get_const_reference) {
+    primitive str("abc");
+    const auto &ref = str.get<const std::string &>();
+
+    EXPECT_EQ("abc", ref);
+    EXPECT_EQ(str.get_if<std::string>(), &ref);
+
+    primitive bytes(std::vector<std::byte>{std::byte(1), std::byte(2)});
+    EXPECT_EQ(bytes.get_if<std::vector<std::byte>>(), &bytes.get<const std::vector<std::byte> &>());
+}
+
+TEST(primitive, null) {
+    primitive def;
+    primitive null(nullptr);
+
+    EXPECT_TRUE(def.is_null());
+    EXPECT_TRUE(null.is_null());
+    EXPECT_FALSE(primitive(0).is_null());
+
+    EXPECT_THROW((void) null.get_type(), ignite_error);
+    EXPECT_EQ(nullptr, null.get_if<std::int32_t>());
+
+    try {
+        (void) null.get<std::int32_t>();
+        FAIL() << "Expected ignite_error";
+    } catch (const ignite_error &err) {
+        EXPECT_EQ("Type mismatch: the value is null", std::string(err.what()));
+    }
+}
+
+TEST(primitive, type_mismatch) {
+    primitive val(std::int32_t(42));
+
+    EXPECT_EQ(nullptr, val.get_if<std::int64_t>());
+
+    try {
+        (void) val.get<std::int64_t>();
+        FAIL() << "Expected ignite_error";
+    } catch (const ignite_error &err) {
+        EXPECT_EQ("Type mismatch: the value is of another type", std::string(err.what()));
+    }
+
+    EXPECT_THROW((void) val.get<const std::string &>(), ignite_error);
+}
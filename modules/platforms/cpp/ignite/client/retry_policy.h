@@ -0,0 +1,125 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace ignite {
+
+/**
+ * Retry policy.
+ *
+ * Defines how the client retries read-only operations (e.g. getting tables, schemas or tuples) that failed because
+ * the connection to the node was lost before the response was received. Such operations are transparently resent
+ * over another connection. Operations that modify data are never retried, as the client can not know whether they
+ * were applied.
+ *
+ * Retries are disabled by default. When enabled, every read-only request is serialized into a separate buffer that
+ * is kept until the response is received, so it can be resent.
+ *
+ * The delay before the n-th retry is chosen randomly between a half and a whole of
+ * min(initial_backoff * 2^(n-1), max_backoff).
+ */
+class retry_policy {
+public:
+    // Default
+    retry_policy() = default;
+
+    /**
+     * Get maximum number of attempts, including the first one.
+     *
+     * Value of one or less disables retries.
+     *
+     * The default value is 1.
+     *
+     * @return Maximum number of attempts.
+     */
+    [[nodiscard]] std::int32_t get_max_attempts() const { return m_max_attempts; }
+
+    /**
+     * Set maximum number of attempts, including the first one.
+     *
+     * @param max_attempts Maximum number of attempts.
+     */
+    void set_max_attempts(std::int32_t max_attempts) { m_max_attempts = max_attempts; }
+
+    /**
+     * Get delay before the first retry.
+     *
+     * The default value is 100 milliseconds.
+     *
+     * @return Initial backoff.
+     */
+    [[nodiscard]] std::chrono::milliseconds get_initial_backoff() const { return m_initial_backoff; }
+
+    /**
+     * Set delay before the first retry.
+     *
+     * @param backoff Initial backoff.
+     */
+    void set_initial_backoff(std::chrono::milliseconds backoff) { m_initial_backoff = backoff; }
+
+    /**
+     * Get maximum delay between retries.
+     *
+     * The default value is 2 seconds.
+     *
+     * @return Maximum backoff.
+     */
+    [[nodiscard]] std::chrono::milliseconds get_max_backoff() const { return m_max_backoff; }
+
+    /**
+     * Set maximum delay between retries.
+     *
+     * @param backoff Maximum backoff.
+     */
+    void set_max_backoff(std::chrono::milliseconds backoff) { m_max_backoff = backoff; }
+
+    /**
+     * Get total time limit of the operation, counting from the first attempt. No retry is scheduled if it would
+     * start after the deadline.
+     *
+     * The default value is 10 seconds.
+     *
+     * @return Deadline.
+     */
+    [[nodiscard]] std::chrono::milliseconds get_deadline() const { return m_deadline; }
+
+    /**
+     * Set total time limit of the operation.
+     *
+     * @param deadline Deadline.
+     */
+    void set_deadline(std::chrono::milliseconds deadline) { m_deadline = deadline; }
+
+private:
+    /** Maximum number of attempts. */
+    std::int32_t m_max_attempts{1};
+
+    /** Initial backoff. */
+    std::chrono::milliseconds m_initial_backoff{100};
+
+    /** Maximum backoff. */
+    std::chrono::milliseconds m_max_backoff{2000};
+
+    /** Deadline. */
+    std::chrono::milliseconds m_deadline{10000};
+};
+
+} // namespace ignite
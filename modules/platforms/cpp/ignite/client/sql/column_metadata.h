@@ -0,0 +1,104 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/schema/ignite_type.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace ignite {
+
+/**
+ * Metadata of a column of the SQL query result.
+ */
+class column_metadata {
+public:
+    // Default
+    column_metadata() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param name Column name.
+     * @param type Column type.
+     * @param nullable Whether the column is nullable.
+     * @param scale Column scale.
+     * @param precision Column precision.
+     */
+    column_metadata(std::string name, ignite_type type, bool nullable, std::int32_t scale, std::int32_t precision)
+        : m_name(std::move(name))
+        , m_type(type)
+        , m_nullable(nullable)
+        , m_scale(scale)
+        , m_precision(precision) {}
+
+    /**
+     * Get column name.
+     *
+     * @return Column name.
+     */
+    [[nodiscard]] const std::string &name() const { return m_name; }
+
+    /**
+     * Get column type.
+     *
+     * @return Column type.
+     */
+    [[nodiscard]] ignite_type type() const { return m_type; }
+
+    /**
+     * Check whether the column is nullable.
+     *
+     * @return @c true if the column can contain nulls.
+     */
+    [[nodiscard]] bool nullable() const { return m_nullable; }
+
+    /**
+     * Get column scale.
+     *
+     * @return Column scale, or -1 if not applicable to the type.
+     */
+    [[nodiscard]] std::int32_t scale() const { return m_scale; }
+
+    /**
+     * Get column precision.
+     *
+     * @return Column precision, or -1 if not applicable to the type.
+     */
+    [[nodiscard]] std::int32_t precision() const { return m_precision; }
+
+private:
+    /** Column name. */
+    std::string m_name;
+
+    /** Column type. */
+    ignite_type m_type{ignite_type::LAST};
+
+    /** Whether the column is nullable. */
+    bool m_nullable{false};
+
+    /** Column scale. */
+    std::int32_t m_scale{-1};
+
+    /** Column precision. */
+    std::int32_t m_precision{-1};
+};
+
+} // namespace ignite
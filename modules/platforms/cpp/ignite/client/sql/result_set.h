@@ -0,0 +1,146 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/sql/column_metadata.h"
+#include "ignite/client/table/ignite_tuple.h"
+
+#include "ignite/common/config.h"
+#include "ignite/common/ignite_result.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ignite {
+
+namespace detail {
+
+class result_set_impl;
+class sql_impl;
+
+} // namespace detail
+
+/**
+ * Result of a SQL query.
+ *
+ * The rows are returned in pages. The result set requests the next pages in the background while the current one is
+ * processed, see sql_statement::set_prefetch_pages(). The server-side cursor is closed once the last page is fetched,
+ * or when close() is called, or when the result set is destroyed.
+ */
+class result_set {
+    friend class detail::sql_impl;
+
+public:
+    // Default
+    result_set() = default;
+    ~result_set() = default;
+    result_set(result_set &&) noexcept = default;
+    result_set &operator=(result_set &&) noexcept = default;
+
+    // Deleted
+    result_set(const result_set &) = delete;
+    result_set &operator=(const result_set &) = delete;
+
+    /**
+     * Get metadata of the result columns.
+     *
+     * @return Metadata. Empty if the query does not return rows.
+     */
+    [[nodiscard]] IGNITE_API const std::vector<column_metadata> &metadata() const;
+
+    /**
+     * Check whether the query returns rows. The rows are returned by queries like SELECT, unlike DML and DDL
+     * statements.
+     *
+     * @return @c true if the result contains rows.
+     */
+    [[nodiscard]] IGNITE_API bool has_rowset() const;
+
+    /**
+     * Get the number of rows affected by the DML statement.
+     *
+     * @return Number of affected rows, or -1 if the statement is not DML.
+     */
+    [[nodiscard]] IGNITE_API std::int64_t affected_rows() const;
+
+    /**
+     * Check whether the conditional DDL statement was applied, e.g. CREATE TABLE IF NOT EXISTS.
+     *
+     * @return @c true if the statement was applied.
+     */
+    [[nodiscard]] IGNITE_API bool was_applied() const;
+
+    /**
+     * Get the current page.
+     *
+     * @return Rows of the current page.
+     */
+    [[nodiscard]] IGNITE_API const std::vector<ignite_tuple> &current_page() const;
+
+    /**
+     * Check whether there are more pages.
+     *
+     * @return @c true if there are more pages to fetch.
+     */
+    [[nodiscard]] IGNITE_API bool has_more_pages() const;
+
+    /**
+     * Make the next page current asynchronously. The callback is called at once if the page is already prefetched.
+     * Only one page can be fetched at a time.
+     *
+     * @param callback Callback to be called once the page is fetched.
+     */
+    IGNITE_API void fetch_next_page_async(ignite_callback<void> callback);
+
+    /**
+     * Make the next page current.
+     *
+     * @see fetch_next_page_async() for details.
+     */
+    IGNITE_API void fetch_next_page();
+
+    /**
+     * Close the result set asynchronously. Closes the server-side cursor if it is still open. Pages that are fetched
+     * but not consumed are dropped.
+     *
+     * @param callback Callback to be called once the result set is closed.
+     */
+    IGNITE_API void close_async(ignite_callback<void> callback);
+
+    /**
+     * Close the result set.
+     *
+     * @see close_async() for details.
+     */
+    IGNITE_API void close();
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param impl Implementation.
+     */
+    explicit result_set(std::shared_ptr<detail::result_set_impl> impl)
+        : m_impl(std::move(impl)) {}
+
+    /** Implementation. */
+    std::shared_ptr<detail::result_set_impl> m_impl;
+};
+
+} // namespace ignite
@@ -0,0 +1,162 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace ignite {
+
+/**
+ * SQL statement.
+ */
+class sql_statement {
+public:
+    /** Default schema. */
+    static constexpr const char *DEFAULT_SCHEMA = "PUBLIC";
+
+    /** Default number of rows per page. */
+    static constexpr std::int32_t DEFAULT_PAGE_SIZE = 1024;
+
+    /** Default number of pages fetched ahead of the current one. */
+    static constexpr std::int32_t DEFAULT_PREFETCH_PAGES = 1;
+
+    // Default
+    sql_statement() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param query Query text.
+     */
+    sql_statement(std::string query) // NOLINT(google-explicit-constructor)
+        : m_query(std::move(query)) {}
+
+    /**
+     * Constructor.
+     *
+     * @param query Query text.
+     */
+    sql_statement(const char *query) // NOLINT(google-explicit-constructor)
+        : m_query(query) {}
+
+    /**
+     * Get query text.
+     *
+     * @return Query text.
+     */
+    [[nodiscard]] const std::string &query() const { return m_query; }
+
+    /**
+     * Set query text.
+     *
+     * @param query Query text.
+     */
+    void set_query(std::string query) { m_query = std::move(query); }
+
+    /**
+     * Get schema used for the objects that are not qualified with a schema name.
+     *
+     * @return Schema.
+     */
+    [[nodiscard]] const std::string &schema() const { return m_schema; }
+
+    /**
+     * Set schema used for the objects that are not qualified with a schema name.
+     *
+     * @param schema Schema.
+     */
+    void set_schema(std::string schema) { m_schema = std::move(schema); }
+
+    /**
+     * Get query timeout.
+     *
+     * @return Timeout. Zero means no timeout.
+     */
+    [[nodiscard]] std::chrono::milliseconds timeout() const { return m_timeout; }
+
+    /**
+     * Set query timeout.
+     *
+     * @param timeout Timeout. Zero means no timeout.
+     */
+    void set_timeout(std::chrono::milliseconds timeout) { m_timeout = timeout; }
+
+    /**
+     * Get the number of rows per page.
+     *
+     * @return Page size.
+     */
+    [[nodiscard]] std::int32_t page_size() const { return m_page_size; }
+
+    /**
+     * Set the number of rows per page.
+     *
+     * The rows of the result are transferred in pages. Larger pages take fewer round trips to the server, while
+     * smaller pages take less memory and return the first rows sooner.
+     *
+     * The default value is @c DEFAULT_PAGE_SIZE.
+     *
+     * @param page_size Page size. Should be positive.
+     */
+    void set_page_size(std::int32_t page_size) { m_page_size = page_size; }
+
+    /**
+     * Get the number of pages fetched ahead of the current one.
+     *
+     * @return Prefetch depth.
+     *
+     * @see set_prefetch_pages() for details.
+     */
+    [[nodiscard]] std::int32_t prefetch_pages() const { return m_prefetch_pages; }
+
+    /**
+     * Set the number of pages fetched ahead of the current one.
+     *
+     * The result set requests the next pages in the background while the current one is processed, until this number
+     * of pages is received and not yet consumed. This way the round trip to the server is hidden unless the pages are
+     * processed faster than they are transferred. The pages are still requested one at a time, in order.
+     *
+     * Zero disables the prefetch, so every page is requested on result_set::fetch_next_page().
+     *
+     * The default value is @c DEFAULT_PREFETCH_PAGES.
+     *
+     * @param prefetch_pages Prefetch depth. Should be non-negative.
+     */
+    void set_prefetch_pages(std::int32_t prefetch_pages) { m_prefetch_pages = prefetch_pages; }
+
+private:
+    /** Query text. */
+    std::string m_query;
+
+    /** Schema. */
+    std::string m_schema{DEFAULT_SCHEMA};
+
+    /** Timeout. */
+    std::chrono::milliseconds m_timeout{0};
+
+    /** Page size. */
+    std::int32_t m_page_size{DEFAULT_PAGE_SIZE};
+
+    /** Prefetch depth. */
+    std::int32_t m_prefetch_pages{DEFAULT_PREFETCH_PAGES};
+};
+
+} // namespace ignite
@@ -0,0 +1,167 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/common/bytes_view.h"
+#include "ignite/common/ignite_error.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <utility>
+
+namespace ignite {
+
+/**
+ * Source of a large BINARY or STRING column value.
+ *
+ * The source can be used as a column value of a tuple that is written to a table instead of
+ * @c std::vector<std::byte> or @c std::string. The value is read from the producer in chunks directly into the
+ * request, so it is never held in a separate buffer. The size of the value should be known in advance.
+ *
+ * The producer is called from the thread that starts the operation, or from a batch thread for large batches, and
+ * only once for every chunk, so the source can only be written once.
+ */
+class binary_source {
+public:
+    /** Maximum size of a chunk requested from the producer. */
+    static constexpr std::size_t CHUNK_SIZE = 0x10000;
+
+    /**
+     * Producer. Writes up to @c len bytes to @c buf and returns the number of bytes written.
+     */
+    typedef std::function<std::size_t(std::byte *buf, std::size_t len)> producer_type;
+
+    /**
+     * Constructor.
+     *
+     * @param size Size of the value in bytes.
+     * @param producer Producer.
+     */
+    binary_source(std::size_t size, producer_type producer)
+        : m_size(size)
+        , m_producer(std::move(producer)) {}
+
+    /**
+     * Make source reading the value from the stream.
+     *
+     * @param stream Stream. Should outlive the operation using the source.
+     * @param size Size of the value in bytes.
+     * @return Source.
+     */
+    [[nodiscard]] static binary_source from_stream(std::istream &stream, std::size_t size) {
+        return {size, [&stream](std::byte *buf, std::size_t len) {
+                    stream.read(reinterpret_cast<char *>(buf), std::streamsize(len));
+                    return std::size_t(stream.gcount());
+                }};
+    }
+
+    /**
+     * Get size of the value.
+     *
+     * @return Size in bytes.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+
+    /**
+     * Read the whole value.
+     *
+     * @param dst Destination. Should have space for size() bytes.
+     *
+     * @throw ignite_error if the producer ends before the whole value is read.
+     */
+    void read_to(std::byte *dst) const {
+        std::size_t done = 0;
+        while (done < m_size) {
+            auto len = std::min(CHUNK_SIZE, m_size - done);
+            auto res = m_producer(dst + done, len);
+            if (!res || res > len) {
+                throw ignite_error("Binary source provided " + std::to_string(done) + " bytes out of "
+                    + std::to_string(m_size) + " declared");
+            }
+            done += res;
+        }
+    }
+
+private:
+    /** Size. */
+    std::size_t m_size;
+
+    /** Producer. */
+    producer_type m_producer;
+};
+
+/**
+ * Sink for a large BINARY or STRING column value.
+ *
+ * The sink can be used as a value of a non-key column in the key tuple passed to
+ * record_view<ignite_tuple>::get(). The column value is then passed to the consumer in chunks straight from the
+ * response instead of being copied to the resulting tuple. The resulting tuple holds the sink in place of the value,
+ * or null if the value is null.
+ *
+ * The consumer is called from the network thread before the operation completes, so it should not block.
+ */
+class binary_sink {
+public:
+    /** Maximum size of a chunk passed to the consumer. */
+    static constexpr std::size_t CHUNK_SIZE = 0x10000;
+
+    /**
+     * Consumer. Receives the value chunks in order.
+     */
+    typedef std::function<void(bytes_view chunk)> consumer_type;
+
+    /**
+     * Constructor.
+     *
+     * @param consumer Consumer.
+     */
+    explicit binary_sink(consumer_type consumer)
+        : m_consumer(std::move(consumer)) {}
+
+    /**
+     * Make sink writing the value to the stream.
+     *
+     * @param stream Stream. Should outlive the operation using the sink.
+     * @return Sink.
+     */
+    [[nodiscard]] static binary_sink to_stream(std::ostream &stream) {
+        return binary_sink{[&stream](bytes_view chunk) {
+            stream.write(reinterpret_cast<const char *>(chunk.data()), std::streamsize(chunk.size()));
+        }};
+    }
+
+    /**
+     * Pass the value to the consumer.
+     *
+     * @param value Value.
+     */
+    void write(bytes_view value) const {
+        for (std::size_t pos = 0; pos < value.size(); pos += CHUNK_SIZE)
+            m_consumer(value.substr(pos, CHUNK_SIZE));
+    }
+
+private:
+    /** Consumer. */
+    consumer_type m_consumer;
+};
+
+} // namespace ignite
@@ -17,11 +17,14 @@
 
 #pragma once
 
+#include "ignite/client/primitive.h"
+
 #include "ignite/common/config.h"
 #include "ignite/common/ignite_error.h"
 
-#include <any>
 #include <initializer_list>
+#include <memory>
+#include <memory_resource>
 #include <string_view>
 #include <unordered_map>
 #include <utility>
@@ -33,6 +36,9 @@ class ignite_tuple_builder;
 
 /**
  * Ignite tuple.
+ *
+ * A tuple can be allocated from a memory arena shared with other tuples, e.g. the tuples of the same result. The arena
+ * is kept alive while the tuple exists. Copies of the tuple are allocated as usual.
  */
 class ignite_tuple {
     friend class ignite_tuple_builder;
@@ -48,12 +54,70 @@ public:
      */
     explicit ignite_tuple(size_t capacity) { m_pairs.reserve(capacity); }
 
+    /**
+     * Constructor.
+     *
+     * @param capacity Capacity.
+     * @param arena Memory arena to allocate the tuple from. If @c nullptr, the tuple is allocated as usual.
+     */
+    ignite_tuple(size_t capacity, std::shared_ptr<std::pmr::memory_resource> arena)
+        : m_arena(std::move(arena))
+        , m_pairs(m_arena ? m_arena.get() : std::pmr::get_default_resource())
+        , m_indices(m_arena ? m_arena.get() : std::pmr::get_default_resource()) {
+        m_pairs.reserve(capacity);
+        m_indices.reserve(capacity);
+    }
+
+    /**
+     * Copy constructor. The copy is not allocated from the arena.
+     *
+     * @param other Other tuple.
+     */
+    ignite_tuple(const ignite_tuple &other)
+        : m_pairs(other.m_pairs)
+        , m_indices(other.m_indices) {}
+
+    /**
+     * Move constructor.
+     *
+     * @param other Other tuple.
+     */
+    ignite_tuple(ignite_tuple &&other) noexcept
+        : m_arena(other.m_arena)
+        , m_pairs(std::move(other.m_pairs))
+        , m_indices(std::move(other.m_indices)) {}
+
+    /**
+     * Copy assignment. The tuple keeps allocating from its own memory.
+     *
+     * @param other Other tuple.
+     * @return This.
+     */
+    ignite_tuple &operator=(const ignite_tuple &other) {
+        m_pairs = other.m_pairs;
+        m_indices = other.m_indices;
+        return *this;
+    }
+
+    /**
+     * Move assignment. The tuple keeps allocating from its own memory, so the values are copied if the tuples are
+     * allocated differently.
+     *
+     * @param other Other tuple.
+     * @return This.
+     */
+    ignite_tuple &operator=(ignite_tuple &&other) {
+        m_pairs = std::move(other.m_pairs);
+        m_indices = std::move(other.m_indices);
+        return *this;
+    }
+
     /**
      * Constructor.
      *
      * @param pairs Pairs.
      */
-    ignite_tuple(std::initializer_list<std::pair<std::string, std::any>> pairs)
+    ignite_tuple(std::initializer_list<std::pair<std::string, primitive>> pairs)
         : m_pairs(pairs)
         , m_indices() {
         for (size_t i = 0; i < m_pairs.size(); ++i)
@@ -73,7 +137,7 @@ public:
      * @param idx The column index.
      * @return Column value.
      */
-    [[nodiscard]] const std::any &get(uint32_t idx) const {
+    [[nodiscard]] const primitive &get(uint32_t idx) const {
         if (idx > m_pairs.size()) {
             throw ignite_error(
                 "Index is too large: idx=" + std::to_string(idx) + ", columns_num=" + std::to_string(m_pairs.size()));
@@ -84,13 +148,15 @@ public:
     /**
      * Gets the value of the specified column.
      *
-     * @tparam T Column type.
+     * @tparam T Column type. Can be a const reference to avoid copying.
      * @param idx The column index.
      * @return Column value.
+     *
+     * @throw ignite_error if the value is of another type or null.
      */
     template<typename T>
     [[nodiscard]] T get(uint32_t idx) const {
-        return std::any_cast<T>(get(idx));
+        return get(idx).get<T>();
     }
 
     /**
@@ -115,7 +181,7 @@ public:
      * @param name The column name.
      * @return Column value.
      */
-    [[nodiscard]] const std::any &get(std::string_view name) const {
+    [[nodiscard]] const primitive &get(std::string_view name) const {
         auto it = m_indices.find(parse_name(name));
         if (it == m_indices.end())
             throw ignite_error("Can not find column with the name '" + std::string(name) + "' in the tuple");
@@ -126,13 +192,15 @@ public:
     /**
      * Gets the value of the specified column.
      *
-     * @tparam T Column type.
+     * @tparam T Column type. Can be a const reference to avoid copying.
      * @param name The column name.
      * @return Column value.
+     *
+     * @throw ignite_error if the value is of another type or null.
      */
     template<typename T>
     [[nodiscard]] T get(std::string_view name) const {
-        return std::any_cast<T>(get(name));
+        return get(name).get<T>();
     }
 
     /**
@@ -191,9 +259,9 @@ private:
      * @param pairs Pairs.
      * @param indices Indices.
      */
-    ignite_tuple(std::vector<std::pair<std::string, std::any>> &&pairs, std::unordered_map<std::string, size_t> indices)
-        : m_pairs(std::move(pairs))
-        , m_indices(std::move(indices)) {}
+    ignite_tuple(std::vector<std::pair<std::string, primitive>> &&pairs, std::unordered_map<std::string, size_t> indices)
+        : m_pairs(std::make_move_iterator(pairs.begin()), std::make_move_iterator(pairs.end()))
+        , m_indices(indices.begin(), indices.end()) {}
 
     /**
      * Normalize column name.
@@ -218,11 +286,14 @@ private:
         return res;
     }
 
+    /** Memory arena. Declared first to outlive the containers allocated from it. */
+    std::shared_ptr<std::pmr::memory_resource> m_arena;
+
     /** Pairs of column names and values. */
-    std::vector<std::pair<std::string, std::any>> m_pairs;
+    std::pmr::vector<std::pair<std::string, primitive>> m_pairs;
 
     /** Indices of the columns corresponding to their names. */
-    std::unordered_map<std::string, size_t> m_indices;
+    std::pmr::unordered_map<std::string, size_t> m_indices;
 };
 
 } // namespace ignite
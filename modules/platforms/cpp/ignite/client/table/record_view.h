@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "ignite/client/table/binary_stream.h"
 #include "ignite/client/table/ignite_tuple.h"
 #include "ignite/client/transaction/transaction.h"
 
@@ -78,6 +79,9 @@ public:
     /**
      * Gets a record by key asynchronously.
      *
+     * Large BINARY and STRING values can be received in chunks by adding the
+     * columns to the key with a binary_sink as the value.
+     *
      * @param tx Optional transaction. If nullptr implicit transaction for this
      *   single operation is used.
      * @param key Key.
@@ -90,6 +94,9 @@ public:
     /**
      * Gets a record by key.
      *
+     * Large BINARY and STRING values can be received in chunks by adding the
+     * columns to the key with a binary_sink as the value.
+     *
      * @param tx Optional transaction. If nullptr implicit transaction for this
      *   single operation is used.
      * @param key Key.
@@ -136,6 +143,9 @@ public:
     /**
      * Inserts a record into the table if does not exist or replaces the existing one.
      *
+     * Large BINARY and STRING values can be written in chunks by using a
+     * binary_source as the column value.
+     *
      * @param tx Optional transaction. If nullptr implicit transaction for this
      *  single operation is used.
      * @param record A record to insert into the table. The record cannot be @c nullptr.
@@ -28,4 +28,51 @@ record_view<ignite_tuple> table::record_binary_view() const noexcept {
     return record_view<ignite_tuple>{m_impl};
 }
 
+/**
+ * Check scan options and throw an exception if they are invalid.
+ *
+ * @param options Scan options.
+ */
+void check_scan_options(const table_scan_options &options) {
+    if (options.page_size() <= 0)
+        throw ignite_error("Page size should be positive: " + std::to_string(options.page_size()));
+
+    if (options.window() <= 0)
+        throw ignite_error("Window should be positive: " + std::to_string(options.window()));
+}
+
+void table::get_partition_count_async(ignite_callback<std::int32_t> callback) const {
+    m_impl->get_partition_assignment_async(
+        [callback = std::move(callback)](ignite_result<std::shared_ptr<const detail::partition_assignment>> &&res) {
+            if (res.has_error()) {
+                callback({std::move(res).error()});
+                return;
+            }
+
+            callback(std::int32_t(res.value()->size()));
+        });
+}
+
+std::int32_t table::get_partition_count() const {
+    return sync<std::int32_t>([this](auto callback) { get_partition_count_async(std::move(callback)); });
+}
+
+void table::get_partition_async(const ignite_tuple &key, ignite_callback<std::int32_t> callback) const {
+    m_impl->get_partition_async(key, std::move(callback));
+}
+
+std::int32_t table::get_partition(const ignite_tuple &key) const {
+    return sync<std::int32_t>([this, &key](auto callback) { get_partition_async(key, std::move(callback)); });
+}
+
+void table::scan_async(const table_scan_options &options, ignite_callback<table_scan> callback) const {
+    check_scan_options(options);
+
+    m_impl->scan_async(options, std::move(callback));
+}
+
+table_scan table::scan(const table_scan_options &options) const {
+    return sync<table_scan>([this, &options](auto callback) { scan_async(options, std::move(callback)); });
+}
+
 } // namespace ignite
@@ -19,7 +19,10 @@
 
 #include "ignite/client/table/ignite_tuple.h"
 #include "ignite/client/table/record_view.h"
+#include "ignite/client/table/table_scan.h"
+#include "ignite/client/table/table_scan_options.h"
 #include "ignite/common/config.h"
+#include "ignite/common/ignite_result.h"
 
 #include <memory>
 #include <utility>
@@ -64,6 +67,61 @@ public:
      */
     [[nodiscard]] IGNITE_API record_view<ignite_tuple> record_binary_view() const noexcept;
 
+    /**
+     * Gets the number of partitions of the table asynchronously.
+     *
+     * @param callback Callback to be called with the number of partitions.
+     */
+    IGNITE_API void get_partition_count_async(ignite_callback<std::int32_t> callback) const;
+
+    /**
+     * Gets the number of partitions of the table.
+     *
+     * @return Number of partitions.
+     */
+    [[nodiscard]] IGNITE_API std::int32_t get_partition_count() const;
+
+    /**
+     * Gets the partition of the key asynchronously. The partition is computed by the client from the colocation
+     * columns of the key the same way as the server does, so no request is sent once the schema and the number of
+     * partitions are known.
+     *
+     * @param key Key. Should contain the colocation columns of the table.
+     * @param callback Callback to be called with the partition, from zero to get_partition_count() exclusive.
+     */
+    IGNITE_API void get_partition_async(const ignite_tuple &key, ignite_callback<std::int32_t> callback) const;
+
+    /**
+     * Gets the partition of the key.
+     *
+     * @see get_partition_async() for details.
+     *
+     * @param key Key.
+     * @return Partition.
+     */
+    [[nodiscard]] IGNITE_API std::int32_t get_partition(const ignite_tuple &key) const;
+
+    /**
+     * Scans the whole table asynchronously.
+     *
+     * The table is read with a single SQL cursor, page by page. See table_scan_options for the projection and the
+     * flow control of the scan.
+     *
+     * @param options Scan options.
+     * @param callback Callback to be called once the scan is started.
+     */
+    IGNITE_API void scan_async(const table_scan_options &options, ignite_callback<table_scan> callback) const;
+
+    /**
+     * Scans the whole table.
+     *
+     * @see scan_async() for details.
+     *
+     * @param options Scan options.
+     * @return Scan.
+     */
+    [[nodiscard]] IGNITE_API table_scan scan(const table_scan_options &options) const;
+
 private:
     /**
      * Constructor
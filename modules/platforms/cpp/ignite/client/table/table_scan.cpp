@@ -0,0 +1,46 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/client/table/table_scan.h"
+#include "ignite/client/detail/table/table_scan_impl.h"
+
+namespace ignite {
+
+bool table_scan::has_more_pages() const {
+    return m_impl->has_more_pages();
+}
+
+void table_scan::next_page_async(ignite_callback<std::optional<scan_page>> callback) {
+    m_impl->next_page_async(std::move(callback));
+}
+
+std::optional<scan_page> table_scan::next_page() {
+    if (!has_more_pages())
+        return std::nullopt;
+
+    return sync<std::optional<scan_page>>([this](auto callback) { next_page_async(std::move(callback)); });
+}
+
+void table_scan::close_async(ignite_callback<void> callback) {
+    m_impl->close_async(std::move(callback));
+}
+
+void table_scan::close() {
+    sync<void>([this](auto callback) { close_async(std::move(callback)); });
+}
+
+} // namespace ignite
@@ -0,0 +1,115 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/table/ignite_tuple.h"
+
+#include "ignite/common/config.h"
+#include "ignite/common/ignite_result.h"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace ignite {
+
+namespace detail {
+
+class table_impl;
+class table_scan_impl;
+
+} // namespace detail
+
+/**
+ * Page of the table scan.
+ */
+struct scan_page {
+    /** Rows. */
+    std::vector<ignite_tuple> rows;
+};
+
+/**
+ * Scan of the whole table.
+ *
+ * The pages are returned in the order the server reads them. The next pages are fetched in the background while the
+ * current ones are processed, up to the window of the scan options.
+ */
+class table_scan {
+    friend class detail::table_impl;
+
+public:
+    // Default
+    table_scan() = default;
+    ~table_scan() = default;
+    table_scan(table_scan &&) noexcept = default;
+    table_scan &operator=(table_scan &&) noexcept = default;
+
+    // Deleted
+    table_scan(const table_scan &) = delete;
+    table_scan &operator=(const table_scan &) = delete;
+
+    /**
+     * Check whether there can be more pages.
+     *
+     * @return @c false if the scan is complete.
+     */
+    [[nodiscard]] IGNITE_API bool has_more_pages() const;
+
+    /**
+     * Get the next page asynchronously. Only one page can be requested at a time.
+     *
+     * @param callback Callback to be called with the next page, or @c std::nullopt if the rest of the table turns out
+     *   to be empty.
+     */
+    IGNITE_API void next_page_async(ignite_callback<std::optional<scan_page>> callback);
+
+    /**
+     * Get the next page.
+     *
+     * @see next_page_async() for details.
+     *
+     * @return The next page, or @c std::nullopt if the scan is complete.
+     */
+    IGNITE_API std::optional<scan_page> next_page();
+
+    /**
+     * Close the scan asynchronously. Closes the cursor if it is still open.
+     *
+     * @param callback Callback to be called once the scan is closed.
+     */
+    IGNITE_API void close_async(ignite_callback<void> callback);
+
+    /**
+     * Close the scan.
+     */
+    IGNITE_API void close();
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param impl Implementation.
+     */
+    explicit table_scan(std::shared_ptr<detail::table_scan_impl> impl)
+        : m_impl(std::move(impl)) {}
+
+    /** Implementation. */
+    std::shared_ptr<detail::table_scan_impl> m_impl;
+};
+
+} // namespace ignite
@@ -0,0 +1,104 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ignite {
+
+/**
+ * Options of the table scan.
+ */
+class table_scan_options {
+public:
+    /** Default number of rows per page. */
+    static constexpr std::int32_t DEFAULT_PAGE_SIZE = 1024;
+
+    /** Default number of pages buffered ahead of the consumer. */
+    static constexpr std::int32_t DEFAULT_WINDOW = 8;
+
+    // Default
+    table_scan_options() = default;
+
+    /**
+     * Get the columns to read.
+     *
+     * @return Column names. Empty means all columns.
+     */
+    [[nodiscard]] const std::vector<std::string> &columns() const { return m_columns; }
+
+    /**
+     * Set the columns to read. Only these columns are transferred and present in the resulting tuples.
+     *
+     * @param columns Column names. Empty means all columns.
+     */
+    void set_columns(std::vector<std::string> columns) { m_columns = std::move(columns); }
+
+    /**
+     * Get the number of rows per page.
+     *
+     * @return Page size.
+     */
+    [[nodiscard]] std::int32_t page_size() const { return m_page_size; }
+
+    /**
+     * Set the number of rows per page.
+     *
+     * The default value is @c DEFAULT_PAGE_SIZE.
+     *
+     * @param page_size Page size. Should be positive.
+     */
+    void set_page_size(std::int32_t page_size) { m_page_size = page_size; }
+
+    /**
+     * Get the number of pages buffered ahead of the consumer.
+     *
+     * @return Window.
+     *
+     * @see set_window() for details.
+     */
+    [[nodiscard]] std::int32_t window() const { return m_window; }
+
+    /**
+     * Set the number of pages buffered ahead of the consumer.
+     *
+     * The scan stops requesting pages from the cursor once this number of pages is received and not yet consumed,
+     * and resumes as they are consumed. This hides the round trips to the server while bounding the memory used by
+     * the scan when the consumer is slower than the cluster.
+     *
+     * The default value is @c DEFAULT_WINDOW.
+     *
+     * @param window Window. Should be positive.
+     */
+    void set_window(std::int32_t window) { m_window = window; }
+
+private:
+    /** Columns. */
+    std::vector<std::string> m_columns;
+
+    /** Page size. */
+    std::int32_t m_page_size{DEFAULT_PAGE_SIZE};
+
+    /** Window. */
+    std::int32_t m_window{DEFAULT_WINDOW};
+};
+
+} // namespace ignite
@@ -0,0 +1,86 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ignite {
+
+/**
+ * Warm-up settings: what the client prepares before the start completes.
+ *
+ * By default, the start completes once the first connection is established, and the other connections, the tables
+ * and their schemas are loaded on first use, so the first requests take longer. With warm-up, the start waits for the
+ * minimum number of connections, and then resolves the listed tables and loads their latest schemas in parallel.
+ * With read_mode::PRIMARY, the partition assignments of the tables are loaded as well. The first lookup of each of
+ * the listed tables returns it ready for requests right away; the later lookups ask the server again, so a table
+ * that is dropped or re-created after the start is never served from the warm-up.
+ *
+ * The start fails if a listed table does not exist, and the warm-up counts towards the start timeout.
+ */
+class warmup {
+public:
+    // Default
+    warmup() = default;
+
+    /**
+     * Get minimum number of connections to establish before the start completes.
+     *
+     * The value is limited by the number of the configured addresses and by the connection limit.
+     *
+     * The default value is 1.
+     *
+     * @return Minimum number of connections.
+     */
+    [[nodiscard]] std::uint32_t get_min_connections() const { return m_min_connections; }
+
+    /**
+     * Set minimum number of connections to establish before the start completes.
+     *
+     * @param min_connections Minimum number of connections.
+     */
+    void set_min_connections(std::uint32_t min_connections) { m_min_connections = min_connections; }
+
+    /**
+     * Get names of the tables to load before the start completes.
+     *
+     * The default value is an empty list.
+     *
+     * @return Table names.
+     */
+    [[nodiscard]] const std::vector<std::string> &get_tables() const { return m_tables; }
+
+    /**
+     * Set names of the tables to load before the start completes.
+     *
+     * @param tables Table names.
+     */
+    void set_tables(std::vector<std::string> tables) { m_tables = std::move(tables); }
+
+private:
+    /** Minimum number of connections. */
+    std::uint32_t m_min_connections{1};
+
+    /** Table names. */
+    std::vector<std::string> m_tables;
+};
+
+} // namespace ignite
@@ -0,0 +1,79 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+
+namespace ignite {
+
+/**
+ * Monotonic memory arena.
+ *
+ * Memory is allocated from large blocks and is only released when the arena is destroyed, which makes allocation
+ * of many short-lived objects of the same lifetime cheap. Unlike std::pmr::monotonic_buffer_resource, the arena can
+ * be used from several threads.
+ */
+class arena final : public std::pmr::memory_resource {
+public:
+    /**
+     * Constructor.
+     *
+     * @param initial_size Size of the first block.
+     */
+    explicit arena(std::size_t initial_size = 0x1000)
+        : m_resource(initial_size) {}
+
+private:
+    /**
+     * Allocate memory.
+     *
+     * @param bytes Size.
+     * @param alignment Alignment.
+     * @return Memory.
+     */
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        return m_resource.allocate(bytes, alignment);
+    }
+
+    /**
+     * Deallocate memory. Does nothing, as the memory is released with the arena.
+     */
+    void do_deallocate(void *, std::size_t, std::size_t) override {}
+
+    /**
+     * Compare with other resource.
+     *
+     * @param other Other resource.
+     * @return @c true if the memory allocated from one resource can be released with the other.
+     */
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+
+    /** Mutex. */
+    std::mutex m_mutex;
+
+    /** Underlying resource. */
+    std::pmr::monotonic_buffer_resource m_resource;
+};
+
+} // namespace ignite
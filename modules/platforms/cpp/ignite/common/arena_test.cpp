@@ -0,0 +1,62 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arena.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace ignite;
+
+TEST(arena, containers_allocate_from_arena) {
+    arena mem;
+
+    std::pmr::vector<std::int64_t> vec(&mem);
+    for (std::int64_t i = 0; i < 10000; ++i)
+        vec.push_back(i);
+
+    EXPECT_EQ(10000u, vec.size());
+    EXPECT_EQ(9999, vec.back());
+    EXPECT_EQ(&mem, vec.get_allocator().resource());
+}
+
+TEST(arena, concurrent_allocation) {
+    arena mem(16);
+
+    std::vector<std::thread> threads;
+    std::vector<std::vector<std::int32_t *>> ptrs(4);
+    for (std::size_t t = 0; t < ptrs.size(); ++t) {
+        threads.emplace_back([&mem, &res = ptrs[t], t] {
+            for (std::int32_t i = 0; i < 1000; ++i) {
+                auto ptr = static_cast<std::int32_t *>(mem.allocate(sizeof(std::int32_t), alignof(std::int32_t)));
+                *ptr = std::int32_t(t) * 1000 + i;
+                res.push_back(ptr);
+            }
+        });
+    }
+
+    for (auto &thread : threads)
+        thread.join();
+
+    for (std::size_t t = 0; t < ptrs.size(); ++t) {
+        for (std::int32_t i = 0; i < 1000; ++i)
+            EXPECT_EQ(std::int32_t(t) * 1000 + i, *ptrs[t][i]);
+    }
+}
@@ -0,0 +1,203 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "bytes.h"
+#include "bytes_view.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace ignite {
+
+/**
+ * MurmurHash3 functions, compatible with the HashUtils of the server.
+ *
+ * The 128-bit x64 variant of the hash is computed, and its first 64-bit half is folded into 32 bits. The input is
+ * read in 64-bit little-endian words. Fixed-size values are hashed as their little-endian representation, without
+ * storing them to memory.
+ */
+namespace hash_utils {
+
+namespace detail {
+
+constexpr std::uint64_t C1 = 0x87c37b91114253d5ULL;
+constexpr std::uint64_t C2 = 0x4cf5ad432745937fULL;
+
+constexpr std::uint64_t rotl64(std::uint64_t x, int r) noexcept {
+    return (x << r) | (x >> (64 - r));
+}
+
+constexpr std::uint64_t fmix64(std::uint64_t k) noexcept {
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+    return k;
+}
+
+constexpr std::uint64_t mix_k1(std::uint64_t k1) noexcept {
+    k1 *= C1;
+    k1 = rotl64(k1, 31);
+    k1 *= C2;
+    return k1;
+}
+
+constexpr std::uint64_t mix_k2(std::uint64_t k2) noexcept {
+    k2 *= C2;
+    k2 = rotl64(k2, 33);
+    k2 *= C1;
+    return k2;
+}
+
+/**
+ * Mix a full 16-byte block into the state.
+ */
+constexpr void mix_block(std::uint64_t &h1, std::uint64_t &h2, std::uint64_t k1, std::uint64_t k2) noexcept {
+    h1 ^= mix_k1(k1);
+    h1 = rotl64(h1, 27);
+    h1 += h2;
+    h1 = h1 * 5 + 0x52dce729;
+
+    h2 ^= mix_k2(k2);
+    h2 = rotl64(h2, 31);
+    h2 += h1;
+    h2 = h2 * 5 + 0x38495ab5;
+}
+
+/**
+ * Finalize the state and fold it into 32 bits.
+ */
+constexpr std::int32_t finish(std::uint64_t h1, std::uint64_t h2, std::uint64_t len) noexcept {
+    h1 ^= len;
+    h2 ^= len;
+
+    h1 += h2;
+    h2 += h1;
+
+    h1 = fmix64(h1);
+    h2 = fmix64(h2);
+
+    h1 += h2;
+
+    return std::int32_t(h1 ^ (h1 >> 32));
+}
+
+/**
+ * Hash up to 8 bytes passed as a little-endian word.
+ *
+ * Unlike for the byte arrays, the server sign-extends the seed of the fixed-size values to 64 bits.
+ */
+constexpr std::int32_t hash32_word(std::uint64_t word, std::uint64_t len, std::int32_t seed) noexcept {
+    std::uint64_t h1 = std::uint64_t(std::int64_t(seed));
+    std::uint64_t h2 = h1;
+
+    h1 ^= mix_k1(word);
+
+    return finish(h1, h2, len);
+}
+
+/**
+ * Load up to 8 bytes as a little-endian word.
+ */
+inline std::uint64_t load_tail(const std::byte *data, std::size_t len) noexcept {
+    std::byte buf[8]{};
+    std::memcpy(buf, data, len);
+    return bytes::load<endian::LITTLE, std::uint64_t>(buf);
+}
+
+} // namespace detail
+
+/**
+ * Hash bytes.
+ *
+ * @param data Data.
+ * @param seed Seed.
+ * @return Hash.
+ */
+inline std::int32_t hash32(bytes_view data, std::int32_t seed) noexcept {
+    // The seed is used as an unsigned 32-bit value, as the server does.
+    std::uint64_t h1 = std::uint32_t(seed);
+    std::uint64_t h2 = h1;
+
+    const std::byte *ptr = data.data();
+    std::size_t left = data.size();
+    for (; left >= 16; ptr += 16, left -= 16) {
+        auto k1 = bytes::load<endian::LITTLE, std::uint64_t>(ptr);
+        auto k2 = bytes::load<endian::LITTLE, std::uint64_t>(ptr + 8);
+        detail::mix_block(h1, h2, k1, k2);
+    }
+
+    if (left > 8)
+        h2 ^= detail::mix_k2(detail::load_tail(ptr + 8, left - 8));
+
+    if (left > 0)
+        h1 ^= detail::mix_k1(detail::load_tail(ptr, left < 8 ? left : 8));
+
+    return detail::finish(h1, h2, data.size());
+}
+
+/**
+ * Hash a byte.
+ *
+ * @param value Value.
+ * @param seed Seed.
+ * @return Hash.
+ */
+constexpr std::int32_t hash32(std::int8_t value, std::int32_t seed) noexcept {
+    return detail::hash32_word(std::uint8_t(value), 1, seed);
+}
+
+/**
+ * Hash a short.
+ *
+ * @param value Value.
+ * @param seed Seed.
+ * @return Hash.
+ */
+constexpr std::int32_t hash32(std::int16_t value, std::int32_t seed) noexcept {
+    return detail::hash32_word(std::uint16_t(value), 2, seed);
+}
+
+/**
+ * Hash an int.
+ *
+ * @param value Value.
+ * @param seed Seed.
+ * @return Hash.
+ */
+constexpr std::int32_t hash32(std::int32_t value, std::int32_t seed) noexcept {
+    return detail::hash32_word(std::uint32_t(value), 4, seed);
+}
+
+/**
+ * Hash a long.
+ *
+ * @param value Value.
+ * @param seed Seed.
+ * @return Hash.
+ */
+constexpr std::int32_t hash32(std::int64_t value, std::int32_t seed) noexcept {
+    return detail::hash32_word(std::uint64_t(value), 8, seed);
+}
+
+} // namespace hash_utils
+
+} // namespace ignite
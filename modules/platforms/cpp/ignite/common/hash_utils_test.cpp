@@ -0,0 +1,101 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hash_utils.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+
+using namespace ignite;
+
+namespace {
+
+std::int32_t hash_string(std::string_view str, std::int32_t seed) {
+    return hash_utils::hash32(bytes_view{reinterpret_cast<const std::byte *>(str.data()), str.size()}, seed);
+}
+
+template<typename T>
+std::int32_t hash_little_endian(T value, std::int32_t seed) {
+    std::byte buf[sizeof(T)];
+    bytes::store<endian::LITTLE>(buf, value);
+    return hash_utils::hash32(bytes_view{buf, sizeof(T)}, seed);
+}
+
+} // namespace
+
+TEST(hash_utils, ReferenceValues) {
+    // Lower halves of the MurmurHash3 x64 128-bit hash, folded to 32 bits.
+    EXPECT_EQ(-1973076815, hash_string("hello", 0));
+    EXPECT_EQ(1598859031, hash_string("The quick brown fox jumps over the lazy dog", 0));
+    EXPECT_EQ(0, hash_string("", 0));
+}
+
+TEST(hash_utils, TailLengths) {
+    std::string str;
+    for (int i = 0; i < 40; ++i) {
+        auto hash = hash_string(str, 0);
+        EXPECT_EQ(hash, hash_string(str, 0));
+        EXPECT_NE(hash, hash_string(str, 1));
+        str.push_back(char('a' + i % 26));
+    }
+}
+
+TEST(hash_utils, WordsMatchBytes) {
+    // The byte arrays take the seed as unsigned, so the paths only agree for the non-negative seeds.
+    for (std::int32_t seed : {0, 1, 0x12345678, INT32_MAX}) {
+        for (std::int64_t value : {std::int64_t(0), std::int64_t(-1), std::int64_t(0x0102030405060708), INT64_MIN}) {
+            EXPECT_EQ(hash_little_endian(std::int8_t(value), seed), hash_utils::hash32(std::int8_t(value), seed));
+            EXPECT_EQ(hash_little_endian(std::int16_t(value), seed), hash_utils::hash32(std::int16_t(value), seed));
+            EXPECT_EQ(hash_little_endian(std::int32_t(value), seed), hash_utils::hash32(std::int32_t(value), seed));
+            EXPECT_EQ(hash_little_endian(value, seed), hash_utils::hash32(value, seed));
+        }
+    }
+}
+
+TEST(hash_utils, JavaReferenceValues) {
+    // Values of HashUtils.hash32() of the server.
+    struct reference {
+        std::int32_t seed;
+        std::int32_t int8;
+        std::int32_t int16;
+        std::int32_t int32;
+        std::int32_t int64;
+        std::int32_t bytes;
+    };
+
+    const reference refs[] = {
+        {0, -252155722, 858110652, 541773785, 1682067167, -1973076815},
+        {-1, -361999699, 1140657925, -1630934428, -518625297, -483593375},
+        {0x12345678, -1940761241, 1613799452, -785191830, 2129005587, 1333639539},
+        {-559038737, 1524898785, -1751320898, -368835047, -2139770209, 2123704877},
+    };
+
+    for (const auto &ref : refs) {
+        EXPECT_EQ(ref.int8, hash_utils::hash32(std::int8_t(-7), ref.seed));
+        EXPECT_EQ(ref.int16, hash_utils::hash32(std::int16_t(1000), ref.seed));
+        EXPECT_EQ(ref.int32, hash_utils::hash32(std::int32_t(-100000), ref.seed));
+        EXPECT_EQ(ref.int64, hash_utils::hash32(std::int64_t(1) << 40, ref.seed));
+        EXPECT_EQ(ref.bytes, hash_string("hello", ref.seed));
+    }
+}
+
+TEST(hash_utils, Constexpr) {
+    static_assert(hash_utils::hash32(std::int32_t(42), 0) == hash_utils::hash32(std::int32_t(42), 0));
+    EXPECT_NE(hash_utils::hash32(std::int32_t(42), 0), hash_utils::hash32(std::int64_t(42), 0));
+}
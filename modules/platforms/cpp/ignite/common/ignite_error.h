@@ -36,6 +36,8 @@ enum class status_code : std::int32_t {
     NETWORK,
 
     OS,
+
+    BACKPRESSURE,
 };
 
 /**
@@ -52,6 +52,14 @@ public:
      */
     virtual void stop() = 0;
 
+    /**
+     * Replace the addresses to connect to. Connections to the new addresses are established in the background,
+     * and established connections to the addresses that are no longer in the list are closed.
+     *
+     * @param addrs Addresses to connect to.
+     */
+    virtual void update_addresses(std::vector<tcp_range> addrs) = 0;
+
     /**
      * Set handler.
      *
@@ -41,6 +41,10 @@ void async_client_pool_adapter::stop() {
     m_pool->stop();
 }
 
+void async_client_pool_adapter::update_addresses(std::vector<tcp_range> addrs) {
+    m_pool->update_addresses(std::move(addrs));
+}
+
 void async_client_pool_adapter::set_handler(std::weak_ptr<async_handler> handler) {
     auto handler0 = std::move(handler);
     for (auto it = m_filters.rbegin(); it != m_filters.rend(); ++it) {
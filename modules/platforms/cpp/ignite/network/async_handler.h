@@ -74,6 +74,27 @@ public:
      * @param id Async client ID.
      */
     virtual void on_message_sent(uint64_t id) = 0;
+
+    /**
+     * Callback that called when the send queue of the connection reaches the high watermark, and when it drains to
+     * the low watermark again. The pool rejects data sent while the queue is saturated.
+     *
+     * @param id Async client ID.
+     * @param saturated @c true if the queue has become saturated.
+     */
+    virtual void on_send_queue_saturation(uint64_t id, bool saturated) {
+        (void) id;
+        (void) saturated;
+    }
+
+    /**
+     * Callback that called when the total size of the send queues of all the connections reaches the high watermark,
+     * and when it drains to the low watermark again. The pool rejects data sent over any connection while the total
+     * size is saturated.
+     *
+     * @param saturated @c true if the total size has become saturated.
+     */
+    virtual void on_total_send_queue_saturation(bool saturated) { (void) saturated; }
 };
 
 } // namespace ignite::network
@@ -21,8 +21,7 @@ namespace ignite::network {
 
 codec_data_filter::codec_data_filter(std::shared_ptr<factory<codec>> factory)
     : m_codec_factory(std::move(factory))
-    , m_codecs()
-    , m_codecs_mutex() {
+    , m_codecs() {
 }
 
 bool codec_data_filter::send(uint64_t id, std::vector<std::byte> &&data) {
@@ -45,22 +44,13 @@ bool codec_data_filter::send(uint64_t id, std::vector<std::byte> &&data) {
 }
 
 void codec_data_filter::on_connection_success(const end_point &addr, uint64_t id) {
-    {
-        std::lock_guard<std::mutex> lock(m_codecs_mutex);
-
-        std::shared_ptr<codec> codec(m_codec_factory->build());
-        m_codecs.insert(std::make_pair(id, codec));
-    }
+    m_codecs.insert(id, std::shared_ptr<codec>(m_codec_factory->build()));
 
     data_filter_adapter::on_connection_success(addr, id);
 }
 
 void codec_data_filter::on_connection_closed(uint64_t id, std::optional<ignite_error> err) {
-    {
-        std::lock_guard<std::mutex> lock(m_codecs_mutex);
-
-        m_codecs.erase(id);
-    }
+    m_codecs.erase(id);
 
     data_filter_adapter::on_connection_closed(id, std::move(err));
 }
@@ -82,13 +72,7 @@ void codec_data_filter::on_message_received(uint64_t id, bytes_view msg) {
 }
 
 std::shared_ptr<codec> codec_data_filter::find_codec(uint64_t id) {
-    std::lock_guard<std::mutex> lock(m_codecs_mutex);
-
-    auto it = m_codecs.find(id);
-    if (it == m_codecs.end())
-        return {};
-
-    return it->second;
+    return m_codecs.find(id);
 }
 
 } // namespace ignite::network
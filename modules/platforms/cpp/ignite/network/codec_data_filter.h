@@ -19,9 +19,8 @@
 
 #include <ignite/network/codec.h>
 #include <ignite/network/data_filter_adapter.h>
+#include <ignite/network/detail/connection_table.h>
 
-#include <map>
-#include <mutex>
 #include <optional>
 
 namespace ignite::network {
@@ -75,7 +74,7 @@ public:
 
 private:
     /**
-     * Get codec for connection.
+     * Get codec for connection. Lock-free.
      *
      * @param id Connection ID.
      * @return Codec if found or null.
@@ -86,10 +85,7 @@ private:
     std::shared_ptr<factory<codec>> m_codec_factory;
 
     /** Codecs. */
-    std::map<uint64_t, std::shared_ptr<codec>> m_codecs;
-
-    /** Mutex for secure access to codecs map. */
-    std::mutex m_codecs_mutex;
+    detail::connection_table<codec> m_codecs;
 };
 
 } // namespace ignite::network
@@ -108,6 +108,27 @@ public:
         if (auto handler = m_handler.lock())
             handler->on_message_sent(id);
     }
+
+    /**
+     * Callback that called when the send queue of the connection becomes saturated or drains.
+     *
+     * @param id Async client ID.
+     * @param saturated @c true if the queue has become saturated.
+     */
+    void on_send_queue_saturation(uint64_t id, bool saturated) override {
+        if (auto handler = m_handler.lock())
+            handler->on_send_queue_saturation(id, saturated);
+    }
+
+    /**
+     * Callback that called when the total size of the send queues becomes saturated or drains.
+     *
+     * @param saturated @c true if the total size has become saturated.
+     */
+    void on_total_send_queue_saturation(bool saturated) override {
+        if (auto handler = m_handler.lock())
+            handler->on_total_send_queue_saturation(saturated);
+    }
 };
 
 } // namespace ignite::network
@@ -0,0 +1,259 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ignite::network::detail {
+
+/**
+ * Connection table with lock-free lookup by connection ID.
+ *
+ * Entries live in an immutable snapshot sorted by ID. Readers only announce themselves in one of two reader counters
+ * and load the current snapshot, so a lookup never blocks. Writers are serialized, publish a modified copy of the
+ * snapshot and wait until no reader can hold the previous one before releasing it. Connections are added and removed
+ * rarely compared to the lookups made for every message, so the copying is cheap.
+ *
+ * @tparam T Value type.
+ */
+template<typename T>
+class connection_table {
+public:
+    /** Value pointer type. */
+    typedef std::shared_ptr<T> value_ptr;
+
+    // Default
+    connection_table() = default;
+
+    // Deleted
+    connection_table(const connection_table &) = delete;
+    connection_table &operator=(const connection_table &) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~connection_table() { delete m_current.load(); }
+
+    /**
+     * Find value by ID. Lock-free.
+     *
+     * @param id Connection ID.
+     * @return Value. Null pointer if is not found.
+     */
+    [[nodiscard]] value_ptr find(std::uint64_t id) const {
+        read_guard guard(*this);
+
+        const auto &entries = *m_current.load();
+        auto it = std::lower_bound(entries.begin(), entries.end(), id, id_less{});
+        if (it == entries.end() || it->first != id)
+            return {};
+
+        return it->second;
+    }
+
+    /**
+     * Get all values. Lock-free.
+     *
+     * @return Values in ID order.
+     */
+    [[nodiscard]] std::vector<value_ptr> values() const {
+        read_guard guard(*this);
+
+        const auto &entries = *m_current.load();
+
+        std::vector<value_ptr> res;
+        res.reserve(entries.size());
+        for (const auto &entry : entries)
+            res.push_back(entry.second);
+
+        return res;
+    }
+
+    /**
+     * Get number of entries. Lock-free.
+     *
+     * @return Number of entries.
+     */
+    [[nodiscard]] std::size_t size() const {
+        read_guard guard(*this);
+
+        return m_current.load()->size();
+    }
+
+    /**
+     * Insert value or replace the existing one.
+     *
+     * @param id Connection ID.
+     * @param value Value.
+     * @return Replaced value. Null pointer if there was none.
+     */
+    value_ptr insert(std::uint64_t id, value_ptr value) {
+        value_ptr old;
+        modify([&](entries_type &entries) {
+            auto it = std::lower_bound(entries.begin(), entries.end(), id, id_less{});
+            if (it != entries.end() && it->first == id)
+                old = std::exchange(it->second, std::move(value));
+            else
+                entries.emplace(it, id, std::move(value));
+        });
+
+        return old;
+    }
+
+    /**
+     * Remove value.
+     *
+     * @param id Connection ID.
+     * @return Removed value. Null pointer if is not found.
+     */
+    value_ptr erase(std::uint64_t id) {
+        value_ptr old;
+        modify([&](entries_type &entries) {
+            auto it = std::lower_bound(entries.begin(), entries.end(), id, id_less{});
+            if (it == entries.end() || it->first != id)
+                return;
+
+            old = std::move(it->second);
+            entries.erase(it);
+        });
+
+        return old;
+    }
+
+    /**
+     * Remove all values.
+     *
+     * @return Removed values in ID order.
+     */
+    std::vector<value_ptr> clear() {
+        std::vector<value_ptr> res;
+        modify([&](entries_type &entries) {
+            res.reserve(entries.size());
+            for (auto &entry : entries)
+                res.push_back(std::move(entry.second));
+
+            entries.clear();
+        });
+
+        return res;
+    }
+
+private:
+    /** Snapshot entries. */
+    typedef std::vector<std::pair<std::uint64_t, value_ptr>> entries_type;
+
+    /**
+     * Entry comparator.
+     */
+    struct id_less {
+        bool operator()(const typename entries_type::value_type &entry, std::uint64_t id) const {
+            return entry.first < id;
+        }
+    };
+
+    /**
+     * Reader counter. Aligned to avoid false sharing of the two counters.
+     */
+    struct alignas(64) reader_counter {
+        /** Number of active readers. */
+        std::atomic<std::uint32_t> value{0};
+    };
+
+    /**
+     * Reader section guard.
+     */
+    class read_guard {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param table Table.
+         */
+        explicit read_guard(const connection_table &table)
+            : m_counter(table.m_readers[table.m_epoch.load()].value) {
+            m_counter.fetch_add(1);
+        }
+
+        /**
+         * Destructor.
+         */
+        ~read_guard() { m_counter.fetch_sub(1); }
+
+        // Deleted
+        read_guard(const read_guard &) = delete;
+        read_guard &operator=(const read_guard &) = delete;
+
+    private:
+        /** Counter. */
+        std::atomic<std::uint32_t> &m_counter;
+    };
+
+    /**
+     * Publish the modified copy of the current snapshot and release the previous one once no reader holds it.
+     *
+     * @param func Function that modifies entries.
+     */
+    template<typename F>
+    void modify(F &&func) {
+        std::lock_guard<std::mutex> lock(m_write_mutex);
+
+        auto updated = std::make_unique<entries_type>(*m_current.load());
+        func(*updated);
+
+        std::unique_ptr<const entries_type> old(m_current.exchange(updated.release()));
+        wait_for_readers();
+    }
+
+    /**
+     * Wait until every reader that could have loaded the previous snapshot leaves.
+     *
+     * The epoch is flipped before waiting for each counter, so new readers go to the other counter and the waited one
+     * only drains. A reader that registers in the drained counter after the wait loads the new snapshot.
+     */
+    void wait_for_readers() {
+        for (int i = 0; i < 2; ++i) {
+            auto epoch = m_epoch.load();
+            m_epoch.store(epoch ^ 1);
+
+            while (m_readers[epoch].value.load() != 0)
+                std::this_thread::yield();
+        }
+    }
+
+    /** Current snapshot. */
+    std::atomic<const entries_type *> m_current{new entries_type()};
+
+    /** Reader epoch. Selects the counter new readers register in. */
+    std::atomic<std::uint32_t> m_epoch{0};
+
+    /** Reader counters. */
+    mutable std::array<reader_counter, 2> m_readers{};
+
+    /** Writers mutex. */
+    std::mutex m_write_mutex;
+};
+
+} // namespace ignite::network::detail
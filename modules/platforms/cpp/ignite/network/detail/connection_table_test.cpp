@@ -0,0 +1,107 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "connection_table.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace ignite::network::detail;
+
+TEST(connection_table, insert_find_erase) {
+    connection_table<int> table;
+
+    EXPECT_EQ(nullptr, table.find(1));
+
+    EXPECT_EQ(nullptr, table.insert(2, std::make_shared<int>(20)));
+    EXPECT_EQ(nullptr, table.insert(1, std::make_shared<int>(10)));
+    EXPECT_EQ(2, table.size());
+
+    EXPECT_EQ(10, *table.find(1));
+    EXPECT_EQ(20, *table.find(2));
+    EXPECT_EQ(nullptr, table.find(3));
+
+    auto replaced = table.insert(2, std::make_shared<int>(21));
+    ASSERT_NE(nullptr, replaced);
+    EXPECT_EQ(20, *replaced);
+    EXPECT_EQ(21, *table.find(2));
+
+    auto removed = table.erase(1);
+    ASSERT_NE(nullptr, removed);
+    EXPECT_EQ(10, *removed);
+    EXPECT_EQ(1, removed.use_count());
+    EXPECT_EQ(nullptr, table.find(1));
+    EXPECT_EQ(nullptr, table.erase(1));
+
+    auto values = table.clear();
+    ASSERT_EQ(1, values.size());
+    EXPECT_EQ(21, *values[0]);
+    EXPECT_EQ(0, table.size());
+}
+
+TEST(connection_table, values_in_id_order) {
+    connection_table<std::uint64_t> table;
+
+    for (std::uint64_t id : {5, 3, 9, 1})
+        table.insert(id, std::make_shared<std::uint64_t>(id));
+
+    auto values = table.values();
+    ASSERT_EQ(4, values.size());
+    EXPECT_EQ(1, *values[0]);
+    EXPECT_EQ(3, *values[1]);
+    EXPECT_EQ(5, *values[2]);
+    EXPECT_EQ(9, *values[3]);
+}
+
+TEST(connection_table, concurrent_lookup) {
+    constexpr std::uint64_t IDS = 16;
+    constexpr int ROUNDS = 2000;
+
+    connection_table<std::uint64_t> table;
+    std::atomic_bool stop{false};
+    std::atomic_bool mismatch{false};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 3; ++i) {
+        readers.emplace_back([&] {
+            while (!stop.load()) {
+                for (std::uint64_t id = 0; id < IDS; ++id) {
+                    auto value = table.find(id);
+                    if (value && *value != id)
+                        mismatch.store(true);
+                }
+            }
+        });
+    }
+
+    for (int round = 0; round < ROUNDS; ++round) {
+        auto id = std::uint64_t(round) % IDS;
+        table.insert(id, std::make_shared<std::uint64_t>(id));
+
+        auto removed = table.erase((id + IDS / 2) % IDS);
+        if (removed) {
+            EXPECT_EQ((id + IDS / 2) % IDS, *removed);
+        }
+    }
+
+    stop.store(true);
+    for (auto &reader : readers)
+        reader.join();
+
+    EXPECT_FALSE(mismatch.load());
+}
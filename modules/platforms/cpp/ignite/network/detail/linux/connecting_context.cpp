@@ -17,6 +17,7 @@
 
 #include "connecting_context.h"
 
+#include <cstddef>
 #include <cstring>
 #include <iterator>
 
@@ -41,9 +42,9 @@ void connecting_context::reset() {
     if (m_info) {
         freeaddrinfo(m_info);
         m_info = nullptr;
-        m_current_info = nullptr;
     }
 
+    m_current_info = nullptr;
     m_next_port = m_range.port;
 }
 
@@ -60,6 +61,16 @@ addrinfo *connecting_context::next() {
         if (m_next_port > m_range.port + m_range.range)
             return nullptr;
 
+        if (m_range.is_unix_socket()) {
+            if (!resolve_unix_socket())
+                return nullptr;
+
+            m_current_info = &m_unix_info;
+            ++m_next_port;
+
+            continue;
+        }
+
         addrinfo hints{};
         std::memset(&hints, 0, sizeof(hints));
 
@@ -81,6 +92,25 @@ addrinfo *connecting_context::next() {
     return m_current_info;
 }
 
+bool connecting_context::resolve_unix_socket() {
+    auto path = m_range.unix_socket_path();
+    if (path.empty() || path.size() >= sizeof(m_unix_addr.sun_path))
+        return false;
+
+    std::memset(&m_unix_addr, 0, sizeof(m_unix_addr));
+    m_unix_addr.sun_family = AF_UNIX;
+    std::memcpy(m_unix_addr.sun_path, path.data(), path.size());
+
+    std::memset(&m_unix_info, 0, sizeof(m_unix_info));
+    m_unix_info.ai_family = AF_UNIX;
+    m_unix_info.ai_socktype = SOCK_STREAM;
+    m_unix_info.ai_protocol = 0;
+    m_unix_info.ai_addr = reinterpret_cast<sockaddr *>(&m_unix_addr);
+    m_unix_info.ai_addrlen = socklen_t(offsetof(sockaddr_un, sun_path) + path.size() + 1);
+
+    return true;
+}
+
 end_point connecting_context::current_address() const {
     if (!m_current_info)
         throw ignite_error("There is no current address");
@@ -26,6 +26,7 @@
 #include <memory>
 
 #include <netdb.h>
+#include <sys/un.h>
 
 namespace ignite::network::detail {
 
@@ -67,6 +68,13 @@ public:
      */
     end_point current_address() const;
 
+    /**
+     * Get range.
+     *
+     * @return Range.
+     */
+    [[nodiscard]] const tcp_range &get_range() const { return m_range; }
+
     /**
      * Make client.
      *
@@ -76,6 +84,13 @@ public:
     std::shared_ptr<linux_async_client> to_client(int fd);
 
 private:
+    /**
+     * Fill address info for the Unix domain socket of the range.
+     *
+     * @return @c true on success and @c false if the path is not a valid socket path.
+     */
+    bool resolve_unix_socket();
+
     /** Range. */
     tcp_range m_range;
 
@@ -87,6 +102,12 @@ private:
 
     /** Address info which is currently used for connection */
     addrinfo *m_current_info;
+
+    /** Address info for a Unix domain socket. Not allocated by getaddrinfo, so never freed. */
+    addrinfo m_unix_info{};
+
+    /** Unix domain socket address. */
+    sockaddr_un m_unix_addr{};
 };
 
 } // namespace ignite::network::detail
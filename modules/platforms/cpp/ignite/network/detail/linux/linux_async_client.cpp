@@ -21,11 +21,15 @@
 #include "sockets.h"
 
 #include <algorithm>
+#include <cerrno>
 #include <cstring>
 
+#include <linux/errqueue.h>
+#include <netinet/in.h>
 #include <sys/epoll.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 namespace ignite::network::detail {
@@ -47,6 +51,10 @@ linux_async_client::~linux_async_client() {
     shutdown(std::nullopt);
 
     close();
+
+    // Data can be sent after the client is closed and before it is removed from the pool.
+    if (m_limiter)
+        m_limiter->release_all(m_send_queue);
 }
 
 bool linux_async_client::shutdown(std::optional<ignite_error> err) {
@@ -70,6 +78,10 @@ bool linux_async_client::close() {
     m_fd = -1;
     m_state = state::CLOSED;
 
+    // Queued data is dropped.
+    if (m_limiter && m_limiter->release_all(m_send_queue))
+        m_send_queue_drained.store(true);
+
     return true;
 }
 
@@ -83,22 +95,182 @@ bool linux_async_client::send(std::vector<std::byte> &&data) {
     return send_next_packet_locked();
 }
 
+bool linux_async_client::flush_submissions() {
+    std::lock_guard<std::mutex> lock(m_send_mutex);
+
+    bool in_progress = !m_send_packets.empty();
+    m_submissions.consume_all([this](std::vector<std::byte> &&data) { m_send_packets.emplace_back(std::move(data)); });
+
+    // If there is a send in progress, the rest is sent when the socket becomes writable.
+    if (in_progress)
+        return true;
+
+    return send_next_packet_locked();
+}
+
 bool linux_async_client::send_next_packet_locked() {
     if (m_send_packets.empty())
         return true;
 
+    auto is_zero_copy = [this](const data_buffer_owning &packet) {
+        return m_zero_copy_threshold && packet.get_bytes_view().size() >= m_zero_copy_threshold;
+    };
+
+    if (is_zero_copy(m_send_packets.front()))
+        return send_zero_copy_locked();
+
+    iovec iov[MAX_SEND_BATCH];
+    size_t iov_cnt = 0;
+    for (const auto &packet : m_send_packets) {
+        if (iov_cnt == MAX_SEND_BATCH || is_zero_copy(packet))
+            break;
+
+        auto data_view = packet.get_bytes_view();
+        iov[iov_cnt].iov_base = const_cast<std::byte *>(data_view.data());
+        iov[iov_cnt].iov_len = data_view.size();
+        ++iov_cnt;
+    }
+
+    msghdr msg{};
+    msg.msg_iov = iov;
+    msg.msg_iovlen = iov_cnt;
+
+    int flags = m_use_msg_more && iov_cnt < m_send_packets.size() ? MSG_MORE : 0;
+
+    ssize_t ret = ::sendmsg(m_fd, &msg, flags);
+    if (ret < 0) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+            return false;
+
+        ret = 0;
+    }
+
+    auto sent = size_t(ret);
+    release_send_queue(sent);
+
+    while (sent && !m_send_packets.empty()) {
+        auto &packet = m_send_packets.front();
+        auto packet_size = packet.get_bytes_view().size();
+        if (sent < packet_size) {
+            packet.skip(sent);
+            break;
+        }
+
+        sent -= packet_size;
+        m_send_packets.pop_front();
+    }
+
+    enable_send_notifications();
+
+    return true;
+}
+
+bool linux_async_client::send_zero_copy_locked() {
+#ifdef MSG_ZEROCOPY
     auto &packet = m_send_packets.front();
-    auto dataView = packet.get_bytes_view();
+    auto data_view = packet.get_bytes_view();
 
-    ssize_t ret = ::send(m_fd, dataView.data(), dataView.size(), 0);
-    if (ret < 0)
-        return false;
+    int more = m_use_msg_more && m_send_packets.size() > 1 ? MSG_MORE : 0;
+
+    ssize_t ret = ::send(m_fd, data_view.data(), data_view.size(), MSG_ZEROCOPY | more);
+    if (ret < 0 && errno == ENOBUFS) {
+        // Too many notifications are not consumed yet. Fall back to the regular send.
+        ret = ::send(m_fd, data_view.data(), data_view.size(), more);
+    } else if (ret >= 0) {
+        // Every successful zero-copy call gets a sequence number, which is used in the completion notifications.
+        auto seq = m_zero_copy_seq++;
 
-    packet.skip(static_cast<int32_t>(ret));
+        release_send_queue(size_t(ret));
+
+        packet.skip(size_t(ret));
+        if (packet.empty()) {
+            // The memory is still used by the kernel, so keep it until the completion is reported.
+            m_zero_copy_pending.emplace_back(seq, std::move(packet));
+            m_send_packets.pop_front();
+        }
+
+        enable_send_notifications();
+
+        return true;
+    }
+
+    if (ret < 0) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+            return false;
+
+        ret = 0;
+    }
+
+    release_send_queue(size_t(ret));
+
+    packet.skip(size_t(ret));
+    if (packet.empty())
+        m_send_packets.pop_front();
 
     enable_send_notifications();
 
     return true;
+#else
+    m_zero_copy_threshold = 0;
+
+    return send_next_packet_locked();
+#endif
+}
+
+void linux_async_client::set_throughput_mode() {
+    m_recv_packet.resize(THROUGHPUT_BUFFER_SIZE);
+    m_use_msg_more = true;
+}
+
+bool linux_async_client::process_error_queue() {
+#ifdef MSG_ZEROCOPY
+    std::lock_guard<std::mutex> lock(m_send_mutex);
+
+    while (true) {
+        char control[CMSG_SPACE(sizeof(sock_extended_err)) * 4];
+
+        msghdr msg{};
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        ssize_t ret = ::recvmsg(m_fd, &msg, MSG_ERRQUEUE);
+        if (ret < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+
+            return false;
+        }
+
+        for (cmsghdr *cm = CMSG_FIRSTHDR(&msg); cm; cm = CMSG_NXTHDR(&msg, cm)) {
+            bool is_recv_err = (cm->cmsg_level == SOL_IP && cm->cmsg_type == IP_RECVERR)
+                || (cm->cmsg_level == SOL_IPV6 && cm->cmsg_type == IPV6_RECVERR);
+
+            if (!is_recv_err)
+                continue;
+
+            sock_extended_err err{};
+            std::memcpy(&err, CMSG_DATA(cm), sizeof(err));
+            if (err.ee_origin != SO_EE_ORIGIN_ZEROCOPY || err.ee_errno != 0)
+                return false;
+
+            // The kernel had to copy the data anyway. Zero-copy sends only add overhead for this connection.
+            if (err.ee_code & SO_EE_CODE_ZEROCOPY_COPIED)
+                m_zero_copy_threshold = 0;
+
+            // Notification reports a range of completed sends [ee_info, ee_data]. Sends complete in order on TCP.
+            auto last = err.ee_data;
+            while (!m_zero_copy_pending.empty() && int32_t(m_zero_copy_pending.front().first - last) <= 0)
+                m_zero_copy_pending.pop_front();
+        }
+    }
+#endif
+
+    int sock_err = 0;
+    socklen_t len = sizeof(sock_err);
+    if (getsockopt(m_fd, SOL_SOCKET, SO_ERROR, &sock_err, &len) != 0)
+        return false;
+
+    return sock_err == 0;
 }
 
 bytes_view linux_async_client::receive() {
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include "../mpsc_queue.h"
+#include "../send_queue_limiter.h"
 #include "sockets.h"
 
 #include <ignite/network/async_handler.h>
@@ -24,6 +26,7 @@
 #include <ignite/network/end_point.h>
 #include <ignite/network/tcp_range.h>
 
+#include <atomic>
 #include <cstdint>
 #include <deque>
 #include <memory>
@@ -49,6 +52,9 @@ class linux_async_client {
 public:
     static constexpr size_t BUFFER_SIZE = 0x10000;
 
+    /** Receive buffer size for the throughput profile. */
+    static constexpr size_t THROUGHPUT_BUFFER_SIZE = 0x100000;
+
     /**
      * Constructor.
      *
@@ -95,6 +101,74 @@ public:
      */
     bool send(std::vector<std::byte> &&data);
 
+    /**
+     * Put packet into the submission queue. The queue is flushed by the worker thread with flush_submissions().
+     *
+     * Can be called from external threads.
+     *
+     * @param data Data to send.
+     * @return @c true if the queue was empty, i.e. the client should be scheduled for flushing.
+     */
+    bool enqueue(std::vector<std::byte> &&data) { return m_submissions.push(std::move(data)); }
+
+    /**
+     * Move all packets from the submission queue to the send queue and send as much as possible.
+     *
+     * Should only be called from the worker thread.
+     *
+     * @return @c true on success.
+     */
+    bool flush_submissions();
+
+    /**
+     * Set limiter of the send queue size.
+     *
+     * @param limiter Limiter.
+     */
+    void set_send_queue_limiter(std::shared_ptr<send_queue_limiter> limiter) { m_limiter = std::move(limiter); }
+
+    /**
+     * Account data that is about to be sent. Can be called from external threads.
+     *
+     * @param bytes Data size.
+     * @return Result. Rejected data should not be sent.
+     */
+    send_queue_limiter::acquire_result reserve_send_queue(size_t bytes) {
+        return m_limiter ? m_limiter->acquire(m_send_queue, bytes) : send_queue_limiter::acquire_result::ACCEPTED;
+    }
+
+    /**
+     * Check whether the send queue has drained to the low watermark since the last call.
+     *
+     * @return @c true if the queue has drained.
+     */
+    bool take_send_queue_drained() { return m_send_queue_drained.exchange(false); }
+
+    /**
+     * Enable zero-copy sends for packets not smaller than the threshold. Zero-copy sends should be enabled on the
+     * socket.
+     *
+     * @param threshold Minimal size of a packet to send without copying.
+     */
+    void set_zero_copy_threshold(size_t threshold) { m_zero_copy_threshold = threshold; }
+
+    /**
+     * Tune the client for throughput: use a larger receive buffer and hint the kernel with MSG_MORE that more data
+     * follows when only a part of the send queue is written at once.
+     *
+     * Should be called before the client is monitored.
+     */
+    void set_throughput_mode();
+
+    /**
+     * Process the socket error queue: release packets that were sent with zero-copy sends and completed.
+     *
+     * Should only be called from the worker thread.
+     *
+     * @return @c true if there are no other errors on the socket.
+     */
+    bool process_error_queue();
+
     /**
      * Initiate next receive of data.
      *
@@ -175,14 +249,35 @@ public:
     [[nodiscard]] const ignite_error &get_close_error() const { return m_close_err; }
 
 private:
+    /** Maximum number of packets sent with a single system call. */
+    static constexpr size_t MAX_SEND_BATCH = 64;
+
     /**
-     * Send next packet in queue.
+     * Send as many queued packets as possible with a single vectored write.
      *
      * @warning Can only be called when holding m_send_mutex lock.
      * @return @c true on success.
      */
     bool send_next_packet_locked();
 
+    /**
+     * Send the first packet in queue with a zero-copy send.
+     *
+     * @warning Can only be called when holding m_send_mutex lock.
+     * @return @c true on success.
+     */
+    bool send_zero_copy_locked();
+
+    /**
+     * Account data written to the socket or dropped.
+     *
+     * @param bytes Data size.
+     */
+    void release_send_queue(size_t bytes) {
+        if (m_limiter && m_limiter->release(m_send_queue, bytes))
+            m_send_queue_drained.store(true);
+    }
+
     /** State. */
     state m_state;
 
@@ -207,6 +302,30 @@ private:
     /** Send critical section. */
     std::mutex m_send_mutex;
 
+    /** Minimal size of a packet to send without copying. Zero if zero-copy sends are disabled. */
+    size_t m_zero_copy_threshold{0};
+
+    /** Whether partial batches are sent with MSG_MORE. */
+    bool m_use_msg_more{false};
+
+    /** Sequence number of the next zero-copy send. */
+    uint32_t m_zero_copy_seq{0};
+
+    /** Packets sent with zero-copy sends, which completion was not reported yet, with their sequence numbers. */
+    std::deque<std::pair<uint32_t, data_buffer_owning>> m_zero_copy_pending;
+
+    /** Packets submitted by application threads, but not yet moved to the send queue by the worker thread. */
+    mpsc_queue<std::vector<std::byte>> m_submissions;
+
+    /** Send queue size limiter. Can be null. */
+    std::shared_ptr<send_queue_limiter> m_limiter;
+
+    /** Size of the send queue, including the submission queue. */
+    send_queue_limiter::queue m_send_queue;
+
+    /** Whether the send queue has drained to the low watermark, and it is not reported yet. */
+    std::atomic_bool m_send_queue_drained{false};
+
     /** Packet that is currently received. */
     std::vector<std::byte> m_recv_packet;
 
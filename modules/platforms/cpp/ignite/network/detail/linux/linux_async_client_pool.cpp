@@ -24,17 +24,30 @@
 
 namespace ignite::network::detail {
 
-linux_async_client_pool::linux_async_client_pool()
-    : m_stopping(true)
+linux_async_client_pool::linux_async_client_pool(transport_configuration cfg)
+    : m_cfg(cfg)
+    , m_send_queue_limiter()
+    , m_stopping(true)
     , m_async_handler()
     , m_worker_thread(*this)
     , m_id_gen(0)
-    , m_clients_mutex()
-    , m_client_id_map() {
+    , m_clients() {
+    if (m_cfg.send_queue_limit || m_cfg.total_send_queue_limit) {
+        m_send_queue_limiter = std::make_shared<send_queue_limiter>(
+            m_cfg.send_queue_limit, m_cfg.send_queue_low_watermark, m_cfg.total_send_queue_limit);
+
+        // The total size is the state of the pool, not of the connection that happens to cross the watermark.
+        m_send_queue_limiter->set_total_saturation_listener(
+            [this](bool saturated) { handle_total_send_queue_saturation(saturated); });
+    }
 }
 
 linux_async_client_pool::~linux_async_client_pool() {
     internal_stop();
+
+    // The limiter is shared with the clients, which can outlive the pool.
+    if (m_send_queue_limiter)
+        m_send_queue_limiter->set_total_saturation_listener({});
 }
 
 void linux_async_client_pool::start(const std::vector<tcp_range> addrs, uint32_t conn_limit) {
@@ -57,6 +70,13 @@ void linux_async_client_pool::stop() {
     internal_stop();
 }
 
+void linux_async_client_pool::update_addresses(std::vector<tcp_range> addrs) {
+    if (m_stopping)
+        return;
+
+    m_worker_thread.update_addresses(std::move(addrs));
+}
+
 bool linux_async_client_pool::send(uint64_t id, std::vector<std::byte> &&data) {
     if (m_stopping)
         throw ignite_error("Client is stopped");
@@ -65,6 +85,21 @@ bool linux_async_client_pool::send(uint64_t id, std::vector<std::byte> &&data) {
     if (!client)
         return false;
 
+    auto reserved = client->reserve_send_queue(data.size());
+    if (reserved == send_queue_limiter::acquire_result::REJECTED)
+        throw ignite_error(status_code::BACKPRESSURE, "Send queue of the connection is full");
+
+    // Reported before the data is queued, so the producers learn about the saturation before the drain.
+    if (reserved == send_queue_limiter::acquire_result::SATURATED)
+        handle_send_queue_saturation(id, true);
+
+    if (m_cfg.submission_queue_enabled) {
+        if (client->enqueue(std::move(data)))
+            m_worker_thread.schedule_flush(id);
+
+        return true;
+    }
+
     return client->send(std::move(data));
 }
 
@@ -81,20 +116,14 @@ void linux_async_client_pool::close_and_release(uint64_t id, std::optional<ignit
     if (m_stopping)
         return;
 
-    std::shared_ptr<linux_async_client> client;
-    {
-        std::lock_guard<std::mutex> lock(m_clients_mutex);
-
-        auto it = m_client_id_map.find(id);
-        if (it == m_client_id_map.end())
-            return;
-
-        client = it->second;
-
-        m_client_id_map.erase(it);
-    }
+    std::shared_ptr<linux_async_client> client = m_clients.erase(id);
+    if (!client)
+        return;
 
     bool closed = client->close();
+    if (client->take_send_queue_drained())
+        handle_send_queue_saturation(id, false);
+
     if (closed) {
         ignite_error err0(client->get_close_error());
         if (err0.get_status_code() == status_code::SUCCESS)
@@ -112,15 +141,10 @@ bool linux_async_client_pool::add_client(std::shared_ptr<linux_async_client> cli
         return false;
 
     auto client_addr = client->address();
-    uint64_t client_id;
-    {
-        std::lock_guard<std::mutex> lock(m_clients_mutex);
+    uint64_t client_id = ++m_id_gen;
+    client->set_id(client_id);
 
-        client_id = ++m_id_gen;
-        client->set_id(client_id);
-
-        m_client_id_map[client_id] = std::move(client);
-    }
+    m_clients.insert(client_id, std::move(client));
 
     handle_connection_success(client_addr, client_id);
 
@@ -152,30 +176,32 @@ void linux_async_client_pool::handle_message_sent(uint64_t id) {
         handler->on_message_sent(id);
 }
 
+void linux_async_client_pool::handle_send_queue_saturation(uint64_t id, bool saturated) {
+    if (auto handler = m_async_handler.lock())
+        handler->on_send_queue_saturation(id, saturated);
+}
+
+void linux_async_client_pool::handle_total_send_queue_saturation(bool saturated) {
+    if (auto handler = m_async_handler.lock())
+        handler->on_total_send_queue_saturation(saturated);
+}
+
 void linux_async_client_pool::internal_stop() {
     m_stopping = true;
     m_worker_thread.stop();
 
-    {
-        std::lock_guard<std::mutex> lock(m_clients_mutex);
-
-        for (auto [_, client] : m_client_id_map) {
-            ignite_error err("Client stopped");
-            handle_connection_closed(client->id(), err);
-        }
-
-        m_client_id_map.clear();
+    for (auto &client : m_clients.clear()) {
+        ignite_error err("Client stopped");
+        handle_connection_closed(client->id(), err);
     }
 }
 
-std::shared_ptr<linux_async_client> linux_async_client_pool::find_client(uint64_t id) const {
-    std::lock_guard<std::mutex> lock(m_clients_mutex);
-
-    auto it = m_client_id_map.find(id);
-    if (it == m_client_id_map.end())
-        return {};
+std::vector<std::shared_ptr<linux_async_client>> linux_async_client_pool::get_clients() const {
+    return m_clients.values();
+}
 
-    return it->second;
+std::shared_ptr<linux_async_client> linux_async_client_pool::find_client(uint64_t id) const {
+    return m_clients.find(id);
 }
 
 } // namespace ignite::network::detail
@@ -20,15 +20,18 @@
 #include "linux_async_client.h"
 #include "linux_async_worker_thread.h"
 
+#include "../connection_table.h"
+
 #include <ignite/common/ignite_error.h>
 #include <ignite/network/async_client_pool.h>
 #include <ignite/network/async_handler.h>
 #include <ignite/network/tcp_range.h>
+#include <ignite/network/transport_configuration.h>
 
+#include <atomic>
 #include <cstdint>
-#include <map>
 #include <memory>
-#include <mutex>
+#include <vector>
 
 namespace ignite::network::detail {
 
@@ -40,9 +43,9 @@ public:
     /**
      * Constructor
      *
-     * @param handler Upper level event handler.
+     * @param cfg Transport configuration.
      */
-    linux_async_client_pool();
+    explicit linux_async_client_pool(transport_configuration cfg = {});
 
     /**
      * Destructor.
@@ -66,6 +69,13 @@ public:
      */
     void stop() override;
 
+    /**
+     * Replace the addresses to connect to.
+     *
+     * @param addrs Addresses to connect to.
+     */
+    void update_addresses(std::vector<tcp_range> addrs) override;
+
     /**
      * Set handler.
      *
@@ -149,20 +159,64 @@ public:
      */
     void handle_message_sent(uint64_t id);
 
-private:
     /**
-     * Close all established connections and stops handling threads.
+     * Handle send queue saturation change.
+     *
+     * @param id Async client ID.
+     * @param saturated @c true if the queue has become saturated.
      */
-    void internal_stop();
+    void handle_send_queue_saturation(uint64_t id, bool saturated);
+
+    /**
+     * Handle saturation change of the total size of the send queues.
+     *
+     * @param saturated @c true if the total size has become saturated.
+     */
+    void handle_total_send_queue_saturation(bool saturated);
+
+    /**
+     * Get transport configuration.
+     *
+     * @return Transport configuration.
+     */
+    [[nodiscard]] const transport_configuration &get_configuration() const { return m_cfg; }
+
+    /**
+     * Get send queue size limiter.
+     *
+     * @return Limiter. Null if the send queues are not limited.
+     */
+    [[nodiscard]] const std::shared_ptr<send_queue_limiter> &get_send_queue_limiter() const {
+        return m_send_queue_limiter;
+    }
 
     /**
-     * Find client by ID.
+     * Find client by ID. Lock-free.
      *
      * @param id Client ID.
      * @return Client. Null pointer if is not found.
      */
     std::shared_ptr<linux_async_client> find_client(uint64_t id) const;
 
+    /**
+     * Get all established connections.
+     *
+     * @return Clients.
+     */
+    [[nodiscard]] std::vector<std::shared_ptr<linux_async_client>> get_clients() const;
+
+private:
+    /**
+     * Close all established connections and stops handling threads.
+     */
+    void internal_stop();
+
+    /** Transport configuration. */
+    const transport_configuration m_cfg;
+
+    /** Send queue size limiter. */
+    std::shared_ptr<send_queue_limiter> m_send_queue_limiter;
+
     /** Flag indicating that pool is stopping. */
     volatile bool m_stopping;
 
@@ -173,13 +227,10 @@ private:
     linux_async_worker_thread m_worker_thread;
 
     /** ID counter. */
-    uint64_t m_id_gen;
-
-    /** Clients critical section. */
-    mutable std::mutex m_clients_mutex;
+    std::atomic<uint64_t> m_id_gen;
 
     /** Client mapping ID -> client */
-    std::map<uint64_t, std::shared_ptr<linux_async_client>> m_client_id_map;
+    connection_table<linux_async_client> m_clients;
 };
 
 } // namespace ignite::network::detail
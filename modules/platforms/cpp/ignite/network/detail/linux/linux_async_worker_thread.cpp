@@ -21,9 +21,12 @@
 #include "linux_async_client_pool.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstring>
 
 #include <netdb.h>
+#include <pthread.h>
+#include <sched.h>
 #include <sys/epoll.h>
 #include <sys/eventfd.h>
 #include <sys/socket.h>
@@ -36,6 +39,9 @@ namespace {
 
 fibonacci_sequence<10> fibonacci10;
 
+/** Busy poll time for the low-latency profile. Used both for the sockets and the event loop spinning. */
+constexpr std::chrono::microseconds BUSY_POLL_TIME{50};
+
 } // namespace
 
 linux_async_worker_thread::linux_async_worker_thread(linux_async_client_pool &client_pool)
@@ -43,12 +49,19 @@ linux_async_worker_thread::linux_async_worker_thread(linux_async_client_pool &cl
     , m_stopping(true)
     , m_epoll(-1)
     , m_stop_event(-1)
+    , m_wake_event(-1)
+    , m_flush_queue()
+    , m_addrs()
     , m_non_connected()
+    , m_new_addrs()
+    , m_new_addrs_mutex()
+    , m_limit(0)
     , m_current_connection()
     , m_current_client()
     , m_failed_attempts(0)
     , m_last_connection_time()
     , m_min_addrs(0)
+    , m_loop()
     , m_thread() {
     memset(&m_last_connection_time, 0, sizeof(m_last_connection_time));
 }
@@ -82,17 +95,52 @@ void linux_async_worker_thread::start(size_t limit, std::vector<tcp_range> addrs
         throw ignite_error(status_code::OS, msg);
     }
 
+    m_wake_event = eventfd(0, EFD_NONBLOCK);
+    if (m_wake_event < 0) {
+        std::string msg = get_last_system_error("Failed to create wake event instance", "");
+        close(m_stop_event);
+        close(m_epoll);
+        throw ignite_error(status_code::OS, msg);
+    }
+
+    event.data.ptr = &m_wake_event;
+
+    res = epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_wake_event, &event);
+    if (res < 0) {
+        std::string msg = get_last_system_error("Failed to create wake event instance", "");
+        close(m_wake_event);
+        close(m_stop_event);
+        close(m_epoll);
+        throw ignite_error(status_code::OS, msg);
+    }
+
     m_stopping = false;
     m_failed_attempts = 0;
+    m_addrs = addrs;
     m_non_connected = std::move(addrs);
+    m_limit = limit;
 
     m_current_connection.reset();
     m_current_client.reset();
 
-    if (!limit || limit > m_non_connected.size())
-        m_min_addrs = 0;
-    else
-        m_min_addrs = m_non_connected.size() - limit;
+    update_min_addrs();
+
+    m_loop = linux_event_loop::select(m_client_pool.get_configuration().event_loops);
+    if (m_loop) {
+        try {
+            m_loop->attach(*this);
+        } catch (...) {
+            m_loop.reset();
+            m_stopping = true;
+            close(m_wake_event);
+            close(m_stop_event);
+            close(m_epoll);
+
+            throw;
+        }
+
+        return;
+    }
 
     m_thread = std::thread(&linux_async_worker_thread::run, this);
 }
@@ -101,34 +149,156 @@ void linux_async_worker_thread::stop() {
     if (m_stopping)
         return;
 
-    m_stopping = true;
+    if (m_loop) {
+        // The loop does not touch the worker once detached.
+        m_loop->detach(*this);
+        m_loop.reset();
+        m_stopping = true;
+    } else {
+        m_stopping = true;
 
-    int64_t value = 1;
-    ssize_t res = write(m_stop_event, &value, sizeof(value));
+        int64_t value = 1;
+        ssize_t res = write(m_stop_event, &value, sizeof(value));
 
-    (void) res;
-    assert(res == sizeof(value));
+        (void) res;
+        assert(res == sizeof(value));
 
-    m_thread.join();
+        m_thread.join();
+    }
 
+    close(m_wake_event);
     close(m_stop_event);
     close(m_epoll);
 
+    m_addrs.clear();
     m_non_connected.clear();
     m_current_connection.reset();
 }
 
+void linux_async_worker_thread::schedule_flush(uint64_t id) {
+    if (!m_flush_queue.push(id))
+        return;
+
+    int64_t value = 1;
+    ssize_t res = write(m_wake_event, &value, sizeof(value));
+
+    (void) res;
+}
+
+void linux_async_worker_thread::update_addresses(std::vector<tcp_range> addrs) {
+    {
+        std::lock_guard<std::mutex> lock(m_new_addrs_mutex);
+        m_new_addrs = std::move(addrs);
+    }
+
+    int64_t value = 1;
+    ssize_t res = write(m_wake_event, &value, sizeof(value));
+
+    (void) res;
+}
+
+void linux_async_worker_thread::handle_scheduled_flushes() {
+    int64_t value;
+    ssize_t res = read(m_wake_event, &value, sizeof(value));
+
+    (void) res;
+
+    m_flush_queue.consume_all([this](uint64_t id) {
+        auto client = m_client_pool.find_client(id);
+        if (!client)
+            return;
+
+        if (!client->flush_submissions())
+            handle_connection_closed(client.get());
+        else if (client->take_send_queue_drained())
+            m_client_pool.handle_send_queue_saturation(id, false);
+    });
+}
+
+void linux_async_worker_thread::handle_address_update() {
+    std::optional<std::vector<tcp_range>> addrs;
+    {
+        std::lock_guard<std::mutex> lock(m_new_addrs_mutex);
+        std::swap(addrs, m_new_addrs);
+    }
+
+    if (!addrs)
+        return;
+
+    auto contains = [](const std::vector<tcp_range> &ranges, const tcp_range &range) {
+        return std::find(ranges.begin(), ranges.end(), range) != ranges.end();
+    };
+
+    for (const auto &range : *addrs) {
+        if (!contains(m_addrs, range))
+            m_non_connected.push_back(range);
+    }
+
+    m_non_connected.erase(std::remove_if(m_non_connected.begin(), m_non_connected.end(),
+                              [&](const tcp_range &range) { return !contains(*addrs, range); }),
+        m_non_connected.end());
+
+    if (m_current_connection && !contains(*addrs, m_current_connection->get_range())) {
+        if (m_current_client) {
+            m_current_client->stop_monitoring();
+            m_current_client->close();
+            m_current_client.reset();
+        }
+        m_current_connection.reset();
+    }
+
+    // Ranges of closed connections are only returned to m_non_connected if they are still known.
+    m_addrs = std::move(*addrs);
+    update_min_addrs();
+
+    for (auto &client : m_client_pool.get_clients()) {
+        if (!contains(m_addrs, client->get_range()))
+            client->shutdown(ignite_error(status_code::NETWORK, "Node is removed from the address list"));
+    }
+}
+
+void linux_async_worker_thread::update_min_addrs() {
+    if (!m_limit || m_limit > m_addrs.size())
+        m_min_addrs = 0;
+    else
+        m_min_addrs = m_addrs.size() - m_limit;
+}
+
 void linux_async_worker_thread::run() {
+    int cpu = m_client_pool.get_configuration().io_thread_cpu;
+    if (cpu >= 0 && cpu < CPU_SETSIZE) {
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(cpu, &cpu_set);
+
+        // Pinning is an optimization, so the thread just keeps running where the scheduler puts it on failure.
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    }
+
     while (!m_stopping) {
         handle_new_connections();
 
         if (m_stopping)
             break;
 
-        handle_connection_events();
+        handle_connection_events(true);
     }
 }
 
+int linux_async_worker_thread::prepare_wait() {
+    if (m_stopping)
+        return -1;
+
+    handle_new_connections();
+
+    return calculate_connection_timeout();
+}
+
+void linux_async_worker_thread::handle_ready_events() {
+    if (!m_stopping)
+        handle_connection_events(false);
+}
+
 void linux_async_worker_thread::handle_new_connections() {
     if (!should_initiate_new_connection())
         return;
@@ -163,7 +333,21 @@ void linux_async_worker_thread::handle_new_connections() {
         return;
     }
 
-    try_set_socket_options(socket_fd, linux_async_client::BUFFER_SIZE, true, true, true);
+    const auto &cfg = m_client_pool.get_configuration();
+
+    // TCP-level options are meaningless for Unix domain sockets.
+    bool zero_copy = false;
+    if (addr->ai_family != AF_UNIX) {
+        int buf_size = cfg.profile == socket_profile::THROUGHPUT ? 0 : int(linux_async_client::BUFFER_SIZE);
+        try_set_socket_options(socket_fd, buf_size, true, true, true);
+
+        if (cfg.profile == socket_profile::LOW_LATENCY)
+            try_enable_busy_poll(socket_fd, int(BUSY_POLL_TIME.count()));
+
+        if (cfg.zero_copy_threshold)
+            zero_copy = try_enable_zero_copy(socket_fd);
+    }
+
     bool success = set_non_blocking_mode(socket_fd, true);
     if (!success) {
         report_connection_error(m_current_connection->current_address(),
@@ -172,6 +356,13 @@ void linux_async_worker_thread::handle_new_connections() {
     }
 
     m_current_client = m_current_connection->to_client(socket_fd);
+    m_current_client->set_send_queue_limiter(m_client_pool.get_send_queue_limiter());
+    if (zero_copy)
+        m_current_client->set_zero_copy_threshold(cfg.zero_copy_threshold);
+
+    if (cfg.profile == socket_profile::THROUGHPUT)
+        m_current_client->set_throughput_mode();
+
     bool ok = m_current_client->start_monitoring(m_epoll);
     if (!ok)
         throw_last_system_error("Can not add file descriptor to epoll");
@@ -183,7 +374,9 @@ void linux_async_worker_thread::handle_new_connections() {
 
         clock_gettime(CLOCK_MONOTONIC, &m_last_connection_time);
 
-        if (last_error != EWOULDBLOCK && last_error != EINPROGRESS) {
+        // Unix domain sockets either connect immediately or fail, there is no connection in progress for them.
+        bool in_progress = addr->ai_family != AF_UNIX && (last_error == EWOULDBLOCK || last_error == EINPROGRESS);
+        if (!in_progress) {
             handle_connection_failed(
                 "Failed to establish connection with the host: " + get_socket_error_message(last_error));
             return;
@@ -191,20 +384,40 @@ void linux_async_worker_thread::handle_new_connections() {
     }
 }
 
-void linux_async_worker_thread::handle_connection_events() {
+void linux_async_worker_thread::handle_connection_events(bool wait) {
     enum { MAX_EVENTS = 16 };
 
     epoll_event events[MAX_EVENTS];
 
-    int timeout = calculate_connection_timeout();
+    int timeout = wait ? calculate_connection_timeout() : 0;
+
+    int res = 0;
+    if (timeout != 0 && m_client_pool.get_configuration().profile == socket_profile::LOW_LATENCY) {
+        // Spin for a while before going to sleep, so a response that comes soon is picked up without a wake-up.
+        auto spin_end = std::chrono::steady_clock::now() + BUSY_POLL_TIME;
+        do {
+            res = epoll_wait(m_epoll, events, MAX_EVENTS, 0);
+        } while (res == 0 && !m_stopping && std::chrono::steady_clock::now() < spin_end);
+    }
 
-    int res = epoll_wait(m_epoll, events, MAX_EVENTS, timeout);
+    if (res <= 0)
+        res = epoll_wait(m_epoll, events, MAX_EVENTS, timeout);
 
     if (res <= 0)
         return;
 
-    for (int i = 0; i < res; ++i) {
+    // Flushes and address updates can close clients that later events of the batch point to, so they are handled
+    // after the batch.
+    bool woken = false;
+
+    // The pool can be stopped from a callback, which releases the clients.
+    for (int i = 0; i < res && !m_stopping; ++i) {
         epoll_event &current_event = events[i];
+        if (current_event.data.ptr == &m_wake_event) {
+            woken = true;
+            continue;
+        }
+
         auto client = static_cast<linux_async_client *>(current_event.data.ptr);
         if (!client)
             continue;
@@ -216,6 +429,18 @@ void linux_async_worker_thread::handle_connection_events() {
             }
 
             handle_connection_success(client);
+            if (m_stopping)
+                return;
+        }
+
+        // Zero-copy send completions are reported through the error queue and are not errors.
+        if (current_event.events & EPOLLERR) {
+            if (!client->process_error_queue()) {
+                handle_connection_closed(client);
+                continue;
+            }
+
+            current_event.events &= ~EPOLLERR;
         }
 
         if (current_event.events & (EPOLLRDHUP | EPOLLERR | EPOLLHUP)) {
@@ -231,6 +456,8 @@ void linux_async_worker_thread::handle_connection_events() {
             }
 
             m_client_pool.handle_message_received(client->id(), msg);
+            if (m_stopping)
+                return;
         }
 
         if (current_event.events & EPOLLOUT) {
@@ -240,9 +467,17 @@ void linux_async_worker_thread::handle_connection_events() {
                 continue;
             }
 
+            if (client->take_send_queue_drained())
+                m_client_pool.handle_send_queue_saturation(client->id(), false);
+
             m_client_pool.handle_message_sent(client->id());
         }
     }
+
+    if (woken && !m_stopping) {
+        handle_scheduled_flushes();
+        handle_address_update();
+    }
 }
 
 void linux_async_worker_thread::report_connection_error(const end_point &addr, std::string msg) {
@@ -265,13 +500,17 @@ void linux_async_worker_thread::handle_connection_failed(std::string msg) {
 void linux_async_worker_thread::handle_connection_closed(linux_async_client *client) {
     client->stop_monitoring();
 
-    m_non_connected.push_back(client->get_range());
+    const auto &range = client->get_range();
+    if (std::find(m_addrs.begin(), m_addrs.end(), range) != m_addrs.end())
+        m_non_connected.push_back(range);
 
     m_client_pool.close_and_release(client->id(), std::nullopt);
 }
 
 void linux_async_worker_thread::handle_connection_success(linux_async_client *client) {
-    m_non_connected.erase(std::find(m_non_connected.begin(), m_non_connected.end(), client->get_range()));
+    auto it = std::find(m_non_connected.begin(), m_non_connected.end(), client->get_range());
+    if (it != m_non_connected.end())
+        m_non_connected.erase(it);
 
     m_client_pool.add_client(std::move(m_current_client));
 
@@ -17,8 +17,10 @@
 
 #pragma once
 
+#include "../mpsc_queue.h"
 #include "connecting_context.h"
 #include "linux_async_client.h"
+#include "linux_event_loop.h"
 
 #include <ignite/network/async_handler.h>
 #include <ignite/network/end_point.h>
@@ -28,7 +30,9 @@
 #include <ctime>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <thread>
+#include <vector>
 
 namespace ignite::network::detail {
 
@@ -62,6 +66,51 @@ public:
      */
     void stop();
 
+    /**
+     * Schedule flushing of the client submission queue. Wakes the thread up if it is not scheduled to wake up
+     * already, so the thread is woken up at most once per batch of submissions.
+     *
+     * Can be called from external threads.
+     *
+     * @param id Client ID.
+     */
+    void schedule_flush(uint64_t id);
+
+    /**
+     * Replace the addresses to connect to. The update is applied by the thread.
+     *
+     * Can be called from external threads.
+     *
+     * @param addrs Addresses to connect to.
+     */
+    void update_addresses(std::vector<tcp_range> addrs);
+
+    /**
+     * Get epoll instance of the worker.
+     *
+     * @return Epoll file descriptor.
+     */
+    [[nodiscard]] int get_epoll() const { return m_epoll; }
+
+    /**
+     * Initiate new connection process if needed. Used by the shared event loop.
+     *
+     * @return Time until the next connection attempt in milliseconds. Negative value means there is nothing to wait.
+     */
+    int prepare_wait();
+
+    /**
+     * Handle ready epoll events without blocking. Used by the shared event loop.
+     */
+    void handle_ready_events();
+
+    /**
+     * Calculate connection timeout.
+     *
+     * @return Connection timeout.
+     */
+    [[nodiscard]] int calculate_connection_timeout() const;
+
 private:
     /**
      * Run thread.
@@ -75,8 +124,25 @@ private:
 
     /**
      * Handle epoll events.
+     *
+     * @param wait Wait for the events until the next connection attempt.
      */
-    void handle_connection_events();
+    void handle_connection_events(bool wait);
+
+    /**
+     * Flush submission queues of all scheduled clients.
+     */
+    void handle_scheduled_flushes();
+
+    /**
+     * Apply the latest address update, if any. Closes clients, so it is called after the epoll batch is processed.
+     */
+    void handle_address_update();
+
+    /**
+     * Calculate minimal number of non-connected addresses from connection limit.
+     */
+    void update_min_addrs();
 
     /**
      * Handle network error during connection establishment.
@@ -107,13 +173,6 @@ private:
      */
     void handle_connection_success(linux_async_client *client);
 
-    /**
-     * Calculate connection timeout.
-     *
-     * @return Connection timeout.
-     */
-    [[nodiscard]] int calculate_connection_timeout() const;
-
     /**
      * Check whether new connection should be initiated.
      *
@@ -133,9 +192,27 @@ private:
     /** Stop event file descriptor. */
     int m_stop_event;
 
+    /** Wake event file descriptor. Signalled when there are clients scheduled for flushing. */
+    int m_wake_event;
+
+    /** IDs of clients scheduled for flushing. */
+    mpsc_queue<uint64_t> m_flush_queue;
+
+    /** All addresses. */
+    std::vector<tcp_range> m_addrs;
+
     /** Addresses to use for connection establishment. */
     std::vector<tcp_range> m_non_connected;
 
+    /** Address update to apply. */
+    std::optional<std::vector<tcp_range>> m_new_addrs;
+
+    /** Address update mutex. */
+    std::mutex m_new_addrs_mutex;
+
+    /** Connection limit. */
+    size_t m_limit;
+
     /** Connection which is currently in connecting process. */
     std::unique_ptr<connecting_context> m_current_connection;
 
@@ -151,6 +228,9 @@ private:
     /** Minimal number of addresses. */
     size_t m_min_addrs;
 
+    /** Shared event loop. The worker runs its own thread if null. */
+    std::shared_ptr<linux_event_loop> m_loop;
+
     /** Thread. */
     std::thread m_thread;
 };
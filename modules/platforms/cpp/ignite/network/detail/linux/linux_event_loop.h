@@ -0,0 +1,260 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <ignite/network/event_loop_group.h>
+#include <ignite/network/external_event_loop.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ignite::network::detail {
+
+class linux_async_worker_thread;
+
+/**
+ * Event loop thread that serves the workers of many client pools.
+ *
+ * Every worker keeps its own epoll instance, which is added to the epoll instance of the loop. The loop waits until
+ * any worker has events or has to initiate a new connection, and lets the worker process it without blocking.
+ */
+class linux_event_loop {
+public:
+    /**
+     * Destructor.
+     */
+    ~linux_event_loop();
+
+    /**
+     * Start event loop thread.
+     *
+     * @return Event loop.
+     *
+     * @throw ignite_error on error.
+     */
+    static std::shared_ptr<linux_event_loop> start();
+
+    /**
+     * Create event loop without a thread. The loop is driven by the get_timeout(), handle_timeouts() and
+     * handle_events() calls.
+     *
+     * @return Event loop.
+     *
+     * @throw ignite_error on error.
+     */
+    static std::shared_ptr<linux_event_loop> create();
+
+    /**
+     * Select the loop to serve a worker.
+     *
+     * @param group Event loop group from the transport configuration.
+     * @return Event loop. Null pointer if the worker should start its own thread.
+     */
+    static std::shared_ptr<linux_event_loop> select(const std::shared_ptr<event_loop_group> &group);
+
+    /**
+     * Stop event loop thread.
+     */
+    void stop();
+
+    /**
+     * Attach worker. The worker is served by the loop until detached.
+     *
+     * @param worker Worker.
+     *
+     * @throw ignite_error on error.
+     */
+    void attach(linux_async_worker_thread &worker);
+
+    /**
+     * Detach worker. Once the function returns, the loop does not touch the worker anymore.
+     *
+     * @param worker Worker.
+     */
+    void detach(linux_async_worker_thread &worker);
+
+    /**
+     * Wake the loop up, so the workers re-evaluate their connection timeouts.
+     */
+    void wake();
+
+    /**
+     * Get epoll instance of the loop.
+     *
+     * @return Epoll descriptor.
+     */
+    [[nodiscard]] int get_epoll() const { return m_epoll; }
+
+    /**
+     * Get time until the next connection attempt of any worker.
+     *
+     * @return Timeout in milliseconds. Negative value means there is nothing to wait.
+     */
+    [[nodiscard]] int get_timeout();
+
+    /**
+     * Initiate new connections of the workers if needed.
+     *
+     * @return Time until the next connection attempt in milliseconds. Negative value means there is nothing to wait.
+     */
+    int handle_timeouts();
+
+    /**
+     * Wait for the events and let the workers process them.
+     *
+     * @param timeout Timeout in milliseconds. Zero means do not wait. Negative value means wait infinitely.
+     */
+    void handle_events(int timeout);
+
+private:
+    // Default
+    linux_event_loop() = default;
+
+    /**
+     * Run loop.
+     */
+    void run();
+
+    /**
+     * Check whether the worker is attached.
+     *
+     * @warning Should only be called with m_workers_mutex lock held.
+     *
+     * @param worker Worker.
+     * @return @c true if attached.
+     */
+    [[nodiscard]] bool is_attached(const linux_async_worker_thread *worker) const;
+
+    /** Flag indicating that loop is stopping. */
+    std::atomic_bool m_stopping{false};
+
+    /** Epoll instance. */
+    int m_epoll{-1};
+
+    /** Wake event. */
+    int m_wake_event{-1};
+
+    /** Workers mutex. Held while a worker is processed. Recursive, as a worker can be stopped from its callback. */
+    std::recursive_mutex m_workers_mutex;
+
+    /** Attached workers. */
+    std::vector<linux_async_worker_thread *> m_workers;
+
+    /** Thread. */
+    std::thread m_thread;
+};
+
+/**
+ * Linux-specific event loop group.
+ */
+class linux_event_loop_group : public event_loop_group {
+public:
+    /**
+     * Constructor.
+     *
+     * @param threads Number of threads.
+     *
+     * @throw ignite_error on error.
+     */
+    explicit linux_event_loop_group(std::size_t threads);
+
+    /**
+     * Destructor.
+     */
+    ~linux_event_loop_group() override;
+
+    /**
+     * Get number of threads.
+     *
+     * @return Number of threads.
+     */
+    [[nodiscard]] std::size_t size() const override { return m_loops.size(); }
+
+    /**
+     * Get the next loop to serve a worker. Loops are assigned in round-robin.
+     *
+     * @return Event loop.
+     */
+    [[nodiscard]] std::shared_ptr<linux_event_loop> next();
+
+private:
+    /** Loops. */
+    std::vector<std::shared_ptr<linux_event_loop>> m_loops;
+
+    /** Index of the next loop. */
+    std::atomic<std::size_t> m_next{0};
+};
+
+/**
+ * Linux-specific event loop driven by the application.
+ */
+class linux_external_event_loop : public external_event_loop {
+public:
+    /**
+     * Constructor.
+     *
+     * @throw ignite_error on error.
+     */
+    linux_external_event_loop();
+
+    /**
+     * Destructor.
+     */
+    ~linux_external_event_loop() override;
+
+    /**
+     * Get the descriptor to poll for reading.
+     *
+     * @return Epoll descriptor of the loop.
+     */
+    [[nodiscard]] int get_fd() const override { return m_loop->get_epoll(); }
+
+    /**
+     * Get time until handle_timeouts() should be called.
+     *
+     * @return Timeout in milliseconds. Negative value means there is nothing to wait.
+     */
+    [[nodiscard]] int get_timeout() override { return m_loop->get_timeout(); }
+
+    /**
+     * Process ready events. Never blocks.
+     */
+    void handle_events() override { m_loop->handle_events(0); }
+
+    /**
+     * Initiate connections which are due.
+     */
+    void handle_timeouts() override { m_loop->handle_timeouts(); }
+
+    /**
+     * Get the loop.
+     *
+     * @return Event loop.
+     */
+    [[nodiscard]] std::shared_ptr<linux_event_loop> get_loop() const { return m_loop; }
+
+private:
+    /** Loop. */
+    std::shared_ptr<linux_event_loop> m_loop;
+};
+
+} // namespace ignite::network::detail
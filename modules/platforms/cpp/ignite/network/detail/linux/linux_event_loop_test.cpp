@@ -0,0 +1,469 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "linux_async_client_pool.h"
+#include "linux_event_loop.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace ignite;
+using namespace ignite::network;
+using namespace ignite::network::detail;
+
+namespace {
+
+/** Time to wait for an event. */
+constexpr auto WAIT_TIMEOUT = std::chrono::seconds(10);
+
+/**
+ * Server socket listening on a loopback port.
+ */
+class local_server {
+public:
+    /**
+     * Constructor.
+     */
+    local_server() {
+        m_fd = socket(AF_INET, SOCK_STREAM, 0);
+        EXPECT_GE(m_fd, 0);
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0;
+
+        EXPECT_EQ(0, bind(m_fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)));
+        EXPECT_EQ(0, listen(m_fd, 16));
+
+        socklen_t len = sizeof(addr);
+        EXPECT_EQ(0, getsockname(m_fd, reinterpret_cast<sockaddr *>(&addr), &len));
+        m_port = ntohs(addr.sin_port);
+    }
+
+    /**
+     * Destructor.
+     */
+    ~local_server() {
+        for (auto fd : m_accepted)
+            close(fd);
+
+        close(m_fd);
+    }
+
+    /**
+     * Get address to connect to.
+     *
+     * @return Address.
+     */
+    [[nodiscard]] std::vector<tcp_range> addrs() const { return {tcp_range("127.0.0.1", m_port)}; }
+
+    /**
+     * Accept a connection.
+     *
+     * @return Socket of the accepted connection.
+     */
+    int accept_connection() {
+        pollfd pfd{m_fd, POLLIN, 0};
+        EXPECT_EQ(1, poll(&pfd, 1, int(std::chrono::milliseconds(WAIT_TIMEOUT).count())));
+
+        int fd = accept(m_fd, nullptr, nullptr);
+        EXPECT_GE(fd, 0);
+        m_accepted.push_back(fd);
+
+        return fd;
+    }
+
+    /**
+     * Receive data from the accepted connection.
+     *
+     * @param fd Socket of the connection.
+     * @param size Number of bytes to receive.
+     * @return Data.
+     */
+    static std::string receive(int fd, std::size_t size) {
+        std::string res;
+        while (res.size() < size) {
+            pollfd pfd{fd, POLLIN, 0};
+            if (poll(&pfd, 1, int(std::chrono::milliseconds(WAIT_TIMEOUT).count())) != 1)
+                break;
+
+            char buf[256];
+            auto received = recv(fd, buf, std::min(sizeof(buf), size - res.size()), 0);
+            if (received <= 0)
+                break;
+
+            res.append(buf, std::size_t(received));
+        }
+
+        return res;
+    }
+
+private:
+    /** Listening socket. */
+    int m_fd{-1};
+
+    /** Port. */
+    std::uint16_t m_port{0};
+
+    /** Accepted sockets. */
+    std::vector<int> m_accepted;
+};
+
+/**
+ * Handler that records the events and runs the hooks set by the test.
+ */
+class recording_handler : public async_handler {
+public:
+    void on_connection_success(const end_point &, uint64_t id) override {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_connected.push_back(id);
+        }
+        m_condition.notify_all();
+
+        if (m_on_connected)
+            m_on_connected(id);
+    }
+
+    void on_connection_error(const end_point &, ignite_error) override {}
+
+    void on_connection_closed(uint64_t id, std::optional<ignite_error>) override {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_closed.push_back(id);
+        }
+        m_condition.notify_all();
+    }
+
+    void on_message_received(uint64_t, bytes_view msg) override {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_received.append(reinterpret_cast<const char *>(msg.data()), msg.size());
+        }
+        m_condition.notify_all();
+
+        if (m_on_received)
+            m_on_received();
+    }
+
+    void on_message_sent(uint64_t) override {}
+
+    /**
+     * Wait until the predicate holds. Used with the loops that have threads.
+     *
+     * @param pred Predicate.
+     * @return @c true if the predicate holds.
+     */
+    bool wait(const std::function<bool()> &pred) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_condition.wait_for(lock, WAIT_TIMEOUT, [&] {
+            lock.unlock();
+            auto res = pred();
+            lock.lock();
+
+            return res;
+        });
+    }
+
+    /**
+     * Get connected IDs.
+     *
+     * @return Connected IDs.
+     */
+    std::vector<uint64_t> connected() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_connected;
+    }
+
+    /**
+     * Get closed IDs.
+     *
+     * @return Closed IDs.
+     */
+    std::vector<uint64_t> closed() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_closed;
+    }
+
+    /**
+     * Get received data.
+     *
+     * @return Received data.
+     */
+    std::string received() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_received;
+    }
+
+    /** Hook called on connection. */
+    std::function<void(uint64_t)> m_on_connected;
+
+    /** Hook called on message. */
+    std::function<void()> m_on_received;
+
+private:
+    /** Mutex. */
+    std::mutex m_mutex;
+
+    /** Condition variable. */
+    std::condition_variable m_condition;
+
+    /** Connected IDs. */
+    std::vector<uint64_t> m_connected;
+
+    /** Closed IDs. */
+    std::vector<uint64_t> m_closed;
+
+    /** Received data. */
+    std::string m_received;
+};
+
+/**
+ * Drive the external loop the way an application does, until the predicate holds.
+ *
+ * @param loop Loop.
+ * @param pred Predicate.
+ * @return @c true if the predicate holds.
+ */
+bool drive(external_event_loop &loop, const std::function<bool()> &pred) {
+    auto deadline = std::chrono::steady_clock::now() + WAIT_TIMEOUT;
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+
+        if (loop.get_timeout() == 0)
+            loop.handle_timeouts();
+
+        pollfd pfd{loop.get_fd(), POLLIN, 0};
+        if (poll(&pfd, 1, 10) == 1)
+            loop.handle_events();
+    }
+
+    return true;
+}
+
+/**
+ * Check whether the socket has data to read.
+ *
+ * @param fd Socket.
+ * @return @c true if readable.
+ */
+bool is_readable(int fd) {
+    pollfd pfd{fd, POLLIN, 0};
+    return poll(&pfd, 1, 0) == 1;
+}
+
+/**
+ * Make pool served by the event loops.
+ *
+ * @param loops Event loops.
+ * @param handler Handler.
+ * @return Pool.
+ */
+std::shared_ptr<linux_async_client_pool> make_pool(
+    std::shared_ptr<event_loop_group> loops, const std::shared_ptr<recording_handler> &handler) {
+    transport_configuration cfg;
+    cfg.event_loops = std::move(loops);
+
+    auto pool = std::make_shared<linux_async_client_pool>(cfg);
+    pool->set_handler(handler);
+
+    return pool;
+}
+
+/**
+ * Convert string to bytes.
+ *
+ * @param str String.
+ * @return Bytes.
+ */
+std::vector<std::byte> to_bytes(const std::string &str) {
+    auto data = reinterpret_cast<const std::byte *>(str.data());
+    return {data, data + str.size()};
+}
+
+} // namespace
+
+TEST(linux_event_loop, external_loop_exchange) {
+    local_server server;
+    auto loop = std::make_shared<linux_external_event_loop>();
+    auto handler = std::make_shared<recording_handler>();
+    auto pool = make_pool(loop, handler);
+
+    EXPECT_EQ(0u, loop->size());
+    EXPECT_LT(loop->get_timeout(), 0);
+
+    pool->start(server.addrs(), 1);
+    EXPECT_EQ(0, loop->get_timeout());
+
+    ASSERT_TRUE(drive(*loop, [&] { return !handler->connected().empty(); }));
+    auto id = handler->connected().front();
+    auto fd = server.accept_connection();
+
+    // Nothing to initiate once connected.
+    EXPECT_LT(loop->get_timeout(), 0);
+
+    ASSERT_EQ(4, send(fd, "ping", 4, 0));
+    ASSERT_TRUE(drive(*loop, [&] { return handler->received() == "ping"; }));
+
+    pool->send(id, to_bytes("pong"));
+    ASSERT_TRUE(drive(*loop, [&] { return is_readable(fd); }));
+    EXPECT_EQ("pong", local_server::receive(fd, 4));
+
+    pool->stop();
+    EXPECT_EQ(std::vector<uint64_t>{id}, handler->closed());
+}
+
+TEST(linux_event_loop, stop_from_connection_callback) {
+    local_server server;
+    auto loop = std::make_shared<linux_external_event_loop>();
+    auto handler = std::make_shared<recording_handler>();
+    auto pool = make_pool(loop, handler);
+
+    // The worker is detached while the loop is processing it.
+    handler->m_on_connected = [&pool](uint64_t) { pool->stop(); };
+
+    pool->start(server.addrs(), 1);
+
+    ASSERT_TRUE(drive(*loop, [&] { return !handler->closed().empty(); }));
+    EXPECT_EQ(handler->connected(), handler->closed());
+
+    // The loop has no workers anymore.
+    EXPECT_LT(loop->get_timeout(), 0);
+    loop->handle_timeouts();
+    loop->handle_events();
+}
+
+TEST(linux_event_loop, stop_from_message_callback) {
+    local_server server;
+    auto loop = std::make_shared<linux_external_event_loop>();
+    auto handler = std::make_shared<recording_handler>();
+    auto pool = make_pool(loop, handler);
+
+    handler->m_on_received = [&pool] { pool->stop(); };
+
+    pool->start(server.addrs(), 1);
+    ASSERT_TRUE(drive(*loop, [&] { return !handler->connected().empty(); }));
+
+    auto fd = server.accept_connection();
+    ASSERT_EQ(4, send(fd, "ping", 4, 0));
+
+    ASSERT_TRUE(drive(*loop, [&] { return !handler->closed().empty(); }));
+    EXPECT_EQ("ping", handler->received());
+    EXPECT_LT(loop->get_timeout(), 0);
+}
+
+TEST(linux_event_loop, restart_on_external_loop) {
+    local_server server;
+    auto loop = std::make_shared<linux_external_event_loop>();
+    auto handler = std::make_shared<recording_handler>();
+    auto pool = make_pool(loop, handler);
+
+    for (std::size_t i = 1; i <= 2; ++i) {
+        pool->start(server.addrs(), 1);
+        ASSERT_TRUE(drive(*loop, [&] { return handler->connected().size() == i; }));
+        server.accept_connection();
+
+        pool->stop();
+        EXPECT_EQ(i, handler->closed().size());
+    }
+}
+
+TEST(linux_event_loop, pools_share_loop_thread) {
+    local_server server;
+    auto loops = std::make_shared<linux_event_loop_group>(1);
+    auto handler1 = std::make_shared<recording_handler>();
+    auto handler2 = std::make_shared<recording_handler>();
+    auto pool1 = make_pool(loops, handler1);
+    auto pool2 = make_pool(loops, handler2);
+
+    EXPECT_EQ(1u, loops->size());
+
+    pool1->start(server.addrs(), 1);
+    pool2->start(server.addrs(), 1);
+
+    ASSERT_TRUE(handler1->wait([&] { return !handler1->connected().empty(); }));
+    ASSERT_TRUE(handler2->wait([&] { return !handler2->connected().empty(); }));
+
+    auto fd1 = server.accept_connection();
+    auto fd2 = server.accept_connection();
+
+    ASSERT_EQ(1, send(fd1, "a", 1, 0));
+    ASSERT_EQ(1, send(fd2, "a", 1, 0));
+
+    ASSERT_TRUE(handler1->wait([&] { return handler1->received() == "a"; }));
+    ASSERT_TRUE(handler2->wait([&] { return handler2->received() == "a"; }));
+
+    // Stopping one pool does not affect the other one.
+    pool1->stop();
+
+    ASSERT_EQ(1, send(fd2, "b", 1, 0));
+    ASSERT_TRUE(handler2->wait([&] { return handler2->received() == "ab"; }));
+
+    pool2->stop();
+}
+
+TEST(linux_event_loop, detach_after_loop_stopped) {
+    local_server server;
+    auto loops = std::make_shared<linux_event_loop_group>(1);
+    auto handler = std::make_shared<recording_handler>();
+    auto pool = make_pool(loops, handler);
+
+    pool->start(server.addrs(), 1);
+    ASSERT_TRUE(handler->wait([&] { return !handler->connected().empty(); }));
+
+    // The loop is kept by the worker, so the pool can still be stopped.
+    loops.reset();
+    pool->stop();
+
+    EXPECT_EQ(handler->connected(), handler->closed());
+}
+
+TEST(linux_event_loop, stop_from_callback_on_loop_thread) {
+    local_server server;
+    auto loops = std::make_shared<linux_event_loop_group>(1);
+    auto handler = std::make_shared<recording_handler>();
+    auto pool = make_pool(loops, handler);
+
+    handler->m_on_connected = [&pool](uint64_t) { pool->stop(); };
+
+    pool->start(server.addrs(), 1);
+    ASSERT_TRUE(handler->wait([&] { return !handler->closed().empty(); }));
+
+    // The loop thread keeps serving other pools.
+    auto handler2 = std::make_shared<recording_handler>();
+    auto pool2 = make_pool(loops, handler2);
+
+    pool2->start(server.addrs(), 1);
+    ASSERT_TRUE(handler2->wait([&] { return !handler2->connected().empty(); }));
+
+    pool2->stop();
+}
@@ -0,0 +1,132 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "shm_async_client.h"
+
+namespace ignite::network::detail {
+
+shm_async_client::shm_async_client(std::shared_ptr<shm_segment> segment, std::uint32_t slot, end_point addr)
+    : m_segment(std::move(segment))
+    , m_slot(slot)
+    , m_out(m_segment->to_peer_ring(slot))
+    , m_in(m_segment->to_client_ring(slot))
+    , m_addr(std::move(addr)) {
+}
+
+shm_async_client::~shm_async_client() {
+    close();
+
+    // Data can be sent after the client is closed and before it is removed from the pool.
+    if (m_limiter)
+        m_limiter->release_all(m_send_queue);
+}
+
+bool shm_async_client::send(std::vector<std::byte> &&data) {
+    std::lock_guard<std::mutex> lock(m_send_mutex);
+
+    if (!is_connected())
+        return false;
+
+    m_send_packets.emplace_back(std::move(data));
+    if (m_send_packets.size() == 1)
+        write_packets_locked();
+
+    // The receiving thread writes the rest as the peer reads the ring, and reports the drain of the send queue, so
+    // wake it up if it waits for the data.
+    bool queued = !m_send_packets.empty();
+    if ((queued && !m_has_queued_data.exchange(true)) || m_send_queue_drained.load())
+        m_in.notify_consumer();
+
+    return true;
+}
+
+bool shm_async_client::flush_send_queue() {
+    std::lock_guard<std::mutex> lock(m_send_mutex);
+
+    bool written = write_packets_locked();
+    m_has_queued_data.store(!m_send_packets.empty());
+
+    return written;
+}
+
+bool shm_async_client::write_packets_locked() {
+    std::size_t written_total = 0;
+    while (!m_send_packets.empty()) {
+        auto &packet = m_send_packets.front();
+
+        auto written = m_out.write(packet.get_bytes_view());
+        if (!written)
+            break;
+
+        written_total += written;
+        packet.skip(written);
+        if (packet.empty())
+            m_send_packets.pop_front();
+    }
+
+    if (!written_total)
+        return false;
+
+    m_out.notify_consumer();
+    release_send_queue(written_total);
+
+    return true;
+}
+
+bytes_view shm_async_client::receive(std::chrono::milliseconds timeout) {
+    auto data = m_in.readable();
+    if (!data.empty())
+        return data;
+
+    if (timeout.count() <= 0)
+        return data;
+
+    m_in.wait_readable(std::min(timeout, WAIT_STEP));
+
+    return m_in.readable();
+}
+
+void shm_async_client::consume(std::size_t bytes) {
+    m_in.consume(bytes);
+    m_in.notify_producer();
+}
+
+bool shm_async_client::close() {
+    if (m_closed.exchange(true))
+        return false;
+
+    m_segment->close_slot(m_slot);
+
+    // Queued data is dropped.
+    std::lock_guard<std::mutex> lock(m_send_mutex);
+    m_send_packets.clear();
+    m_has_queued_data.store(false);
+    if (m_limiter && m_limiter->release_all(m_send_queue))
+        m_send_queue_drained.store(true);
+
+    return true;
+}
+
+bool shm_async_client::is_connected() const {
+    return !m_closed.load() && m_segment->slot(m_slot).state.load() == std::uint32_t(shm_slot_state::ACCEPTED);
+}
+
+bool shm_async_client::is_peer_alive() const {
+    return m_segment->is_owner_alive();
+}
+
+} // namespace ignite::network::detail
@@ -0,0 +1,236 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "../send_queue_limiter.h"
+#include "shm_segment.h"
+
+#include <ignite/common/bytes_view.h>
+#include <ignite/network/data_buffer.h>
+#include <ignite/network/end_point.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ignite::network::detail {
+
+/**
+ * Client connection over a shared memory slot.
+ *
+ * Data is sent by copying it into the client to peer ring and received as views into the peer to client ring, so
+ * there are no intermediate buffers and no system calls unless one of the sides has to wait.
+ *
+ * Sending never blocks: data that does not fit into the ring is queued and written by flush_send_queue() as the peer
+ * reads the ring. The peer may itself wait for the client to read its responses, so a sender that waited for the ring
+ * on the receiving thread would never be woken up.
+ */
+class shm_async_client {
+public:
+    /**
+     * Constructor.
+     *
+     * @param segment Segment.
+     * @param slot Index of the accepted slot.
+     * @param addr Address of the node that owns the segment.
+     */
+    shm_async_client(std::shared_ptr<shm_segment> segment, std::uint32_t slot, end_point addr);
+
+    /**
+     * Destructor.
+     */
+    ~shm_async_client();
+
+    /**
+     * Send data. Writes as much as fits into the ring and queues the rest.
+     *
+     * @param data Data to send.
+     * @return @c true on success and @c false if the connection is closed.
+     */
+    bool send(std::vector<std::byte> &&data);
+
+    /**
+     * Write queued data that fits into the ring.
+     *
+     * @return @c true if any data is written.
+     */
+    bool flush_send_queue();
+
+    /**
+     * Check whether there is queued data that does not fit into the ring yet.
+     *
+     * @return @c true if there is queued data.
+     */
+    [[nodiscard]] bool has_queued_data() const { return m_has_queued_data.load(); }
+
+    /**
+     * Wait until the peer reads data from the ring.
+     *
+     * @param timeout Timeout.
+     */
+    void wait_writable(std::chrono::milliseconds timeout) { m_out.wait_writable(std::min(timeout, WAIT_STEP)); }
+
+    /**
+     * Set limiter of the send queue size.
+     *
+     * @param limiter Limiter.
+     */
+    void set_send_queue_limiter(std::shared_ptr<send_queue_limiter> limiter) { m_limiter = std::move(limiter); }
+
+    /**
+     * Account data that is about to be sent in the send queue limits.
+     *
+     * @param bytes Data size.
+     * @return Result. Rejected data should not be sent.
+     */
+    send_queue_limiter::acquire_result reserve_send_queue(size_t bytes) {
+        return m_limiter ? m_limiter->acquire(m_send_queue, bytes) : send_queue_limiter::acquire_result::ACCEPTED;
+    }
+
+    /**
+     * Check whether the send queue has drained to the low watermark since the last call.
+     *
+     * @return @c true if drained.
+     */
+    bool take_send_queue_drained() { return m_send_queue_drained.exchange(false); }
+
+    /**
+     * Wait for the incoming data. Should only be called from the receiving thread.
+     *
+     * @param timeout Timeout. Zero means no waiting.
+     * @return Received data or empty view if there is no data. Stays valid until consume() is called.
+     */
+    bytes_view receive(std::chrono::milliseconds timeout);
+
+    /**
+     * Release data returned by receive().
+     *
+     * @param bytes Number of bytes.
+     */
+    void consume(std::size_t bytes);
+
+    /**
+     * Close the connection.
+     *
+     * @return @c true if the connection was closed by this call.
+     */
+    bool close();
+
+    /**
+     * Check whether the connection is not closed by any of the sides.
+     *
+     * @return @c true if connected.
+     */
+    [[nodiscard]] bool is_connected() const;
+
+    /**
+     * Check whether the peer process is alive. Involves a system call.
+     *
+     * @return @c true if alive.
+     */
+    [[nodiscard]] bool is_peer_alive() const;
+
+    /**
+     * Get client ID.
+     *
+     * @return Client ID.
+     */
+    [[nodiscard]] std::uint64_t id() const { return m_id; }
+
+    /**
+     * Set client ID.
+     *
+     * @param id Client ID.
+     */
+    void set_id(std::uint64_t id) { m_id = id; }
+
+    /**
+     * Get address.
+     *
+     * @return Address.
+     */
+    [[nodiscard]] const end_point &address() const { return m_addr; }
+
+private:
+    /** Wait step. Liveness of the peer is checked between the steps. */
+    static constexpr std::chrono::milliseconds WAIT_STEP{100};
+
+    /**
+     * Write queued packets that fit into the ring.
+     *
+     * @warning Can only be called when holding m_send_mutex lock.
+     *
+     * @return @c true if any data is written.
+     */
+    bool write_packets_locked();
+
+    /**
+     * Account data written to the ring or dropped.
+     *
+     * @param bytes Data size.
+     */
+    void release_send_queue(size_t bytes) {
+        if (m_limiter && m_limiter->release(m_send_queue, bytes))
+            m_send_queue_drained.store(true);
+    }
+
+    /** Segment. */
+    std::shared_ptr<shm_segment> m_segment;
+
+    /** Slot index. */
+    std::uint32_t m_slot;
+
+    /** Client to peer ring. */
+    shm_ring m_out;
+
+    /** Peer to client ring. */
+    shm_ring m_in;
+
+    /** Client ID. */
+    std::uint64_t m_id{0};
+
+    /** Address. */
+    end_point m_addr;
+
+    /** Closed flag. */
+    std::atomic_bool m_closed{false};
+
+    /** Send mutex. The ring is single-producer, so senders are serialized. */
+    std::mutex m_send_mutex;
+
+    /** Packets that do not fit into the ring yet. */
+    std::deque<data_buffer_owning> m_send_packets;
+
+    /** Whether there are queued packets. Checked by the receiving thread without locking. */
+    std::atomic_bool m_has_queued_data{false};
+
+    /** Send queue size limiter. */
+    std::shared_ptr<send_queue_limiter> m_limiter;
+
+    /** Send queue state of the limiter. */
+    send_queue_limiter::queue m_send_queue;
+
+    /** Whether the send queue has drained to the low watermark. */
+    std::atomic_bool m_send_queue_drained{false};
+};
+
+} // namespace ignite::network::detail
@@ -0,0 +1,313 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "shm_async_client_pool.h"
+
+#include "../utils.h"
+
+#include <algorithm>
+
+namespace {
+
+using namespace ignite::network::detail;
+
+fibonacci_sequence<10> fibonacci10;
+
+/** Receive wait timeout. */
+constexpr std::chrono::milliseconds RECEIVE_TIMEOUT{100};
+
+/** Wait timeout for the ring to be read by the peer, while there is queued data. Bounds the receive latency. */
+constexpr std::chrono::milliseconds SEND_WAIT_TIMEOUT{1};
+
+} // namespace
+
+namespace ignite::network::detail {
+
+shm_async_client_pool::shm_async_client_pool(const transport_configuration &cfg)
+    : m_tcp_pool(std::make_shared<linux_async_client_pool>(cfg)) {
+}
+
+shm_async_client_pool::~shm_async_client_pool() {
+    internal_stop();
+}
+
+void shm_async_client_pool::start(std::vector<tcp_range> addrs, uint32_t conn_limit) {
+    if (!m_stopping)
+        throw ignite_error("Client pool is already started");
+
+    m_id_gen = 0;
+    m_stopping = false;
+    m_shm_addrs.clear();
+
+    std::vector<std::shared_ptr<shm_async_client>> shm_clients;
+    std::vector<tcp_range> tcp_addrs;
+    for (auto &range : addrs) {
+        if (range.is_unix_socket() || !is_local_host(range.host)) {
+            tcp_addrs.push_back(std::move(range));
+            continue;
+        }
+
+        for (uint32_t port = range.port; port <= uint32_t(range.port) + range.range; ++port) {
+            end_point addr{range.host, uint16_t(port)};
+            if (auto client = try_connect(addr)) {
+                shm_clients.push_back(std::move(client));
+                m_shm_addrs.push_back(std::move(addr));
+            } else
+                tcp_addrs.emplace_back(range.host, uint16_t(port));
+        }
+    }
+
+    auto shm_count = uint32_t(shm_clients.size());
+    for (auto &client : shm_clients)
+        m_threads.emplace_back(&shm_async_client_pool::run, this, std::move(client));
+
+    std::lock_guard<std::mutex> lock(m_tcp_mutex);
+
+    m_tcp_disabled = conn_limit && shm_count >= conn_limit;
+    m_tcp_conn_limit = conn_limit ? conn_limit - shm_count : 0;
+    if (tcp_addrs.empty() || m_tcp_disabled)
+        return;
+
+    try {
+        m_tcp_pool->start(std::move(tcp_addrs), m_tcp_conn_limit);
+        m_tcp_started = true;
+    } catch (...) {
+        stop();
+
+        throw;
+    }
+}
+
+void shm_async_client_pool::stop() {
+    internal_stop();
+}
+
+void shm_async_client_pool::update_addresses(std::vector<tcp_range> addrs) {
+    if (m_stopping)
+        return;
+
+    // Loopback ranges are split in the same way as on start, so the TCP pool sees the same ranges.
+    std::vector<tcp_range> tcp_addrs;
+    for (auto &range : addrs) {
+        if (range.is_unix_socket() || !is_local_host(range.host)) {
+            tcp_addrs.push_back(std::move(range));
+            continue;
+        }
+
+        for (uint32_t port = range.port; port <= uint32_t(range.port) + range.range; ++port) {
+            end_point addr{range.host, uint16_t(port)};
+            if (std::find(m_shm_addrs.begin(), m_shm_addrs.end(), addr) == m_shm_addrs.end())
+                tcp_addrs.emplace_back(range.host, uint16_t(port));
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_tcp_mutex);
+    if (m_tcp_disabled || m_stopping)
+        return;
+
+    if (m_tcp_started) {
+        m_tcp_pool->update_addresses(std::move(tcp_addrs));
+        return;
+    }
+
+    if (tcp_addrs.empty())
+        return;
+
+    m_tcp_pool->start(std::move(tcp_addrs), m_tcp_conn_limit);
+    m_tcp_started = true;
+}
+
+void shm_async_client_pool::set_handler(std::weak_ptr<async_handler> handler) {
+    m_tcp_pool->set_handler(handler);
+    m_async_handler = std::move(handler);
+}
+
+bool shm_async_client_pool::send(uint64_t id, std::vector<std::byte> &&data) {
+    if (m_stopping)
+        throw ignite_error("Client is stopped");
+
+    if (!(id & SHM_ID_FLAG))
+        return m_tcp_pool->send(id, std::move(data));
+
+    auto client = find_client(id);
+    if (!client)
+        return false;
+
+    auto reserved = client->reserve_send_queue(data.size());
+    if (reserved == send_queue_limiter::acquire_result::REJECTED)
+        throw ignite_error(status_code::BACKPRESSURE, "Send queue of the connection is full");
+
+    // Reported before the data is queued, so the producers learn about the saturation before the drain.
+    if (reserved == send_queue_limiter::acquire_result::SATURATED) {
+        if (auto handler = m_async_handler.lock())
+            handler->on_send_queue_saturation(id, true);
+    }
+
+    return client->send(std::move(data));
+}
+
+void shm_async_client_pool::close(uint64_t id, std::optional<ignite_error> err) {
+    if (m_stopping)
+        return;
+
+    if (!(id & SHM_ID_FLAG)) {
+        m_tcp_pool->close(id, std::move(err));
+        return;
+    }
+
+    if (auto client = find_client(id)) {
+        client->close();
+        remove_client(client, std::move(err));
+    }
+}
+
+std::shared_ptr<shm_async_client> shm_async_client_pool::try_connect(const end_point &addr) {
+    auto segment = shm_segment::open(shm_segment::name_for_port(addr.port));
+    if (!segment)
+        return {};
+
+    auto slot = segment->claim(ACCEPT_TIMEOUT);
+    if (slot < 0)
+        return {};
+
+    return std::make_shared<shm_async_client>(std::move(segment), std::uint32_t(slot), addr);
+}
+
+bool shm_async_client_pool::is_local_host(const std::string &host) {
+    return host == "localhost" || host == "::1" || host.rfind("127.", 0) == 0;
+}
+
+void shm_async_client_pool::run(std::shared_ptr<shm_async_client> client) {
+    auto addr = client->address();
+    size_t failed_attempts = 0;
+
+    while (!m_stopping) {
+        if (client) {
+            failed_attempts = 0;
+            add_client(client);
+
+            auto id = client->id();
+            while (!m_stopping) {
+                // Queued data is written on this thread as the peer reads the ring, and incoming data is handled
+                // meanwhile, so neither side waits for the other forever.
+                bool written = client->has_queued_data() && client->flush_send_queue();
+                handle_send_progress(*client, written);
+
+                bool sending = client->has_queued_data();
+                auto data = client->receive(sending ? std::chrono::milliseconds(0) : RECEIVE_TIMEOUT);
+                if (data.empty()) {
+                    if (!client->is_connected() || !client->is_peer_alive())
+                        break;
+
+                    if (sending)
+                        client->wait_writable(SEND_WAIT_TIMEOUT);
+
+                    continue;
+                }
+
+                if (auto handler = m_async_handler.lock())
+                    handler->on_message_received(id, data);
+
+                client->consume(data.size());
+            }
+
+            client->close();
+            handle_send_progress(*client, false);
+            remove_client(client,
+                m_stopping ? ignite_error("Client stopped")
+                           : ignite_error(status_code::NETWORK, "Connection closed by server"));
+            client.reset();
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(m_stop_mutex);
+            auto timeout = std::chrono::seconds(fibonacci10.get_value(failed_attempts));
+            m_stop_cond.wait_for(lock, timeout, [this] { return m_stopping.load(); });
+        }
+
+        if (m_stopping)
+            break;
+
+        client = try_connect(addr);
+        if (!client) {
+            ++failed_attempts;
+
+            if (auto handler = m_async_handler.lock())
+                handler->on_connection_error(
+                    addr, ignite_error(status_code::NETWORK, "Can not establish shared memory connection"));
+        }
+    }
+}
+
+void shm_async_client_pool::handle_send_progress(shm_async_client &client, bool written) {
+    bool drained = client.take_send_queue_drained();
+    if (!drained && !written)
+        return;
+
+    auto handler = m_async_handler.lock();
+    if (!handler)
+        return;
+
+    if (drained)
+        handler->on_send_queue_saturation(client.id(), false);
+
+    if (written)
+        handler->on_message_sent(client.id());
+}
+
+void shm_async_client_pool::add_client(const std::shared_ptr<shm_async_client> &client) {
+    client->set_id(SHM_ID_FLAG | ++m_id_gen);
+    client->set_send_queue_limiter(m_tcp_pool->get_send_queue_limiter());
+    m_clients.insert(client->id(), client);
+
+    if (auto handler = m_async_handler.lock())
+        handler->on_connection_success(client->address(), client->id());
+}
+
+void shm_async_client_pool::remove_client(
+    const std::shared_ptr<shm_async_client> &client, std::optional<ignite_error> err) {
+    if (!m_clients.erase(client->id()))
+        return;
+
+    if (auto handler = m_async_handler.lock())
+        handler->on_connection_closed(client->id(), std::move(err));
+}
+
+std::shared_ptr<shm_async_client> shm_async_client_pool::find_client(uint64_t id) const {
+    return m_clients.find(id);
+}
+
+void shm_async_client_pool::internal_stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_stop_mutex);
+        m_stopping = true;
+    }
+    m_stop_cond.notify_all();
+
+    for (auto &thread : m_threads)
+        thread.join();
+
+    m_threads.clear();
+
+    std::lock_guard<std::mutex> lock(m_tcp_mutex);
+    if (m_tcp_started) {
+        m_tcp_pool->stop();
+        m_tcp_started = false;
+    }
+}
+
+} // namespace ignite::network::detail
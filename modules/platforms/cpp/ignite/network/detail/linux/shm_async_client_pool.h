@@ -0,0 +1,220 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "linux_async_client_pool.h"
+#include "shm_async_client.h"
+
+#include "../connection_table.h"
+
+#include <ignite/common/ignite_error.h>
+#include <ignite/network/async_client_pool.h>
+#include <ignite/network/async_handler.h>
+#include <ignite/network/end_point.h>
+#include <ignite/network/tcp_range.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ignite::network::detail {
+
+/**
+ * Client pool that connects to the nodes running on the same host over shared memory and to all other nodes over
+ * TCP.
+ *
+ * A node that supports shared memory connections creates a segment named after its client port
+ * (see shm_segment::name_for_port()). Connection to a local address is made over shared memory if the segment exists,
+ * its owner is alive and accepts the connection in time. Otherwise, the address is handed to the TCP pool.
+ *
+ * Shared memory connections share the send queue limits of the TCP pool.
+ */
+class shm_async_client_pool : public async_client_pool {
+public:
+    /** Flag that distinguishes shared memory connection IDs from TCP connection IDs. */
+    static constexpr std::uint64_t SHM_ID_FLAG = std::uint64_t(1) << 63;
+
+    /** Timeout for the node to accept a shared memory connection. */
+    static constexpr std::chrono::milliseconds ACCEPT_TIMEOUT{1000};
+
+    /**
+     * Constructor.
+     *
+     * @param cfg Transport configuration. Used for TCP connections.
+     */
+    explicit shm_async_client_pool(const transport_configuration &cfg);
+
+    /**
+     * Destructor.
+     */
+    ~shm_async_client_pool() override;
+
+    /**
+     * Start connecting to provided addresses.
+     *
+     * @param addrs Addresses to connect to.
+     * @param conn_limit Connection upper limit. Zero means limit is disabled.
+     *
+     * @throw ignite_error on error.
+     */
+    void start(std::vector<tcp_range> addrs, uint32_t conn_limit) override;
+
+    /**
+     * Close all established connections and stops handling threads.
+     */
+    void stop() override;
+
+    /**
+     * Replace the addresses to connect to. Shared memory connections are only made on start, so the addresses they
+     * serve are kept, and the rest are passed to the TCP pool.
+     *
+     * @param addrs Addresses to connect to.
+     */
+    void update_addresses(std::vector<tcp_range> addrs) override;
+
+    /**
+     * Set handler.
+     *
+     * @param handler Handler to set.
+     */
+    void set_handler(std::weak_ptr<async_handler> handler) override;
+
+    /**
+     * Send data to specific established connection.
+     *
+     * @param id Client ID.
+     * @param data Data to be sent.
+     * @return @c true if connection is present and @c false otherwise.
+     *
+     * @throw ignite_error on error.
+     */
+    bool send(uint64_t id, std::vector<std::byte> &&data) override;
+
+    /**
+     * Closes specified connection if it's established.
+     *
+     * @param id Client ID.
+     * @param err Error to report.
+     */
+    void close(uint64_t id, std::optional<ignite_error> err) override;
+
+private:
+    /**
+     * Try to establish shared memory connection.
+     *
+     * @param addr Node address.
+     * @return Client or null if the node does not accept shared memory connections.
+     */
+    static std::shared_ptr<shm_async_client> try_connect(const end_point &addr);
+
+    /**
+     * Check whether the host is a loopback address.
+     *
+     * @param host Host.
+     * @return @c true if the host is a loopback address.
+     */
+    static bool is_local_host(const std::string &host);
+
+    /**
+     * Serve the shared memory connection to the node, re-connecting when the connection is lost.
+     *
+     * @param client Initial client.
+     */
+    void run(std::shared_ptr<shm_async_client> client);
+
+    /**
+     * Notify the handler that queued data is written to the ring, and that the send queue has drained.
+     *
+     * @param client Client.
+     * @param written Whether queued data is written.
+     */
+    void handle_send_progress(shm_async_client &client, bool written);
+
+    /**
+     * Register the client and notify the handler.
+     *
+     * @param client Client.
+     */
+    void add_client(const std::shared_ptr<shm_async_client> &client);
+
+    /**
+     * Unregister the client and notify the handler.
+     *
+     * @param client Client.
+     * @param err Error.
+     */
+    void remove_client(const std::shared_ptr<shm_async_client> &client, std::optional<ignite_error> err);
+
+    /**
+     * Find client by ID. Lock-free.
+     *
+     * @param id Client ID.
+     * @return Client. Null pointer if is not found.
+     */
+    std::shared_ptr<shm_async_client> find_client(uint64_t id) const;
+
+    /**
+     * Close all established connections and stops handling threads.
+     */
+    void internal_stop();
+
+    /** Flag indicating that pool is stopping. */
+    std::atomic_bool m_stopping{true};
+
+    /** Event handler. */
+    std::weak_ptr<async_handler> m_async_handler;
+
+    /** TCP pool. */
+    std::shared_ptr<linux_async_client_pool> m_tcp_pool;
+
+    /** Whether TCP pool is started. */
+    bool m_tcp_started{false};
+
+    /** TCP pool start mutex. */
+    std::mutex m_tcp_mutex;
+
+    /** Connection limit of the TCP pool. Zero means limit is disabled. */
+    uint32_t m_tcp_conn_limit{0};
+
+    /** Whether connection limit is reached by shared memory connections only. */
+    bool m_tcp_disabled{false};
+
+    /** Addresses served by shared memory connections. */
+    std::vector<end_point> m_shm_addrs;
+
+    /** Connection threads. */
+    std::vector<std::thread> m_threads;
+
+    /** ID counter. */
+    std::atomic<uint64_t> m_id_gen{0};
+
+    /** Stop critical section. */
+    std::mutex m_stop_mutex;
+
+    /** Used to interrupt re-connect back-off on stop. */
+    std::condition_variable m_stop_cond;
+
+    /** Client mapping ID -> client */
+    connection_table<shm_async_client> m_clients;
+};
+
+} // namespace ignite::network::detail
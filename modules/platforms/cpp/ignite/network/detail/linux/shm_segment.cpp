@@ -0,0 +1,391 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "shm_segment.h"
+
+#include "../utils.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+
+/** Cache line size. */
+constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+/**
+ * Align size up to the cache line.
+ *
+ * @param size Size.
+ * @return Aligned size.
+ */
+constexpr std::size_t align_to_cache_line(std::size_t size) {
+    return (size + CACHE_LINE_SIZE - 1) & ~(CACHE_LINE_SIZE - 1);
+}
+
+/**
+ * Get futex address of the atomic word.
+ *
+ * @param word Atomic word.
+ * @return Futex address.
+ */
+std::uint32_t *futex_addr(std::atomic<std::uint32_t> &word) {
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t));
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free);
+
+    return reinterpret_cast<std::uint32_t *>(&word);
+}
+
+/** Access mode of the segment. Only the user who runs the owner may open it. */
+constexpr mode_t SEGMENT_MODE = 0600;
+
+/**
+ * Check whether the process is alive and runs as the current user.
+ *
+ * A process that may not be signalled (EPERM) runs as another user, so it is not the one that created the segment,
+ * e.g. the PID was reused after the owner crashed.
+ *
+ * @param pid Process ID.
+ * @return @c true if alive.
+ */
+bool is_process_alive(pid_t pid) {
+    return pid > 0 && ::kill(pid, 0) == 0;
+}
+
+} // namespace
+
+namespace ignite::network::detail {
+
+void futex_wait(std::atomic<std::uint32_t> &word, std::uint32_t expected, std::chrono::milliseconds timeout) {
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count();
+
+    timespec ts{};
+    ts.tv_sec = time_t(ns / 1'000'000'000);
+    ts.tv_nsec = long(ns % 1'000'000'000);
+
+    // Spurious wake-ups and EINTR are fine, callers always re-check their condition.
+    ::syscall(SYS_futex, futex_addr(word), FUTEX_WAIT, expected, &ts, nullptr, 0);
+}
+
+void futex_wake(std::atomic<std::uint32_t> &word) {
+    ::syscall(SYS_futex, futex_addr(word), FUTEX_WAKE, INT32_MAX, nullptr, nullptr, 0);
+}
+
+void shm_ring::reset() {
+    m_header->head.store(0, std::memory_order_relaxed);
+    m_header->tail.store(0, std::memory_order_relaxed);
+    m_header->consumer_waiting.store(0, std::memory_order_relaxed);
+    m_header->producer_waiting.store(0, std::memory_order_relaxed);
+    m_header->signal.fetch_add(1, std::memory_order_release);
+}
+
+std::size_t shm_ring::available() const {
+    auto head = m_header->head.load(std::memory_order_acquire);
+    auto tail = m_header->tail.load(std::memory_order_acquire);
+
+    return std::size_t(head - tail);
+}
+
+std::size_t shm_ring::write(bytes_view data) {
+    auto head = m_header->head.load(std::memory_order_relaxed);
+    auto tail = m_header->tail.load(std::memory_order_acquire);
+
+    auto free_space = m_capacity - std::size_t(head - tail);
+    auto to_write = std::min(free_space, data.size());
+    if (!to_write)
+        return 0;
+
+    auto offset = std::size_t(head & (m_capacity - 1));
+    auto first = std::min(to_write, m_capacity - offset);
+
+    std::memcpy(m_data + offset, data.data(), first);
+    if (first < to_write)
+        std::memcpy(m_data, data.data() + first, to_write - first);
+
+    m_header->head.store(head + to_write, std::memory_order_release);
+
+    return to_write;
+}
+
+bytes_view shm_ring::readable() const {
+    auto tail = m_header->tail.load(std::memory_order_relaxed);
+    auto head = m_header->head.load(std::memory_order_acquire);
+
+    auto offset = std::size_t(tail & (m_capacity - 1));
+    auto size = std::min(std::size_t(head - tail), m_capacity - offset);
+
+    return {m_data + offset, size};
+}
+
+void shm_ring::consume(std::size_t bytes) {
+    auto tail = m_header->tail.load(std::memory_order_relaxed);
+    m_header->tail.store(tail + bytes, std::memory_order_release);
+}
+
+void shm_ring::notify_consumer() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_header->consumer_waiting.load(std::memory_order_relaxed)) {
+        m_header->signal.fetch_add(1, std::memory_order_release);
+        futex_wake(m_header->signal);
+    }
+}
+
+void shm_ring::notify_producer() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_header->producer_waiting.load(std::memory_order_relaxed)) {
+        m_header->signal.fetch_add(1, std::memory_order_release);
+        futex_wake(m_header->signal);
+    }
+}
+
+void shm_ring::wait_readable(std::chrono::milliseconds timeout) {
+    m_header->consumer_waiting.store(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    auto seq = m_header->signal.load(std::memory_order_acquire);
+    if (available() == 0)
+        futex_wait(m_header->signal, seq, timeout);
+
+    m_header->consumer_waiting.store(0, std::memory_order_relaxed);
+}
+
+void shm_ring::wait_writable(std::chrono::milliseconds timeout) {
+    m_header->producer_waiting.store(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    auto seq = m_header->signal.load(std::memory_order_acquire);
+    if (available() == m_capacity)
+        futex_wait(m_header->signal, seq, timeout);
+
+    m_header->producer_waiting.store(0, std::memory_order_relaxed);
+}
+
+shm_segment::~shm_segment() {
+    ::munmap(m_memory, m_size);
+
+    if (m_owner)
+        ::shm_unlink(m_name.c_str());
+}
+
+std::size_t shm_segment::slots_offset() {
+    return align_to_cache_line(sizeof(shm_segment_header));
+}
+
+std::size_t shm_segment::segment_size(std::uint32_t slot_count, std::uint32_t ring_capacity) {
+    return slots_offset() + std::size_t(slot_count) * sizeof(shm_slot)
+        + std::size_t(slot_count) * 2 * std::size_t(ring_capacity);
+}
+
+std::shared_ptr<shm_segment> shm_segment::open(const std::string &name) {
+    int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0)
+        return {};
+
+    // Segment of another user, or one that other users may write to, could be crafted to attack the client.
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || st.st_uid != ::geteuid() || (st.st_mode & 0777) != SEGMENT_MODE
+        || std::size_t(st.st_size) < slots_offset()) {
+        ::close(fd);
+        return {};
+    }
+
+    auto size = std::size_t(st.st_size);
+    void *memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if (memory == MAP_FAILED)
+        return {};
+
+    std::shared_ptr<shm_segment> segment{new shm_segment(name, memory, size, false)};
+
+    auto &hdr = segment->header();
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    bool valid = hdr.magic == MAGIC && hdr.version == VERSION && hdr.slot_count > 0 && hdr.ring_capacity > 0
+        && (hdr.ring_capacity & (hdr.ring_capacity - 1)) == 0
+        && segment_size(hdr.slot_count, hdr.ring_capacity) <= size;
+
+    if (!valid || !segment->is_owner_alive())
+        return {};
+
+    return segment;
+}
+
+std::shared_ptr<shm_segment> shm_segment::create(
+    const std::string &name, std::uint32_t slot_count, std::uint32_t ring_capacity) {
+    if (!slot_count || !ring_capacity || (ring_capacity & (ring_capacity - 1)) != 0)
+        throw ignite_error("Shared memory ring capacity should be a power of two, and slot count should be positive");
+
+    // Remove segment left by a crashed owner, if any.
+    ::shm_unlink(name.c_str());
+
+    int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, SEGMENT_MODE);
+    if (fd < 0)
+        throw_last_system_error("Can not create shared memory segment " + name);
+
+    auto size = segment_size(slot_count, ring_capacity);
+    if (::ftruncate(fd, off_t(size)) != 0) {
+        ::close(fd);
+        ::shm_unlink(name.c_str());
+        throw_last_system_error("Can not resize shared memory segment " + name);
+    }
+
+    void *memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if (memory == MAP_FAILED) {
+        ::shm_unlink(name.c_str());
+        throw_last_system_error("Can not map shared memory segment " + name);
+    }
+
+    std::shared_ptr<shm_segment> segment{new shm_segment(name, memory, size, true)};
+
+    // The memory is zero-filled by ftruncate, so all slots are free and all rings are empty.
+    auto &hdr = segment->header();
+    hdr.version = VERSION;
+    hdr.slot_count = slot_count;
+    hdr.ring_capacity = ring_capacity;
+    hdr.owner_pid = std::int32_t(::getpid());
+
+    std::atomic_thread_fence(std::memory_order_release);
+    hdr.magic = MAGIC;
+
+    return segment;
+}
+
+shm_slot &shm_segment::slot(std::uint32_t idx) const {
+    auto *base = static_cast<std::byte *>(m_memory) + slots_offset();
+
+    return *reinterpret_cast<shm_slot *>(base + std::size_t(idx) * sizeof(shm_slot));
+}
+
+std::byte *shm_segment::ring_data(std::uint32_t idx, bool to_peer) const {
+    auto &hdr = header();
+    auto data_offset = slots_offset() + std::size_t(hdr.slot_count) * sizeof(shm_slot);
+    auto ring_idx = std::size_t(idx) * 2 + (to_peer ? 0 : 1);
+
+    return static_cast<std::byte *>(m_memory) + data_offset + ring_idx * hdr.ring_capacity;
+}
+
+shm_ring shm_segment::to_peer_ring(std::uint32_t idx) const {
+    return {&slot(idx).to_peer, ring_data(idx, true), header().ring_capacity};
+}
+
+shm_ring shm_segment::to_client_ring(std::uint32_t idx) const {
+    return {&slot(idx).to_client, ring_data(idx, false), header().ring_capacity};
+}
+
+std::int32_t shm_segment::claim(std::chrono::milliseconds timeout) {
+    static constexpr std::chrono::milliseconds WAIT_STEP{100};
+
+    auto &hdr = header();
+    for (std::uint32_t idx = 0; idx < hdr.slot_count; ++idx) {
+        auto &s = slot(idx);
+
+        auto expected = std::uint32_t(shm_slot_state::FREE);
+        if (!s.state.compare_exchange_strong(expected, std::uint32_t(shm_slot_state::CLAIMED)))
+            continue;
+
+        s.client_pid.store(std::int32_t(::getpid()), std::memory_order_relaxed);
+        ring_doorbell();
+
+        // Rings are reset by the owner before it accepts the slot.
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (s.state.load() == std::uint32_t(shm_slot_state::CLAIMED)) {
+            auto now = std::chrono::steady_clock::now();
+            if (now >= deadline || !is_owner_alive())
+                break;
+
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now);
+            futex_wait(s.state, std::uint32_t(shm_slot_state::CLAIMED), std::min(left, WAIT_STEP));
+        }
+
+        expected = std::uint32_t(shm_slot_state::CLAIMED);
+        if (s.state.compare_exchange_strong(expected, std::uint32_t(shm_slot_state::FREE)))
+            return -1;
+
+        // The slot is either accepted or rejected by the owner. A rejected slot is freed by the owner.
+        return expected == std::uint32_t(shm_slot_state::ACCEPTED) ? std::int32_t(idx) : -1;
+    }
+
+    return -1;
+}
+
+std::int32_t shm_segment::accept() {
+    auto &hdr = header();
+    for (std::uint32_t idx = 0; idx < hdr.slot_count; ++idx) {
+        auto &s = slot(idx);
+        if (s.state.load() != std::uint32_t(shm_slot_state::CLAIMED))
+            continue;
+
+        to_peer_ring(idx).reset();
+        to_client_ring(idx).reset();
+
+        auto expected = std::uint32_t(shm_slot_state::CLAIMED);
+        if (!s.state.compare_exchange_strong(expected, std::uint32_t(shm_slot_state::ACCEPTED)))
+            continue;
+
+        futex_wake(s.state);
+
+        return std::int32_t(idx);
+    }
+
+    return -1;
+}
+
+void shm_segment::close_slot(std::uint32_t idx) {
+    auto &s = slot(idx);
+
+    auto expected = std::uint32_t(shm_slot_state::ACCEPTED);
+    if (s.state.compare_exchange_strong(expected, std::uint32_t(shm_slot_state::CLOSED))) {
+        // Wake up everyone who waits on the slot so they notice it's closed.
+        futex_wake(s.state);
+        for (auto *ring : {&s.to_peer, &s.to_client}) {
+            ring->signal.fetch_add(1, std::memory_order_release);
+            futex_wake(ring->signal);
+        }
+        ring_doorbell();
+
+        return;
+    }
+
+    if (expected == std::uint32_t(shm_slot_state::CLOSED)
+        || expected == std::uint32_t(shm_slot_state::CLAIMED)) {
+        s.state.compare_exchange_strong(expected, std::uint32_t(shm_slot_state::FREE));
+        ring_doorbell();
+    }
+}
+
+bool shm_segment::is_owner_alive() const {
+    return is_process_alive(pid_t(header().owner_pid));
+}
+
+void shm_segment::ring_doorbell() const {
+    auto &hdr = header();
+    hdr.doorbell.fetch_add(1, std::memory_order_release);
+    futex_wake(hdr.doorbell);
+}
+
+} // namespace ignite::network::detail
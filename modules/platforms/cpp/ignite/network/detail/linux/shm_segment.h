@@ -0,0 +1,388 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <ignite/common/bytes_view.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace ignite::network::detail {
+
+/**
+ * Wait on a process-shared futex word while it equals to the expected value.
+ *
+ * @param word Futex word.
+ * @param expected Expected value.
+ * @param timeout Wait timeout.
+ */
+void futex_wait(std::atomic<std::uint32_t> &word, std::uint32_t expected, std::chrono::milliseconds timeout);
+
+/**
+ * Wake all waiters of a process-shared futex word.
+ *
+ * @param word Futex word.
+ */
+void futex_wake(std::atomic<std::uint32_t> &word);
+
+/**
+ * Shared ring buffer control block. Lives in the shared memory.
+ */
+struct shm_ring_header {
+    /** Producer position. Only modified by the producer. */
+    alignas(64) std::atomic<std::uint64_t> head;
+
+    /** Consumer position. Only modified by the consumer. */
+    alignas(64) std::atomic<std::uint64_t> tail;
+
+    /** Futex word bumped by both sides whenever the ring state changes. */
+    alignas(64) std::atomic<std::uint32_t> signal;
+
+    /** Set while the consumer is waiting for data. */
+    std::atomic<std::uint32_t> consumer_waiting;
+
+    /** Set while the producer is waiting for free space. */
+    std::atomic<std::uint32_t> producer_waiting;
+};
+
+/**
+ * Single-producer single-consumer byte ring over shared memory.
+ *
+ * The ring carries a byte stream, just like a stream socket, so the codecs work on top of it unchanged.
+ */
+class shm_ring {
+public:
+    // Default
+    shm_ring() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param header Control block.
+     * @param data Data area.
+     * @param capacity Capacity of the data area. Should be a power of two.
+     */
+    shm_ring(shm_ring_header *header, std::byte *data, std::size_t capacity)
+        : m_header(header)
+        , m_data(data)
+        , m_capacity(capacity) {}
+
+    /**
+     * Reset positions. Should only be called when neither side uses the ring.
+     */
+    void reset();
+
+    /**
+     * Write as much data as fits into the ring. Producer side.
+     *
+     * @param data Data to write.
+     * @return Number of written bytes.
+     */
+    std::size_t write(bytes_view data);
+
+    /**
+     * Get the largest contiguous chunk of data available for reading. Consumer side.
+     *
+     * @return Readable data. Stays valid until consume() is called.
+     */
+    [[nodiscard]] bytes_view readable() const;
+
+    /**
+     * Release read data. Consumer side.
+     *
+     * @param bytes Number of bytes to release.
+     */
+    void consume(std::size_t bytes);
+
+    /**
+     * Wake the consumer if it is waiting. Producer side.
+     */
+    void notify_consumer();
+
+    /**
+     * Wake the producer if it is waiting. Consumer side.
+     */
+    void notify_producer();
+
+    /**
+     * Wait until there is data to read or timeout expires. Consumer side.
+     *
+     * @param timeout Timeout.
+     */
+    void wait_readable(std::chrono::milliseconds timeout);
+
+    /**
+     * Wait until there is free space to write or timeout expires. Producer side.
+     *
+     * @param timeout Timeout.
+     */
+    void wait_writable(std::chrono::milliseconds timeout);
+
+private:
+    /**
+     * Get number of bytes available for reading.
+     *
+     * @return Number of bytes.
+     */
+    [[nodiscard]] std::size_t available() const;
+
+    /** Control block. */
+    shm_ring_header *m_header{nullptr};
+
+    /** Data area. */
+    std::byte *m_data{nullptr};
+
+    /** Data area capacity. */
+    std::size_t m_capacity{0};
+};
+
+/**
+ * Shared memory slot state.
+ */
+enum class shm_slot_state : std::uint32_t {
+    /** Slot is free and can be claimed by a client. */
+    FREE = 0,
+
+    /** Slot is claimed by a client and waits for the peer to accept it. */
+    CLAIMED,
+
+    /** Connection is established. */
+    ACCEPTED,
+
+    /** One of the sides closed the connection. The other side frees the slot. */
+    CLOSED,
+};
+
+/**
+ * Shared memory slot. A pair of rings for a single connection. Lives in the shared memory.
+ */
+struct shm_slot {
+    /** Slot state. See shm_slot_state. Also used as a futex word. */
+    std::atomic<std::uint32_t> state;
+
+    /** PID of the client process that claimed the slot. */
+    std::atomic<std::int32_t> client_pid;
+
+    /** Client to peer ring. */
+    shm_ring_header to_peer;
+
+    /** Peer to client ring. */
+    shm_ring_header to_client;
+};
+
+/**
+ * Shared memory segment header. Lives in the shared memory.
+ */
+struct shm_segment_header {
+    /** Magic value. */
+    std::uint32_t magic;
+
+    /** Layout version. */
+    std::uint32_t version;
+
+    /** Number of slots. */
+    std::uint32_t slot_count;
+
+    /** Capacity of every ring in bytes. */
+    std::uint32_t ring_capacity;
+
+    /** PID of the peer process that owns the segment. */
+    std::int32_t owner_pid;
+
+    /** Futex word the peer waits on. Bumped by clients on every event. */
+    std::atomic<std::uint32_t> doorbell;
+};
+
+/**
+ * Memory-mapped shared memory segment that contains connection slots.
+ *
+ * The segment is created by the peer co-located with the client (the owner) and opened by clients.
+ */
+class shm_segment {
+public:
+    /** Magic value of the segment. */
+    static constexpr std::uint32_t MAGIC = 0x4d534749; // "IGSM"
+
+    /** Current layout version. */
+    static constexpr std::uint32_t VERSION = 1;
+
+    /** Prefix of the segment name. The segment of the node listening on a port is named "<prefix><port>". */
+    static constexpr const char *NAME_PREFIX = "/ignite-client-";
+
+    // Deleted
+    shm_segment(const shm_segment &) = delete;
+    shm_segment &operator=(const shm_segment &) = delete;
+
+    /**
+     * Destructor. Unmaps the segment and removes it if it was created by this instance.
+     */
+    ~shm_segment();
+
+    /**
+     * Get the name of the segment for the specified port.
+     *
+     * @param port TCP port of the node.
+     * @return Segment name.
+     */
+    [[nodiscard]] static std::string name_for_port(std::uint16_t port) { return NAME_PREFIX + std::to_string(port); }
+
+    /**
+     * Open existing segment.
+     *
+     * @param name Segment name.
+     * @return Segment or null if the segment does not exist, is invalid or its owner is not alive.
+     */
+    [[nodiscard]] static std::shared_ptr<shm_segment> open(const std::string &name);
+
+    /**
+     * Create a new segment. Used by the owner side.
+     *
+     * @param name Segment name.
+     * @param slot_count Number of slots.
+     * @param ring_capacity Capacity of every ring. Should be a power of two.
+     * @return Segment.
+     *
+     * @throw ignite_error on error.
+     */
+    [[nodiscard]] static std::shared_ptr<shm_segment> create(
+        const std::string &name, std::uint32_t slot_count, std::uint32_t ring_capacity);
+
+    /**
+     * Get segment header.
+     *
+     * @return Header.
+     */
+    [[nodiscard]] shm_segment_header &header() const { return *static_cast<shm_segment_header *>(m_memory); }
+
+    /**
+     * Get slot.
+     *
+     * @param idx Slot index.
+     * @return Slot.
+     */
+    [[nodiscard]] shm_slot &slot(std::uint32_t idx) const;
+
+    /**
+     * Get client to peer ring of the slot.
+     *
+     * @param idx Slot index.
+     * @return Ring.
+     */
+    [[nodiscard]] shm_ring to_peer_ring(std::uint32_t idx) const;
+
+    /**
+     * Get peer to client ring of the slot.
+     *
+     * @param idx Slot index.
+     * @return Ring.
+     */
+    [[nodiscard]] shm_ring to_client_ring(std::uint32_t idx) const;
+
+    /**
+     * Claim a free slot and wait for the owner to accept it. Client side.
+     *
+     * @param timeout Accept timeout.
+     * @return Slot index or -1 if there are no free slots or the slot was not accepted in time.
+     */
+    [[nodiscard]] std::int32_t claim(std::chrono::milliseconds timeout);
+
+    /**
+     * Accept a claimed slot. Owner side.
+     *
+     * @return Slot index or -1 if there are no claimed slots.
+     */
+    [[nodiscard]] std::int32_t accept();
+
+    /**
+     * Close the slot. The side that observes the slot being closed by the other side frees it.
+     *
+     * @param idx Slot index.
+     */
+    void close_slot(std::uint32_t idx);
+
+    /**
+     * Check whether the owner process is alive.
+     *
+     * @return @c true if alive.
+     */
+    [[nodiscard]] bool is_owner_alive() const;
+
+    /**
+     * Ring the owner doorbell.
+     */
+    void ring_doorbell() const;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param name Segment name.
+     * @param memory Mapped memory.
+     * @param size Size of the mapped memory.
+     * @param owner Whether the segment was created by this instance.
+     */
+    shm_segment(std::string name, void *memory, std::size_t size, bool owner)
+        : m_name(std::move(name))
+        , m_memory(memory)
+        , m_size(size)
+        , m_owner(owner) {}
+
+    /**
+     * Calculate segment size.
+     *
+     * @param slot_count Number of slots.
+     * @param ring_capacity Capacity of every ring.
+     * @return Size in bytes.
+     */
+    [[nodiscard]] static std::size_t segment_size(std::uint32_t slot_count, std::uint32_t ring_capacity);
+
+    /**
+     * Get the offset of the first slot.
+     *
+     * @return Offset in bytes.
+     */
+    [[nodiscard]] static std::size_t slots_offset();
+
+    /**
+     * Get the data area of the ring.
+     *
+     * @param idx Slot index.
+     * @param to_peer Direction.
+     * @return Pointer to the data area.
+     */
+    [[nodiscard]] std::byte *ring_data(std::uint32_t idx, bool to_peer) const;
+
+    /** Segment name. */
+    std::string m_name;
+
+    /** Mapped memory. */
+    void *m_memory{nullptr};
+
+    /** Mapped size. */
+    std::size_t m_size{0};
+
+    /** Whether the segment was created by this instance. */
+    bool m_owner{false};
+};
+
+} // namespace ignite::network::detail
@@ -0,0 +1,166 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "shm_async_client.h"
+#include "shm_segment.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace ignite;
+using namespace ignite::network;
+using namespace ignite::network::detail;
+
+namespace {
+
+/**
+ * Get unique segment name for the test.
+ *
+ * @return Segment name.
+ */
+std::string test_segment_name() {
+    return "/ignite-shm-test-" + std::to_string(::getpid());
+}
+
+/**
+ * Mock peer that echoes everything it receives in the slot back to the client.
+ *
+ * @param segment Segment.
+ * @param slot Slot index.
+ */
+void echo(shm_segment &segment, std::uint32_t slot) {
+    auto in = segment.to_peer_ring(slot);
+    auto out = segment.to_client_ring(slot);
+
+    while (segment.slot(slot).state.load() == std::uint32_t(shm_slot_state::ACCEPTED)) {
+        auto data = in.readable();
+        if (data.empty()) {
+            in.wait_readable(std::chrono::milliseconds(10));
+            continue;
+        }
+
+        auto written = out.write(data);
+        if (!written) {
+            out.wait_writable(std::chrono::milliseconds(10));
+            continue;
+        }
+
+        out.notify_consumer();
+        in.consume(written);
+        in.notify_producer();
+    }
+}
+
+} // namespace
+
+TEST(shm_segment, open_missing) {
+    EXPECT_EQ(nullptr, shm_segment::open(test_segment_name()));
+}
+
+TEST(shm_segment, open_foreign_mode) {
+    auto owner = shm_segment::create(test_segment_name(), 1, 64);
+
+    // Segment that other users may write to is never trusted.
+    int fd = ::shm_open(test_segment_name().c_str(), O_RDWR, 0);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(0, ::fchmod(fd, 0666));
+    ::close(fd);
+
+    EXPECT_EQ(nullptr, shm_segment::open(test_segment_name()));
+}
+
+TEST(shm_segment, open_dead_owner) {
+    auto owner = shm_segment::create(test_segment_name(), 1, 64);
+
+    // PID 1 belongs to another user unless the test runs as root. Either way, it is not the owner of the segment.
+    owner->header().owner_pid = ::getuid() ? 1 : INT32_MAX;
+
+    EXPECT_EQ(nullptr, shm_segment::open(test_segment_name()));
+}
+
+TEST(shm_segment, claim_not_accepted) {
+    auto owner = shm_segment::create(test_segment_name(), 1, 64);
+    auto segment = shm_segment::open(test_segment_name());
+    ASSERT_NE(nullptr, segment);
+
+    EXPECT_EQ(-1, segment->claim(std::chrono::milliseconds(50)));
+    EXPECT_EQ(std::uint32_t(shm_slot_state::FREE), owner->slot(0).state.load());
+}
+
+TEST(shm_segment, echo) {
+    auto owner = shm_segment::create(test_segment_name(), 2, 64);
+
+    std::thread peer([&owner] {
+        std::int32_t slot = -1;
+        while (slot < 0) {
+            auto seq = owner->header().doorbell.load();
+            slot = owner->accept();
+            if (slot < 0)
+                futex_wait(owner->header().doorbell, seq, std::chrono::milliseconds(10));
+        }
+
+        echo(*owner, std::uint32_t(slot));
+        owner->close_slot(std::uint32_t(slot));
+    });
+
+    auto segment = shm_segment::open(test_segment_name());
+    ASSERT_NE(nullptr, segment);
+
+    auto slot = segment->claim(std::chrono::seconds(5));
+    ASSERT_GE(slot, 0);
+
+    shm_async_client client(segment, std::uint32_t(slot), {"127.0.0.1", 10800});
+
+    // Much larger than the ring capacity, so the data wraps around many times and both sides have to wait.
+    std::vector<std::byte> sent(10000);
+    for (size_t i = 0; i < sent.size(); ++i)
+        sent[i] = std::byte(i % 251);
+
+    // Sent on the receiving thread, as the pool does from the handlers. The echo only fits into the rings if the
+    // client reads it while sending, so a blocking send would never complete.
+    EXPECT_TRUE(client.send(std::vector<std::byte>(sent)));
+    EXPECT_TRUE(client.has_queued_data());
+
+    std::vector<std::byte> received;
+    while (received.size() < sent.size() && client.is_connected()) {
+        client.flush_send_queue();
+
+        auto timeout = std::chrono::milliseconds(client.has_queued_data() ? 0 : 10);
+        auto data = client.receive(timeout);
+        if (data.empty() && client.has_queued_data())
+            client.wait_writable(std::chrono::milliseconds(1));
+
+        received.insert(received.end(), data.begin(), data.end());
+        client.consume(data.size());
+    }
+
+    EXPECT_FALSE(client.has_queued_data());
+    EXPECT_EQ(sent, received);
+
+    EXPECT_TRUE(client.close());
+    EXPECT_FALSE(client.close());
+    EXPECT_FALSE(client.send(std::vector<std::byte>(sent)));
+
+    peer.join();
+    EXPECT_EQ(std::uint32_t(shm_slot_state::FREE), owner->slot(std::uint32_t(slot)).state.load());
+}
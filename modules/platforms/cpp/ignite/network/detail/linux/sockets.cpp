@@ -82,8 +82,11 @@ std::string get_last_socket_error_message() {
 }
 
 void try_set_socket_options(int socket_fd, int buf_size, bool no_delay, bool out_of_band, bool keep_alive) {
-    setsockopt(socket_fd, SOL_SOCKET, SO_SNDBUF, reinterpret_cast<char *>(&buf_size), sizeof(buf_size));
-    setsockopt(socket_fd, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<char *>(&buf_size), sizeof(buf_size));
+    // Setting the buffer sizes explicitly disables their autotuning.
+    if (buf_size > 0) {
+        setsockopt(socket_fd, SOL_SOCKET, SO_SNDBUF, reinterpret_cast<char *>(&buf_size), sizeof(buf_size));
+        setsockopt(socket_fd, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<char *>(&buf_size), sizeof(buf_size));
+    }
 
     int iNoDelay = no_delay ? 1 : 0;
     setsockopt(socket_fd, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char *>(&iNoDelay), sizeof(iNoDelay));
@@ -118,6 +121,26 @@ void try_set_socket_options(int socket_fd, int buf_size, bool no_delay, bool out
         socket_fd, IPPROTO_TCP, TCP_KEEPINTVL, reinterpret_cast<char *>(&idle_retry_opt), sizeof(idle_retry_opt));
 }
 
+bool try_enable_zero_copy(int socket_fd) {
+#ifdef SO_ZEROCOPY
+    int enable = 1;
+    return setsockopt(socket_fd, SOL_SOCKET, SO_ZEROCOPY, &enable, sizeof(enable)) == 0;
+#else
+    (void) socket_fd;
+    return false;
+#endif
+}
+
+void try_enable_busy_poll(int socket_fd, int usec) {
+#ifdef SO_BUSY_POLL
+    // May fail without CAP_NET_ADMIN if the value exceeds net.core.busy_read. Latency is just not improved then.
+    setsockopt(socket_fd, SOL_SOCKET, SO_BUSY_POLL, &usec, sizeof(usec));
+#else
+    (void) socket_fd;
+    (void) usec;
+#endif
+}
+
 bool set_non_blocking_mode(int socket_fd, bool non_blocking) {
     int flags = fcntl(socket_fd, F_GETFL, 0);
     if (flags == -1)
@@ -41,13 +41,29 @@ std::string get_last_socket_error_message();
  * Try and set socket options.
  *
  * @param socket_fd Socket file descriptor.
- * @param buf_size Buffer size.
+ * @param buf_size Buffer size. Zero or negative value keeps the buffers autotuned by the kernel.
  * @param no_delay Set no-delay mode.
  * @param out_of_band Set out-of-Band mode.
  * @param keep_alive Keep alive mode.
  */
 void try_set_socket_options(int socket_fd, int buf_size, bool no_delay, bool out_of_band, bool keep_alive);
 
+/**
+ * Try and enable zero-copy sends (SO_ZEROCOPY) for the socket.
+ *
+ * @param socket_fd Socket file descriptor.
+ * @return @c true if zero-copy sends are supported and enabled.
+ */
+bool try_enable_zero_copy(int socket_fd);
+
+/**
+ * Try and enable busy polling (SO_BUSY_POLL) for the socket.
+ *
+ * @param socket_fd Socket file descriptor.
+ * @param usec Time to busy poll the device queue on receive, in microseconds.
+ */
+void try_enable_busy_poll(int socket_fd, int usec);
+
 /**
  * Set non blocking mode for socket.
  *
@@ -0,0 +1,308 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ignite/common/bytes.h>
+#include <ignite/network/network.h>
+#include <ignite/protocol/utils.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace ignite;
+using namespace ignite::network;
+
+namespace {
+
+/** Time to wait for an event. */
+constexpr auto WAIT_TIMEOUT = std::chrono::seconds(10);
+
+/**
+ * Server that accepts a single connection, sends the protocol magic and echoes everything it receives.
+ */
+class echo_server {
+public:
+    /**
+     * Constructor.
+     *
+     * @param unix_socket Listen on a Unix domain socket instead of a loopback TCP port.
+     */
+    explicit echo_server(bool unix_socket) {
+        if (unix_socket) {
+            static std::atomic_int counter{0};
+            m_path = "/tmp/ignite-echo-" + std::to_string(getpid()) + "-" + std::to_string(counter++) + ".sock";
+            unlink(m_path.c_str());
+
+            m_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+            EXPECT_GE(m_fd, 0);
+
+            sockaddr_un addr{};
+            addr.sun_family = AF_UNIX;
+            std::strncpy(addr.sun_path, m_path.c_str(), sizeof(addr.sun_path) - 1);
+
+            EXPECT_EQ(0, bind(m_fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)));
+        } else {
+            m_fd = socket(AF_INET, SOCK_STREAM, 0);
+            EXPECT_GE(m_fd, 0);
+
+            sockaddr_in addr{};
+            addr.sin_family = AF_INET;
+            addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            addr.sin_port = 0;
+
+            EXPECT_EQ(0, bind(m_fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)));
+
+            socklen_t len = sizeof(addr);
+            EXPECT_EQ(0, getsockname(m_fd, reinterpret_cast<sockaddr *>(&addr), &len));
+            m_port = ntohs(addr.sin_port);
+        }
+
+        EXPECT_EQ(0, listen(m_fd, 16));
+
+        m_thread = std::thread([this] { run(); });
+    }
+
+    /**
+     * Destructor.
+     */
+    ~echo_server() {
+        m_stopping.store(true);
+        m_thread.join();
+
+        close(m_fd);
+        if (!m_path.empty())
+            unlink(m_path.c_str());
+    }
+
+    /**
+     * Get address to connect to.
+     *
+     * @return Address.
+     */
+    [[nodiscard]] std::vector<tcp_range> addrs() const {
+        if (!m_path.empty())
+            return {tcp_range(std::string(UNIX_SOCKET_PREFIX) + m_path, 0)};
+
+        return {tcp_range("127.0.0.1", m_port)};
+    }
+
+private:
+    /**
+     * Accept the connection and echo the data until the client disconnects or the server is stopped.
+     */
+    void run() {
+        int fd = -1;
+        while (fd < 0 && !m_stopping.load()) {
+            pollfd pfd{m_fd, POLLIN, 0};
+            if (poll(&pfd, 1, 10) == 1)
+                fd = accept(m_fd, nullptr, nullptr);
+        }
+
+        if (fd < 0)
+            return;
+
+        if (m_path.empty()) {
+            int no_delay = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+        }
+
+        send(fd, protocol::MAGIC_BYTES.data(), protocol::MAGIC_BYTES.size(), MSG_NOSIGNAL);
+
+        char buf[4096];
+        while (!m_stopping.load()) {
+            pollfd pfd{fd, POLLIN, 0};
+            if (poll(&pfd, 1, 10) != 1)
+                continue;
+
+            auto received = recv(fd, buf, sizeof(buf), 0);
+            if (received <= 0)
+                break;
+
+            for (ssize_t sent = 0; sent < received;) {
+                auto res = send(fd, buf + sent, std::size_t(received - sent), MSG_NOSIGNAL);
+                if (res <= 0)
+                    break;
+
+                sent += res;
+            }
+        }
+
+        close(fd);
+    }
+
+    /** Listening socket. */
+    int m_fd{-1};
+
+    /** Port. */
+    std::uint16_t m_port{0};
+
+    /** Path of the Unix domain socket. Empty for TCP. */
+    std::string m_path;
+
+    /** Stop flag. */
+    std::atomic_bool m_stopping{false};
+
+    /** Server thread. */
+    std::thread m_thread;
+};
+
+/**
+ * Handler that counts the received messages.
+ */
+class echo_handler : public async_handler {
+public:
+    void on_connection_success(const end_point &, uint64_t id) override {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_id = id;
+        }
+        m_condition.notify_all();
+    }
+
+    void on_connection_error(const end_point &, ignite_error) override {}
+
+    void on_connection_closed(uint64_t, std::optional<ignite_error>) override {}
+
+    void on_message_received(uint64_t, bytes_view) override {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ++m_received;
+        }
+        m_condition.notify_all();
+    }
+
+    void on_message_sent(uint64_t) override {}
+
+    /**
+     * Wait for the connection.
+     *
+     * @return Connection ID, or zero if the connection is not established in time.
+     */
+    std::uint64_t wait_connected() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait_for(lock, WAIT_TIMEOUT, [this] { return m_id != 0; });
+
+        return m_id;
+    }
+
+    /**
+     * Wait until the number of the received messages reaches the value.
+     *
+     * @param count Number of messages.
+     * @return @c true if the messages are received in time.
+     */
+    bool wait_received(std::size_t count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_condition.wait_for(lock, WAIT_TIMEOUT, [this, count] { return m_received >= count; });
+    }
+
+private:
+    /** Mutex. */
+    std::mutex m_mutex;
+
+    /** Condition. */
+    std::condition_variable m_condition;
+
+    /** Connection ID. */
+    std::uint64_t m_id{0};
+
+    /** Number of the received messages. */
+    std::size_t m_received{0};
+};
+
+/**
+ * Make a length-prefixed frame.
+ *
+ * @param size Payload size.
+ * @return Frame.
+ */
+std::vector<std::byte> make_frame(std::size_t size) {
+    std::vector<std::byte> frame(4 + size, std::byte{0x5a});
+    bytes::store<endian::BIG>(frame.data(), std::int32_t(size));
+
+    return frame;
+}
+
+/**
+ * Send frames one at a time, each after the echo of the previous one is received.
+ *
+ * @param unix_socket Connect over a Unix domain socket.
+ * @param frames Number of frames.
+ * @param size Payload size of a frame.
+ * @return Time of all the round trips.
+ */
+std::chrono::steady_clock::duration round_trips(bool unix_socket, std::size_t frames, std::size_t size) {
+    echo_server server(unix_socket);
+
+    auto handler = std::make_shared<echo_handler>();
+    auto pool = make_default_async_client_pool();
+    pool->set_handler(handler);
+    pool->start(server.addrs(), 1);
+
+    auto id = handler->wait_connected();
+    EXPECT_NE(0, id);
+
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < frames && id; ++i) {
+        EXPECT_TRUE(pool->send(id, make_frame(size)));
+        if (!handler->wait_received(i + 1)) {
+            ADD_FAILURE() << "Echo of the frame " << i << " is not received";
+            break;
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    pool->stop();
+
+    return elapsed;
+}
+
+} // namespace
+
+TEST(unix_socket, echo) {
+    round_trips(true, 10, 64);
+}
+
+// Round-trip benchmark, not a part of the unit suite. Run it with --gtest_also_run_disabled_tests.
+TEST(unix_socket, DISABLED_round_trip_throughput) {
+    constexpr std::size_t FRAMES = 100'000;
+    constexpr std::size_t SIZE = 64;
+
+    for (bool unix_socket : {false, true}) {
+        std::chrono::duration<double> elapsed = round_trips(unix_socket, FRAMES, SIZE);
+
+        std::cout << (unix_socket ? "Unix socket: " : "TCP loopback: ") << FRAMES << " round trips of " << SIZE
+                  << "-byte frames in " << elapsed.count() << " s, " << std::int64_t(FRAMES / elapsed.count())
+                  << " round trips/s" << std::endl;
+    }
+}
@@ -18,10 +18,12 @@
 #include <ignite/network/detail/linux/linux_async_client.h>
 
 #include <algorithm>
+#include <cerrno>
 #include <cstring>
 
 #include <sys/epoll.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 // We don't want to use epoll-shim macro here, because we have other close() functions.
@@ -46,6 +48,10 @@ linux_async_client::~linux_async_client() {
     shutdown(std::nullopt);
 
     close();
+
+    // Data can be sent after the client is closed and before it is removed from the pool.
+    if (m_limiter)
+        m_limiter->release_all(m_send_queue);
 }
 
 bool linux_async_client::shutdown(std::optional<ignite_error> err) {
@@ -69,6 +75,10 @@ bool linux_async_client::close() {
     m_fd = -1;
     m_state = state::CLOSED;
 
+    // Queued data is dropped.
+    if (m_limiter && m_limiter->release_all(m_send_queue))
+        m_send_queue_drained.store(true);
+
     return true;
 }
 
@@ -82,18 +92,61 @@ bool linux_async_client::send(std::vector<std::byte> &&data) {
     return send_next_packet_locked();
 }
 
+bool linux_async_client::flush_submissions() {
+    std::lock_guard<std::mutex> lock(m_send_mutex);
+
+    bool in_progress = !m_send_packets.empty();
+    m_submissions.consume_all([this](std::vector<std::byte> &&data) { m_send_packets.emplace_back(std::move(data)); });
+
+    // If there is a send in progress, the rest is sent when the socket becomes writable.
+    if (in_progress)
+        return true;
+
+    return send_next_packet_locked();
+}
+
 bool linux_async_client::send_next_packet_locked() {
     if (m_send_packets.empty())
         return true;
 
-    auto &packet = m_send_packets.front();
-    auto dataView = packet.get_bytes_view();
+    iovec iov[MAX_SEND_BATCH];
+    size_t iov_cnt = 0;
+    for (const auto &packet : m_send_packets) {
+        if (iov_cnt == MAX_SEND_BATCH)
+            break;
 
-    ssize_t ret = ::send(m_fd, dataView.data(), dataView.size(), 0);
-    if (ret < 0)
-        return false;
+        auto data_view = packet.get_bytes_view();
+        iov[iov_cnt].iov_base = const_cast<std::byte *>(data_view.data());
+        iov[iov_cnt].iov_len = data_view.size();
+        ++iov_cnt;
+    }
+
+    msghdr msg{};
+    msg.msg_iov = iov;
+    msg.msg_iovlen = iov_cnt;
+
+    ssize_t ret = ::sendmsg(m_fd, &msg, 0);
+    if (ret < 0) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+            return false;
+
+        ret = 0;
+    }
+
+    auto sent = size_t(ret);
+    release_send_queue(sent);
+
+    while (sent && !m_send_packets.empty()) {
+        auto &packet = m_send_packets.front();
+        auto packet_size = packet.get_bytes_view().size();
+        if (sent < packet_size) {
+            packet.skip(sent);
+            break;
+        }
 
-    packet.skip(static_cast<int32_t>(ret));
+        sent -= packet_size;
+        m_send_packets.pop_front();
+    }
 
     enable_send_notifications();
 
@@ -0,0 +1,242 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ignite/network/detail/linux/linux_async_worker_thread.h>
+#include <ignite/network/detail/linux/linux_event_loop.h>
+
+#include "../utils.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+// We don't want to use epoll-shim macro here, because we have other close() functions.
+#undef close
+
+namespace ignite::network::detail {
+
+linux_event_loop::~linux_event_loop() {
+    stop();
+
+    if (m_wake_event >= 0)
+        epoll_shim_close(m_wake_event);
+
+    if (m_epoll >= 0)
+        epoll_shim_close(m_epoll);
+}
+
+std::shared_ptr<linux_event_loop> linux_event_loop::start() {
+    auto res = create();
+
+    // The thread keeps the loop alive, so the loop can be safely released from a callback.
+    res->m_thread = std::thread([res] { res->run(); });
+
+    return res;
+}
+
+std::shared_ptr<linux_event_loop> linux_event_loop::create() {
+    std::shared_ptr<linux_event_loop> res{new linux_event_loop()};
+
+    res->m_epoll = epoll_create(1);
+    if (res->m_epoll < 0)
+        throw_last_system_error("Failed to create epoll instance");
+
+    res->m_wake_event = eventfd(0, EFD_NONBLOCK);
+    if (res->m_wake_event < 0)
+        throw_last_system_error("Failed to create wake event instance");
+
+    epoll_event event{};
+    memset(&event, 0, sizeof(event));
+
+    event.events = EPOLLIN;
+    event.data.ptr = &res->m_wake_event;
+
+    int ret = epoll_ctl(res->m_epoll, EPOLL_CTL_ADD, res->m_wake_event, &event);
+    if (ret < 0)
+        throw_last_system_error("Failed to create wake event instance");
+
+    return res;
+}
+
+std::shared_ptr<linux_event_loop> linux_event_loop::select(const std::shared_ptr<event_loop_group> &group) {
+    if (auto external = std::dynamic_pointer_cast<linux_external_event_loop>(group))
+        return external->get_loop();
+
+    if (auto loops = std::dynamic_pointer_cast<linux_event_loop_group>(group))
+        return loops->next();
+
+    return {};
+}
+
+void linux_event_loop::stop() {
+    if (m_stopping.exchange(true))
+        return;
+
+    wake();
+
+    if (!m_thread.joinable())
+        return;
+
+    // The last reference can be released on the loop thread.
+    if (m_thread.get_id() == std::this_thread::get_id())
+        m_thread.detach();
+    else
+        m_thread.join();
+}
+
+void linux_event_loop::attach(linux_async_worker_thread &worker) {
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_workers_mutex);
+
+        epoll_event event{};
+        memset(&event, 0, sizeof(event));
+
+        event.events = EPOLLIN;
+        event.data.ptr = &worker;
+
+        int res = epoll_ctl(m_epoll, EPOLL_CTL_ADD, worker.get_epoll(), &event);
+        if (res < 0)
+            throw_last_system_error("Can not add worker to event loop");
+
+        m_workers.push_back(&worker);
+    }
+
+    wake();
+}
+
+void linux_event_loop::detach(linux_async_worker_thread &worker) {
+    std::lock_guard<std::recursive_mutex> lock(m_workers_mutex);
+
+    auto it = std::find(m_workers.begin(), m_workers.end(), &worker);
+    if (it == m_workers.end())
+        return;
+
+    m_workers.erase(it);
+
+    epoll_ctl(m_epoll, EPOLL_CTL_DEL, worker.get_epoll(), nullptr);
+}
+
+void linux_event_loop::wake() {
+    int64_t value = 1;
+    ssize_t res = epoll_shim_write(m_wake_event, &value, sizeof(value));
+
+    (void) res;
+}
+
+bool linux_event_loop::is_attached(const linux_async_worker_thread *worker) const {
+    return std::find(m_workers.begin(), m_workers.end(), worker) != m_workers.end();
+}
+
+int linux_event_loop::get_timeout() {
+    std::lock_guard<std::recursive_mutex> lock(m_workers_mutex);
+
+    int timeout = -1;
+    for (auto *worker : m_workers) {
+        int worker_timeout = worker->calculate_connection_timeout();
+        if (worker_timeout >= 0 && (timeout < 0 || worker_timeout < timeout))
+            timeout = worker_timeout;
+    }
+
+    return timeout;
+}
+
+int linux_event_loop::handle_timeouts() {
+    std::lock_guard<std::recursive_mutex> lock(m_workers_mutex);
+
+    // Workers can be detached by the callbacks.
+    auto workers = m_workers;
+
+    int timeout = -1;
+    for (auto *worker : workers) {
+        if (!is_attached(worker))
+            continue;
+
+        int worker_timeout = worker->prepare_wait();
+        if (worker_timeout >= 0 && (timeout < 0 || worker_timeout < timeout))
+            timeout = worker_timeout;
+    }
+
+    return timeout;
+}
+
+void linux_event_loop::handle_events(int timeout) {
+    enum { MAX_EVENTS = 16 };
+
+    epoll_event events[MAX_EVENTS];
+
+    int res = epoll_wait(m_epoll, events, MAX_EVENTS, timeout);
+    for (int i = 0; i < res && !m_stopping; ++i) {
+        if (events[i].data.ptr == &m_wake_event) {
+            int64_t value;
+            ssize_t res0 = epoll_shim_read(m_wake_event, &value, sizeof(value));
+
+            (void) res0;
+            continue;
+        }
+
+        std::lock_guard<std::recursive_mutex> lock(m_workers_mutex);
+
+        auto *worker = static_cast<linux_async_worker_thread *>(events[i].data.ptr);
+        if (is_attached(worker))
+            worker->handle_ready_events();
+    }
+}
+
+void linux_event_loop::run() {
+    while (!m_stopping) {
+        int timeout = handle_timeouts();
+
+        handle_events(timeout);
+    }
+}
+
+linux_event_loop_group::linux_event_loop_group(std::size_t threads) {
+    threads = std::max(threads, std::size_t(1));
+
+    m_loops.reserve(threads);
+    try {
+        for (std::size_t i = 0; i < threads; ++i)
+            m_loops.push_back(linux_event_loop::start());
+    } catch (...) {
+        for (auto &loop : m_loops)
+            loop->stop();
+
+        throw;
+    }
+}
+
+linux_event_loop_group::~linux_event_loop_group() {
+    for (auto &loop : m_loops)
+        loop->stop();
+}
+
+std::shared_ptr<linux_event_loop> linux_event_loop_group::next() {
+    return m_loops[m_next.fetch_add(1) % m_loops.size()];
+}
+
+linux_external_event_loop::linux_external_event_loop()
+    : m_loop(linux_event_loop::create()) {
+}
+
+linux_external_event_loop::~linux_external_event_loop() {
+    m_loop->stop();
+}
+
+} // namespace ignite::network::detail
@@ -0,0 +1,108 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace ignite::network::detail {
+
+/**
+ * Lock-free multiple producer single consumer queue.
+ *
+ * Producers push values onto an intrusive stack. The consumer takes the whole stack at once and processes it in the
+ * push order. Taking everything at once avoids the ABA problem without any tagging.
+ *
+ * @tparam T Value type.
+ */
+template<typename T>
+class mpsc_queue {
+public:
+    // Default
+    mpsc_queue() = default;
+
+    // Deleted
+    mpsc_queue(const mpsc_queue &) = delete;
+    mpsc_queue &operator=(const mpsc_queue &) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~mpsc_queue() {
+        consume_all([](T &&) {});
+    }
+
+    /**
+     * Push value. Can be called from any thread.
+     *
+     * @param value Value.
+     * @return @c true if the queue was empty, i.e. the consumer should be notified.
+     */
+    bool push(T value) {
+        auto *n = new node{std::move(value), m_head.load(std::memory_order_relaxed)};
+        while (!m_head.compare_exchange_weak(n->next, n, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+
+        return n->next == nullptr;
+    }
+
+    /**
+     * Take all values and pass them to the function in the push order. Should only be called by the consumer.
+     *
+     * @param func Function that accepts T&&.
+     * @return @c true if there was at least one value.
+     */
+    template<typename F>
+    bool consume_all(F &&func) {
+        node *head = m_head.exchange(nullptr, std::memory_order_acquire);
+        if (!head)
+            return false;
+
+        node *reversed = nullptr;
+        while (head) {
+            node *next = head->next;
+            head->next = reversed;
+            reversed = head;
+            head = next;
+        }
+
+        while (reversed) {
+            std::unique_ptr<node> current{reversed};
+            reversed = current->next;
+            func(std::move(current->value));
+        }
+
+        return true;
+    }
+
+private:
+    /** Queue node. */
+    struct node {
+        /** Value. */
+        T value;
+
+        /** Next node. */
+        node *next;
+    };
+
+    /** Last pushed node. */
+    std::atomic<node *> m_head{nullptr};
+};
+
+} // namespace ignite::network::detail
@@ -0,0 +1,261 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+
+namespace ignite::network::detail {
+
+/**
+ * Limits the number of bytes queued for sending on the connections of a pool.
+ *
+ * A queue becomes saturated once it reaches the high watermark, and stops accepting data until it drains to the low
+ * watermark. The total size of the queues of all the connections is limited the same way. Queued bytes are counted
+ * without locking. Saturation state only changes under the lock, so a queue can not stay saturated after it is
+ * drained.
+ *
+ * Saturation of a queue is reported to the caller of acquire() and release(). Saturation of the total size is not a
+ * state of the connection that happens to cross the watermark, so it is reported to the total saturation listener
+ * instead.
+ */
+class send_queue_limiter {
+public:
+    /**
+     * Send queue of a connection.
+     */
+    class queue {
+        friend class send_queue_limiter;
+
+        /** Queued bytes. */
+        std::atomic<std::size_t> m_bytes{0};
+
+        /** Saturation flag. */
+        std::atomic_bool m_saturated{false};
+    };
+
+    /**
+     * Result of acquiring space in the queue.
+     */
+    enum class acquire_result {
+        /** Data is accepted. */
+        ACCEPTED,
+
+        /** Data is accepted, and the queue of the connection has become saturated. */
+        SATURATED,
+
+        /** Data is rejected, as the queue or the total size is saturated. */
+        REJECTED,
+    };
+
+    // Default
+    send_queue_limiter() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param limit High watermark of a connection queue. Zero means no limit.
+     * @param low_watermark Low watermark of a connection queue. Zero means half of the limit.
+     * @param total_limit High watermark of the total size of all the queues. Zero means no limit.
+     */
+    send_queue_limiter(std::size_t limit, std::size_t low_watermark, std::size_t total_limit)
+        : m_limit(limit)
+        , m_low_watermark(low_watermark ? std::min(low_watermark, limit) : limit / 2)
+        , m_total_limit(total_limit)
+        , m_total_low_watermark(total_limit / 2) {}
+
+    // Deleted
+    send_queue_limiter(const send_queue_limiter &) = delete;
+    send_queue_limiter &operator=(const send_queue_limiter &) = delete;
+
+    /**
+     * Check whether any limit is set.
+     *
+     * @return @c true if the limiter is enabled.
+     */
+    [[nodiscard]] bool is_enabled() const { return m_limit || m_total_limit; }
+
+    /**
+     * Set listener of the total size saturation. Called with @c true when the total size reaches the high watermark,
+     * and with @c false when it drains to the low watermark again. Calls are serialized, and never report the same
+     * state twice in a row.
+     *
+     * @param listener Listener. Can be empty.
+     */
+    void set_total_saturation_listener(std::function<void(bool)> listener) {
+        std::lock_guard<std::recursive_mutex> lock(m_listener_mutex);
+        m_total_listener = std::move(listener);
+    }
+
+    /**
+     * Account data queued for sending.
+     *
+     * @param q Queue.
+     * @param bytes Data size.
+     * @return Result. Rejected data should not be queued. Saturation of the total size is reported to the listener.
+     */
+    acquire_result acquire(queue &q, std::size_t bytes) {
+        if (!is_enabled())
+            return acquire_result::ACCEPTED;
+
+        if (q.m_saturated.load() || m_total_saturated.load())
+            return acquire_result::REJECTED;
+
+        auto queued = q.m_bytes.fetch_add(bytes) + bytes;
+        auto total = m_total_bytes.fetch_add(bytes) + bytes;
+
+        bool over_limit = m_limit && queued >= m_limit;
+        bool over_total_limit = m_total_limit && total >= m_total_limit;
+        if (!over_limit && !over_total_limit)
+            return acquire_result::ACCEPTED;
+
+        // The queues could have drained since, so the decision is made on the current values.
+        bool saturated = false;
+        bool total_saturated = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (m_limit && !q.m_saturated.load() && q.m_bytes.load() >= m_limit) {
+                q.m_saturated.store(true);
+                saturated = true;
+            }
+
+            if (m_total_limit && !m_total_saturated.load() && m_total_bytes.load() >= m_total_limit) {
+                m_total_saturated.store(true);
+                total_saturated = true;
+            }
+        }
+
+        if (total_saturated)
+            notify_total_saturation();
+
+        return saturated ? acquire_result::SATURATED : acquire_result::ACCEPTED;
+    }
+
+    /**
+     * Account data written to the socket or dropped.
+     *
+     * @param q Queue.
+     * @param bytes Data size.
+     * @return @c true if the queue has drained to the low watermark, so the data is accepted again. Drain of the total
+     *   size is reported to the listener.
+     */
+    bool release(queue &q, std::size_t bytes) {
+        if (!is_enabled() || !bytes)
+            return false;
+
+        q.m_bytes.fetch_sub(bytes);
+        m_total_bytes.fetch_sub(bytes);
+
+        bool drained = false;
+        bool total_drained = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (q.m_saturated.load() && q.m_bytes.load() <= m_low_watermark) {
+                q.m_saturated.store(false);
+                drained = true;
+            }
+
+            if (m_total_saturated.load() && m_total_bytes.load() <= m_total_low_watermark) {
+                m_total_saturated.store(false);
+                total_drained = true;
+            }
+        }
+
+        if (total_drained)
+            notify_total_saturation();
+
+        return drained;
+    }
+
+    /**
+     * Account all data of the queue as dropped. Used when the connection is closed.
+     *
+     * @param q Queue.
+     * @return @c true if the queue has drained to the low watermark.
+     */
+    bool release_all(queue &q) { return release(q, q.m_bytes.load()); }
+
+    /**
+     * Get total number of queued bytes.
+     *
+     * @return Queued bytes.
+     */
+    [[nodiscard]] std::size_t get_total_bytes() const { return m_total_bytes.load(); }
+
+    /**
+     * Check whether the total size is saturated.
+     *
+     * @return @c true if saturated.
+     */
+    [[nodiscard]] bool is_total_saturated() const { return m_total_saturated.load(); }
+
+private:
+    /**
+     * Report the current total saturation state to the listener unless it is already reported. The state is read
+     * under the listener lock, so concurrent changes are never reported out of order. The lock is recursive, as the
+     * listener may send data itself.
+     */
+    void notify_total_saturation() {
+        std::lock_guard<std::recursive_mutex> lock(m_listener_mutex);
+
+        bool saturated = m_total_saturated.load();
+        if (saturated == m_total_reported)
+            return;
+
+        m_total_reported = saturated;
+        if (m_total_listener)
+            m_total_listener(saturated);
+    }
+
+    /** High watermark of a connection queue. */
+    const std::size_t m_limit{0};
+
+    /** Low watermark of a connection queue. */
+    const std::size_t m_low_watermark{0};
+
+    /** High watermark of the total size. */
+    const std::size_t m_total_limit{0};
+
+    /** Low watermark of the total size. */
+    const std::size_t m_total_low_watermark{0};
+
+    /** Total number of queued bytes. */
+    std::atomic<std::size_t> m_total_bytes{0};
+
+    /** Total saturation flag. */
+    std::atomic_bool m_total_saturated{false};
+
+    /** Mutex. Guards saturation state changes. */
+    std::mutex m_mutex;
+
+    /** Total saturation listener. */
+    std::function<void(bool)> m_total_listener;
+
+    /** Last total saturation state reported to the listener. */
+    bool m_total_reported{false};
+
+    /** Listener mutex. Serializes total saturation reports. */
+    std::recursive_mutex m_listener_mutex;
+};
+
+} // namespace ignite::network::detail
@@ -0,0 +1,164 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "send_queue_limiter.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace ignite::network::detail;
+
+using acquire_result = send_queue_limiter::acquire_result;
+
+TEST(send_queue_limiter, disabled) {
+    send_queue_limiter limiter;
+    send_queue_limiter::queue q;
+
+    EXPECT_FALSE(limiter.is_enabled());
+    EXPECT_EQ(acquire_result::ACCEPTED, limiter.acquire(q, 1000000));
+    EXPECT_FALSE(limiter.release(q, 1000000));
+}
+
+TEST(send_queue_limiter, connection_watermarks) {
+    send_queue_limiter limiter(100, 30, 0);
+    send_queue_limiter::queue q1;
+    send_queue_limiter::queue q2;
+
+    EXPECT_EQ(acquire_result::ACCEPTED, limiter.acquire(q1, 60));
+    EXPECT_EQ(acquire_result::SATURATED, limiter.acquire(q1, 60));
+    EXPECT_EQ(acquire_result::REJECTED, limiter.acquire(q1, 1));
+
+    // Other connections are not affected.
+    EXPECT_EQ(acquire_result::ACCEPTED, limiter.acquire(q2, 60));
+
+    // Still above the low watermark.
+    EXPECT_FALSE(limiter.release(q1, 80));
+    EXPECT_EQ(acquire_result::REJECTED, limiter.acquire(q1, 1));
+
+    EXPECT_TRUE(limiter.release(q1, 10));
+    EXPECT_EQ(acquire_result::ACCEPTED, limiter.acquire(q1, 1));
+}
+
+TEST(send_queue_limiter, default_low_watermark) {
+    send_queue_limiter limiter(100, 0, 0);
+    send_queue_limiter::queue q;
+
+    EXPECT_EQ(acquire_result::SATURATED, limiter.acquire(q, 100));
+    EXPECT_FALSE(limiter.release(q, 49));
+    EXPECT_TRUE(limiter.release(q, 1));
+}
+
+TEST(send_queue_limiter, total_watermarks) {
+    send_queue_limiter limiter(0, 0, 100);
+    send_queue_limiter::queue q1;
+    send_queue_limiter::queue q2;
+
+    std::vector<bool> reported;
+    limiter.set_total_saturation_listener([&reported](bool saturated) { reported.push_back(saturated); });
+
+    // The total size is not a state of the connection that crosses the watermark.
+    EXPECT_EQ(acquire_result::ACCEPTED, limiter.acquire(q1, 60));
+    EXPECT_EQ(acquire_result::ACCEPTED, limiter.acquire(q2, 60));
+    EXPECT_EQ(std::vector<bool>{true}, reported);
+    EXPECT_TRUE(limiter.is_total_saturated());
+
+    EXPECT_EQ(acquire_result::REJECTED, limiter.acquire(q1, 1));
+    EXPECT_EQ(acquire_result::REJECTED, limiter.acquire(q2, 1));
+    EXPECT_EQ(120, limiter.get_total_bytes());
+
+    // Data of a closed connection is dropped.
+    EXPECT_FALSE(limiter.release_all(q1));
+    EXPECT_EQ(60, limiter.get_total_bytes());
+    EXPECT_EQ(acquire_result::REJECTED, limiter.acquire(q2, 1));
+
+    // Drains on the other connection than the one that saturated it.
+    EXPECT_FALSE(limiter.release(q2, 10));
+    EXPECT_EQ((std::vector<bool>{true, false}), reported);
+    EXPECT_EQ(acquire_result::ACCEPTED, limiter.acquire(q1, 1));
+    EXPECT_EQ(acquire_result::ACCEPTED, limiter.acquire(q2, 1));
+}
+
+TEST(send_queue_limiter, connection_and_total_watermarks) {
+    send_queue_limiter limiter(100, 0, 150);
+    send_queue_limiter::queue q1;
+    send_queue_limiter::queue q2;
+
+    std::vector<bool> reported;
+    limiter.set_total_saturation_listener([&reported](bool saturated) { reported.push_back(saturated); });
+
+    EXPECT_EQ(acquire_result::SATURATED, limiter.acquire(q1, 100));
+    EXPECT_TRUE(reported.empty());
+
+    EXPECT_EQ(acquire_result::ACCEPTED, limiter.acquire(q2, 50));
+    EXPECT_EQ(std::vector<bool>{true}, reported);
+
+    // The connection drains, while the total size is still above its low watermark.
+    EXPECT_TRUE(limiter.release(q1, 50));
+    EXPECT_EQ(std::vector<bool>{true}, reported);
+    EXPECT_EQ(acquire_result::REJECTED, limiter.acquire(q1, 1));
+
+    EXPECT_FALSE(limiter.release(q2, 50));
+    EXPECT_EQ((std::vector<bool>{true, false}), reported);
+    EXPECT_EQ(acquire_result::ACCEPTED, limiter.acquire(q1, 1));
+}
+
+TEST(send_queue_limiter, total_listener_sends) {
+    send_queue_limiter limiter(0, 0, 100);
+    send_queue_limiter::queue q;
+
+    // The listener may send data itself, e.g. the requests that waited for the drain.
+    std::vector<bool> reported;
+    limiter.set_total_saturation_listener([&](bool saturated) {
+        reported.push_back(saturated);
+        if (!saturated)
+            limiter.acquire(q, 100);
+    });
+
+    limiter.acquire(q, 100);
+    limiter.release(q, 100);
+
+    EXPECT_EQ((std::vector<bool>{true, false, true}), reported);
+}
+
+TEST(send_queue_limiter, never_stays_saturated_when_drained) {
+    send_queue_limiter limiter(64, 0, 0);
+    send_queue_limiter::queue q;
+
+    for (int i = 0; i < 100; ++i) {
+        std::thread producer([&] {
+            for (int j = 0; j < 1000; ++j) {
+                if (limiter.acquire(q, 8) != acquire_result::REJECTED)
+                    limiter.release(q, 8);
+            }
+        });
+
+        std::thread consumer([&] {
+            for (int j = 0; j < 1000; ++j) {
+                if (limiter.acquire(q, 8) != acquire_result::REJECTED)
+                    limiter.release(q, 8);
+            }
+        });
+
+        producer.join();
+        consumer.join();
+
+        EXPECT_EQ(acquire_result::ACCEPTED, limiter.acquire(q, 1));
+        limiter.release(q, 1);
+    }
+}
@@ -70,6 +70,19 @@ void win_async_client_pool::stop() {
     internal_stop();
 }
 
+void win_async_client_pool::update_addresses(std::vector<tcp_range> addrs) {
+    if (m_stopping)
+        return;
+
+    m_connecting_thread.update_addresses(std::move(addrs));
+
+    std::lock_guard<std::mutex> lock(m_clients_mutex);
+    for (auto &[_, client] : m_client_id_map) {
+        if (!m_connecting_thread.is_known_address(client->get_range()))
+            client->shutdown(ignite_error(status_code::NETWORK, "Node is removed from the address list"));
+    }
+}
+
 void win_async_client_pool::internal_stop() {
     if (m_stopping)
         return;
@@ -65,6 +65,13 @@ public:
      */
     void stop() override;
 
+    /**
+     * Replace the addresses to connect to.
+     *
+     * @param addrs Addresses to connect to.
+     */
+    void update_addresses(std::vector<tcp_range> addrs) override;
+
     /**
      * Set handler.
      *
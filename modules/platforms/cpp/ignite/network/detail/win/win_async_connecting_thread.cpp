@@ -43,8 +43,10 @@ win_async_connecting_thread::win_async_connecting_thread()
     , m_stopping(false)
     , m_failed_attempts(0)
     , m_min_addrs(0)
+    , m_limit(0)
     , m_addrs_mutex()
     , m_connect_needed()
+    , m_addrs()
     , m_non_connected()
     , m_addr_position_seed(std::random_device()()) {
 }
@@ -79,21 +81,29 @@ void win_async_connecting_thread::run() {
         }
 
         try {
-            bool added = m_client_pool->add_client(client);
-
-            if (!added) {
-                client->close();
-
-                continue;
-            }
-
             {
                 std::lock_guard<std::mutex> lock(m_addrs_mutex);
 
+                // The range could be removed while connecting.
+                if (std::find(m_addrs.begin(), m_addrs.end(), range) == m_addrs.end()) {
+                    client->close();
+
+                    continue;
+                }
+
                 auto it = std::find(m_non_connected.begin(), m_non_connected.end(), range);
                 if (it != m_non_connected.end())
                     m_non_connected.erase(it);
             }
+
+            bool added = m_client_pool->add_client(client);
+
+            if (!added) {
+                notify_free_address(range);
+                client->close();
+
+                continue;
+            }
         } catch (const ignite_error &err) {
             client->close();
 
@@ -107,15 +117,52 @@ void win_async_connecting_thread::run() {
 void win_async_connecting_thread::notify_free_address(const tcp_range &range) {
     std::lock_guard<std::mutex> lock(m_addrs_mutex);
 
+    if (std::find(m_addrs.begin(), m_addrs.end(), range) == m_addrs.end())
+        return;
+
     m_non_connected.push_back(range);
     m_connect_needed.notify_one();
 }
 
+void win_async_connecting_thread::update_addresses(std::vector<tcp_range> addrs) {
+    std::lock_guard<std::mutex> lock(m_addrs_mutex);
+
+    auto contains = [](const std::vector<tcp_range> &ranges, const tcp_range &range) {
+        return std::find(ranges.begin(), ranges.end(), range) != ranges.end();
+    };
+
+    for (const auto &range : addrs) {
+        if (!contains(m_addrs, range))
+            m_non_connected.push_back(range);
+    }
+
+    m_non_connected.erase(std::remove_if(m_non_connected.begin(), m_non_connected.end(),
+                              [&](const tcp_range &range) { return !contains(addrs, range); }),
+        m_non_connected.end());
+
+    m_addrs = std::move(addrs);
+
+    if (!m_limit || m_limit > m_addrs.size())
+        m_min_addrs = 0;
+    else
+        m_min_addrs = m_addrs.size() - m_limit;
+
+    m_connect_needed.notify_one();
+}
+
+bool win_async_connecting_thread::is_known_address(const tcp_range &range) const {
+    std::lock_guard<std::mutex> lock(m_addrs_mutex);
+
+    return std::find(m_addrs.begin(), m_addrs.end(), range) != m_addrs.end();
+}
+
 void win_async_connecting_thread::start(win_async_client_pool &clientPool, size_t limit, std::vector<tcp_range> addrs) {
     m_stopping = false;
     m_client_pool = &clientPool;
     m_failed_attempts = 0;
+    m_addrs = addrs;
     m_non_connected = std::move(addrs);
+    m_limit = limit;
 
     if (!limit || limit > m_non_connected.size())
         m_min_addrs = 0;
@@ -137,6 +184,7 @@ void win_async_connecting_thread::stop() {
     }
 
     m_thread.join();
+    m_addrs.clear();
     m_non_connected.clear();
 }
 
@@ -67,6 +67,21 @@ public:
      */
     void notify_free_address(const tcp_range &range);
 
+    /**
+     * Replace the addresses to connect to.
+     *
+     * @param addrs Addresses to connect to.
+     */
+    void update_addresses(std::vector<tcp_range> addrs);
+
+    /**
+     * Check whether the range is in the list of addresses to connect to.
+     *
+     * @param range Address range.
+     * @return @c true if the range is known.
+     */
+    [[nodiscard]] bool is_known_address(const tcp_range &range) const;
+
 private:
     /**
      * Run thread.
@@ -110,12 +125,18 @@ private:
     /** Minimal number of addresses. */
     size_t m_min_addrs;
 
+    /** Connection limit. */
+    size_t m_limit;
+
     /** Addresses critical section. */
     mutable std::mutex m_addrs_mutex;
 
     /** Condition variable, which signalled when new connect is needed. */
     mutable std::condition_variable m_connect_needed;
 
+    /** All addresses. */
+    std::vector<tcp_range> m_addrs;
+
     /** Addresses to use for connection establishment. */
     std::vector<tcp_range> m_non_connected;
 
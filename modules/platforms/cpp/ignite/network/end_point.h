@@ -19,9 +19,23 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 namespace ignite::network {
 
+/** Address prefix that denotes a Unix domain socket path instead of a TCP host. */
+static constexpr std::string_view UNIX_SOCKET_PREFIX{"unix:"};
+
+/**
+ * Check whether the host denotes a Unix domain socket.
+ *
+ * @param host Host.
+ * @return @c true if the host is a Unix domain socket path prefixed with UNIX_SOCKET_PREFIX.
+ */
+inline bool is_unix_socket_host(std::string_view host) {
+    return host.substr(0, UNIX_SOCKET_PREFIX.size()) == UNIX_SOCKET_PREFIX;
+}
+
 /**
  * Connection end point structure.
  */
@@ -44,7 +58,19 @@ struct end_point {
      *
      * @return String form.
      */
-    [[nodiscard]] std::string to_string() const { return host + ":" + std::to_string(port); }
+    [[nodiscard]] std::string to_string() const {
+        if (is_unix_socket())
+            return host;
+
+        return host + ":" + std::to_string(port);
+    }
+
+    /**
+     * Check whether the end point is a Unix domain socket.
+     *
+     * @return @c true if the end point is a Unix domain socket.
+     */
+    [[nodiscard]] bool is_unix_socket() const { return is_unix_socket_host(host); }
 
     /**
      * Compare to another instance.
@@ -63,10 +89,10 @@ struct end_point {
         return host.compare(other.host);
     }
 
-    /** Remote host. */
+    /** Remote host or Unix domain socket path prefixed with UNIX_SOCKET_PREFIX. */
     std::string host;
 
-    /** TCP port. */
+    /** TCP port. Always zero for Unix domain sockets. */
     uint16_t port = 0;
 };
 
@@ -0,0 +1,43 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace ignite::network {
+
+/**
+ * Group of event loop threads shared by many client pools.
+ *
+ * A pool configured with a group does not start its own I/O thread. Its connections are served by one of the group
+ * threads instead, so the number of I/O threads does not depend on the number of pools.
+ */
+class event_loop_group {
+public:
+    // Default
+    virtual ~event_loop_group() = default;
+
+    /**
+     * Get number of threads.
+     *
+     * @return Number of threads.
+     */
+    [[nodiscard]] virtual std::size_t size() const = 0;
+};
+
+} // namespace ignite::network
@@ -0,0 +1,67 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <ignite/network/event_loop_group.h>
+
+namespace ignite::network {
+
+/**
+ * Event loop driven by the application.
+ *
+ * No I/O thread is started. The application polls the descriptor returned by get_fd() for reading in its own loop,
+ * calls handle_events() when the descriptor is readable, and calls handle_timeouts() once the time returned by
+ * get_timeout() passes. All the pool callbacks are invoked from these calls.
+ *
+ * The functions should be called from a single thread.
+ */
+class external_event_loop : public event_loop_group {
+public:
+    /**
+     * Get number of threads.
+     *
+     * @return Zero, as the loop does not start threads.
+     */
+    [[nodiscard]] std::size_t size() const override { return 0; }
+
+    /**
+     * Get the descriptor to poll for reading.
+     *
+     * @return File descriptor.
+     */
+    [[nodiscard]] virtual int get_fd() const = 0;
+
+    /**
+     * Get time until handle_timeouts() should be called.
+     *
+     * @return Timeout in milliseconds. Negative value means there is nothing to wait.
+     */
+    [[nodiscard]] virtual int get_timeout() = 0;
+
+    /**
+     * Process ready events. Never blocks.
+     */
+    virtual void handle_events() = 0;
+
+    /**
+     * Initiate connections which are due.
+     */
+    virtual void handle_timeouts() = 0;
+};
+
+} // namespace ignite::network
@@ -20,6 +20,8 @@
 #include <ignite/common/bytes.h>
 #include <ignite/protocol/utils.h>
 
+#include <string>
+
 namespace ignite::network {
 
 length_prefix_codec::length_prefix_codec()
@@ -37,6 +39,18 @@ data_buffer_owning length_prefix_codec::encode(data_buffer_owning &data) {
 void length_prefix_codec::reset_buffer() {
     m_packet_size = -1;
     m_packet.clear();
+
+    // Do not hold the memory of a large packet until the next one.
+    if (m_packet.capacity() > RETAINED_BUFFER_SIZE)
+        m_packet.shrink_to_fit();
+}
+
+int32_t length_prefix_codec::read_packet_size(const std::byte *header) {
+    auto size = bytes::load<endian::BIG, int32_t>(header);
+    if (size < 0)
+        throw ignite_error("Invalid packet size: " + std::to_string(size));
+
+    return size;
 }
 
 data_buffer_ref length_prefix_codec::decode(data_buffer_ref &data) {
@@ -53,16 +67,31 @@ data_buffer_ref length_prefix_codec::decode(data_buffer_ref &data) {
         m_magic_received = true;
     }
 
-    if (m_packet.empty() || m_packet.size() == (PACKET_HEADER_SIZE + m_packet_size))
+    // The size is not known yet while the header is received in parts.
+    if (m_packet.empty() || (m_packet_size >= 0 && m_packet.size() == PACKET_HEADER_SIZE + size_t(m_packet_size)))
         reset_buffer();
 
     if (m_packet_size < 0) {
+        auto view = data.get_bytes_view();
+        if (m_packet.empty() && view.size() >= PACKET_HEADER_SIZE) {
+            auto packet_size = size_t(read_packet_size(view.data()));
+            if (view.size() >= PACKET_HEADER_SIZE + packet_size) {
+                // The whole packet is received. The data is valid until the next decode() call.
+                data.skip(PACKET_HEADER_SIZE + packet_size);
+
+                return {view, PACKET_HEADER_SIZE, packet_size};
+            }
+        }
+
         consume(data, PACKET_HEADER_SIZE);
 
         if (m_packet.size() < PACKET_HEADER_SIZE)
             return {};
 
-        m_packet_size = bytes::load<endian::BIG, int32_t>(m_packet.data());
+        m_packet_size = read_packet_size(m_packet.data());
+
+        // Avoid reallocations while a large packet is received.
+        m_packet.reserve(PACKET_HEADER_SIZE + size_t(m_packet_size));
     }
 
     consume(data, m_packet_size + PACKET_HEADER_SIZE);
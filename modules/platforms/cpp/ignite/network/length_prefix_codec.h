@@ -27,12 +27,18 @@ namespace ignite::network {
 
 /**
  * Codec that decodes messages prefixed with int32 length.
+ *
+ * Packets that are received entirely are passed on without copying. Other packets are accumulated in a buffer that
+ * is allocated once for the whole packet, using the size from the header.
  */
-class length_prefix_codec : public codec {
+class length_prefix_codec final : public codec {
 public:
     /** Packet header size in bytes. */
     static constexpr size_t PACKET_HEADER_SIZE = 4;
 
+    /** Capacity of the packet buffer that is kept after a packet is decoded. Larger buffers are released. */
+    static constexpr size_t RETAINED_BUFFER_SIZE = 0x100000;
+
     /**
      * Constructor.
      */
@@ -72,6 +78,16 @@ private:
      */
     void reset_buffer();
 
+    /**
+     * Read packet size from the header.
+     *
+     * @param header Packet header.
+     * @return Packet size.
+     *
+     * @throw ignite_error if the size is invalid.
+     */
+    static int32_t read_packet_size(const std::byte *header);
+
     /** Size of the current packet. */
     int32_t m_packet_size;
 
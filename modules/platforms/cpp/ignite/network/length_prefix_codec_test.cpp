@@ -0,0 +1,133 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "length_prefix_codec.h"
+
+#include <ignite/common/bytes.h>
+#include <ignite/protocol/utils.h>
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <vector>
+
+using namespace ignite;
+using namespace ignite::network;
+
+namespace {
+
+/**
+ * Make packet with the length header.
+ *
+ * @param size Payload size.
+ * @param seed First payload byte value.
+ * @return Packet.
+ */
+std::vector<std::byte> make_packet(std::size_t size, int seed) {
+    std::vector<std::byte> res(length_prefix_codec::PACKET_HEADER_SIZE + size);
+    bytes::store<endian::BIG, int32_t>(res.data(), int32_t(size));
+    for (std::size_t i = 0; i < size; ++i)
+        res[length_prefix_codec::PACKET_HEADER_SIZE + i] = std::byte(seed + i);
+
+    return res;
+}
+
+/**
+ * Decode the data received in chunks of the specified size.
+ *
+ * @param codec Codec.
+ * @param data Data.
+ * @param chunk Chunk size.
+ * @return Decoded packets.
+ */
+std::vector<std::vector<std::byte>> decode_all(length_prefix_codec &codec, bytes_view data, std::size_t chunk) {
+    std::vector<std::vector<std::byte>> res;
+    for (std::size_t pos = 0; pos < data.size(); pos += chunk) {
+        data_buffer_ref in(data.substr(pos, chunk));
+        while (true) {
+            auto out = codec.decode(in);
+            if (out.empty())
+                break;
+
+            auto view = out.get_bytes_view();
+            res.emplace_back(view.begin(), view.end());
+        }
+    }
+
+    return res;
+}
+
+/**
+ * Make data stream with the magic bytes and the packets.
+ *
+ * @param sizes Payload sizes.
+ * @return Data.
+ */
+std::vector<std::byte> make_stream(const std::vector<std::size_t> &sizes) {
+    std::vector<std::byte> res(protocol::MAGIC_BYTES.begin(), protocol::MAGIC_BYTES.end());
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        auto packet = make_packet(sizes[i], int(i));
+        res.insert(res.end(), packet.begin(), packet.end());
+    }
+
+    return res;
+}
+
+} // namespace
+
+TEST(length_prefix_codec, decode_in_any_chunks) {
+    std::vector<std::size_t> sizes{1, 100, 3, 70000, 5, 1};
+    auto stream = make_stream(sizes);
+
+    for (std::size_t chunk : {std::size_t(1), std::size_t(3), std::size_t(7), std::size_t(4096), stream.size()}) {
+        length_prefix_codec codec;
+        auto packets = decode_all(codec, stream, chunk);
+
+        ASSERT_EQ(sizes.size(), packets.size()) << "chunk=" << chunk;
+        for (std::size_t i = 0; i < sizes.size(); ++i) {
+            auto expected = make_packet(sizes[i], int(i));
+            expected.erase(expected.begin(), expected.begin() + length_prefix_codec::PACKET_HEADER_SIZE);
+            EXPECT_EQ(expected, packets[i]) << "chunk=" << chunk << ", packet=" << i;
+        }
+    }
+}
+
+TEST(length_prefix_codec, whole_packets_are_not_copied) {
+    auto stream = make_stream({10, 20});
+
+    length_prefix_codec codec;
+    data_buffer_ref in(bytes_view{stream});
+
+    auto first = codec.decode(in);
+    auto second = codec.decode(in);
+
+    auto first_pos = protocol::MAGIC_BYTES.size() + length_prefix_codec::PACKET_HEADER_SIZE;
+    EXPECT_EQ(stream.data() + first_pos, first.get_bytes_view().data());
+    EXPECT_EQ(stream.data() + first_pos + 10 + length_prefix_codec::PACKET_HEADER_SIZE, second.get_bytes_view().data());
+    EXPECT_TRUE(in.empty());
+}
+
+TEST(length_prefix_codec, negative_size_is_rejected) {
+    auto stream = make_stream({});
+    stream.resize(stream.size() + length_prefix_codec::PACKET_HEADER_SIZE);
+    bytes::store<endian::BIG, int32_t>(stream.data() + protocol::MAGIC_BYTES.size(), -1);
+
+    length_prefix_codec codec;
+    data_buffer_ref in(bytes_view{stream});
+
+    EXPECT_THROW((void) codec.decode(in), ignite_error);
+}
@@ -18,22 +18,74 @@
 #include "network.h"
 
 #include "async_client_pool_adapter.h"
-
-#include <ignite/common/config.h>
+#include "length_prefix_codec.h"
+#include "static_codec_filter.h"
+#include "static_error_handling_filter.h"
+#include "static_filter_pipeline.h"
 
 #ifdef _WIN32
 # include "detail/win/win_async_client_pool.h"
 #else
 # include "detail/linux/linux_async_client_pool.h"
+# include "detail/linux/linux_event_loop.h"
+#endif
+
+#ifdef __linux__
+# include "detail/linux/shm_async_client_pool.h"
 #endif
 
 namespace ignite::network {
 
-std::shared_ptr<async_client_pool> make_async_client_pool(data_filters filters) {
-    auto pool =
-        std::make_shared<IGNITE_SWITCH_WIN_OTHER(detail::win_async_client_pool, detail::linux_async_client_pool)>();
+namespace {
+
+/** Standard filters. */
+typedef static_filter_pipeline<static_error_handling_filter, static_codec_filter<length_prefix_codec>>
+    default_filter_pipeline;
+
+/**
+ * Make platform-specific asynchronous client pool.
+ *
+ * @param cfg Transport configuration.
+ * @return Async client pool.
+ */
+std::shared_ptr<async_client_pool> make_platform_pool(const transport_configuration &cfg) {
+#ifdef __linux__
+    if (cfg.shared_memory_enabled)
+        return std::make_shared<detail::shm_async_client_pool>(cfg);
+#endif
+
+#ifdef _WIN32
+    return std::make_shared<detail::win_async_client_pool>();
+#else
+    return std::make_shared<detail::linux_async_client_pool>(cfg);
+#endif
+}
+
+} // namespace
+
+std::shared_ptr<async_client_pool> make_async_client_pool(data_filters filters, const transport_configuration &cfg) {
+    return std::make_shared<async_client_pool_adapter>(std::move(filters), make_platform_pool(cfg));
+}
 
-    return std::make_shared<async_client_pool_adapter>(std::move(filters), std::move(pool));
+std::shared_ptr<async_client_pool> make_default_async_client_pool(const transport_configuration &cfg) {
+    return std::make_shared<default_filter_pipeline>(make_platform_pool(cfg));
+}
+
+std::shared_ptr<event_loop_group> make_event_loop_group(std::size_t threads) {
+#ifdef _WIN32
+    (void) threads;
+    return {};
+#else
+    return std::make_shared<detail::linux_event_loop_group>(threads);
+#endif
+}
+
+std::shared_ptr<external_event_loop> make_external_event_loop() {
+#ifdef _WIN32
+    return {};
+#else
+    return std::make_shared<detail::linux_external_event_loop>();
+#endif
 }
 
 } // namespace ignite::network
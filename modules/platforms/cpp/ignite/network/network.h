@@ -19,6 +19,9 @@
 
 #include <ignite/network/async_client_pool.h>
 #include <ignite/network/data_filter.h>
+#include <ignite/network/event_loop_group.h>
+#include <ignite/network/external_event_loop.h>
+#include <ignite/network/transport_configuration.h>
 
 #include <string>
 
@@ -28,8 +31,33 @@ namespace ignite::network {
  * Make asynchronous client pool.
  *
  * @param filters Filters.
+ * @param cfg Transport configuration.
  * @return Async client pool.
  */
-std::shared_ptr<async_client_pool> make_async_client_pool(data_filters filters);
+std::shared_ptr<async_client_pool> make_async_client_pool(data_filters filters, const transport_configuration &cfg = {});
+
+/**
+ * Make asynchronous client pool with the standard filters: error handling and length prefix codec. The filters are
+ * composed at compile time. Use make_async_client_pool() to add custom filters.
+ *
+ * @param cfg Transport configuration.
+ * @return Async client pool.
+ */
+std::shared_ptr<async_client_pool> make_default_async_client_pool(const transport_configuration &cfg = {});
+
+/**
+ * Make group of event loops to share between client pools.
+ *
+ * @param threads Number of threads.
+ * @return Event loop group. Null pointer if the platform does not support shared event loops.
+ */
+std::shared_ptr<event_loop_group> make_event_loop_group(std::size_t threads);
+
+/**
+ * Make event loop driven by the application. Pools configured with the loop do not start any threads.
+ *
+ * @return Event loop. Null pointer if the platform does not support external event loops.
+ */
+std::shared_ptr<external_event_loop> make_external_event_loop();
 
 } // namespace ignite::network
@@ -0,0 +1,124 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <ignite/network/data_buffer.h>
+#include <ignite/network/detail/connection_table.h>
+#include <ignite/network/static_filter_pipeline.h>
+
+#include <memory>
+
+namespace ignite::network {
+
+/**
+ * Static counterpart of codec_data_filter. The codec type is known at compile time, so the codec calls are not
+ * virtual as long as the codec class is final.
+ *
+ * @tparam Codec Codec type. Must be default constructible.
+ */
+template<typename Codec>
+class static_codec_filter : public static_filter {
+public:
+    /**
+     * Send data to specific established connection.
+     *
+     * @param layer Filter layer.
+     * @param id Client ID.
+     * @param data Data to be sent.
+     * @return @c true if connection is present and @c false otherwise.
+     *
+     * @throw IgniteError on error.
+     */
+    template<typename Layer>
+    bool send(Layer &layer, uint64_t id, std::vector<std::byte> &&data) {
+        std::shared_ptr<Codec> codec = m_codecs.find(id);
+        if (!codec)
+            return false;
+
+        data_buffer_owning data0(std::move(data));
+        while (true) {
+            auto out = codec->encode(data0);
+            if (out.empty())
+                break;
+
+            bool res = layer.send(id, std::move(out).extract_data());
+            if (!res)
+                return res;
+        }
+
+        return true;
+    }
+
+    /**
+     * Callback that called on successful connection establishment.
+     *
+     * @param layer Filter layer.
+     * @param addr Address of the new connection.
+     * @param id Connection ID.
+     */
+    template<typename Layer>
+    void on_connection_success(Layer &layer, const end_point &addr, uint64_t id) {
+        m_codecs.insert(id, std::make_shared<Codec>());
+
+        layer.on_connection_success(addr, id);
+    }
+
+    /**
+     * Callback that called on error during connection establishment.
+     *
+     * @param layer Filter layer.
+     * @param id Async client ID.
+     * @param err Error. Can be null if connection closed without error.
+     */
+    template<typename Layer>
+    void on_connection_closed(Layer &layer, uint64_t id, std::optional<ignite_error> err) {
+        m_codecs.erase(id);
+
+        layer.on_connection_closed(id, std::move(err));
+    }
+
+    /**
+     * Callback that called when new message is received.
+     *
+     * @param layer Filter layer.
+     * @param id Async client ID.
+     * @param msg Received message.
+     */
+    template<typename Layer>
+    void on_message_received(Layer &layer, uint64_t id, bytes_view msg) {
+        std::shared_ptr<Codec> codec = m_codecs.find(id);
+        if (!codec)
+            return;
+
+        data_buffer_ref msg0(msg);
+        while (true) {
+            data_buffer_ref out = codec->decode(msg0);
+
+            if (out.empty())
+                break;
+
+            layer.on_message_received(id, out.get_bytes_view());
+        }
+    }
+
+private:
+    /** Codecs. */
+    detail::connection_table<Codec> m_codecs;
+};
+
+} // namespace ignite::network
@@ -0,0 +1,126 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <ignite/network/static_filter_pipeline.h>
+
+#include <exception>
+#include <string>
+
+namespace ignite::network {
+
+/**
+ * Static counterpart of error_handling_filter: closes the connection if an exception escapes the upper layers while
+ * handling its event.
+ */
+class static_error_handling_filter : public static_filter {
+public:
+    /**
+     * Callback that called on successful connection establishment.
+     *
+     * @param layer Filter layer.
+     * @param addr Address of the new connection.
+     * @param id Connection ID.
+     */
+    template<typename Layer>
+    void on_connection_success(Layer &layer, const end_point &addr, uint64_t id) {
+        close_connection_on_exception(layer, id, [&] { layer.on_connection_success(addr, id); });
+    }
+
+    /**
+     * Callback that called on error during connection establishment.
+     *
+     * @param layer Filter layer.
+     * @param addr Connection address.
+     * @param err Error.
+     */
+    template<typename Layer>
+    void on_connection_error(Layer &layer, const end_point &addr, ignite_error err) {
+        try {
+            layer.on_connection_error(addr, std::move(err));
+        } catch (...) {
+            // No-op.
+        }
+    }
+
+    /**
+     * Callback that called on error during connection establishment.
+     *
+     * @param layer Filter layer.
+     * @param id Async client ID.
+     * @param err Error. Can be null if connection closed without error.
+     */
+    template<typename Layer>
+    void on_connection_closed(Layer &layer, uint64_t id, std::optional<ignite_error> err) {
+        try {
+            layer.on_connection_closed(id, std::move(err));
+        } catch (...) {
+            // No-op.
+        }
+    }
+
+    /**
+     * Callback that called when new message is received.
+     *
+     * @param layer Filter layer.
+     * @param id Async client ID.
+     * @param msg Received message.
+     */
+    template<typename Layer>
+    void on_message_received(Layer &layer, uint64_t id, bytes_view msg) {
+        close_connection_on_exception(layer, id, [&] { layer.on_message_received(id, msg); });
+    }
+
+    /**
+     * Callback that called when message is sent.
+     *
+     * @param layer Filter layer.
+     * @param id Async client ID.
+     */
+    template<typename Layer>
+    void on_message_sent(Layer &layer, uint64_t id) {
+        close_connection_on_exception(layer, id, [&] { layer.on_message_sent(id); });
+    }
+
+private:
+    /**
+     * Execute function and handle all possible exceptions.
+     *
+     * @param layer Filter layer.
+     * @param id Async client ID.
+     * @param func Function to handle.
+     */
+    template<typename Layer, typename F>
+    static void close_connection_on_exception(Layer &layer, uint64_t id, F &&func) {
+        try {
+            func();
+        } catch (const ignite_error &err) {
+            layer.close(id, err);
+        } catch (std::exception &err) {
+            std::string msg("Standard library exception is thrown: ");
+            msg += err.what();
+            ignite_error err0(status_code::GENERIC, msg);
+            layer.close(id, std::move(err0));
+        } catch (...) {
+            ignite_error err0(status_code::UNKNOWN, "Unknown error is encountered when processing network event");
+            layer.close(id, std::move(err0));
+        }
+    }
+};
+
+} // namespace ignite::network
@@ -0,0 +1,496 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <ignite/network/async_client_pool.h>
+#include <ignite/network/async_handler.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace ignite::network {
+
+/**
+ * Base class of the filters of the static filter pipeline.
+ *
+ * Static filters have the same semantics as data_filter, but are composed at compile time. Every method gets the
+ * layer of the filter, which passes the event further: sending goes to the layer below the filter, and the events go
+ * to the layer above it. The default implementation passes everything through. A derived filter hides the methods
+ * it needs to change.
+ */
+class static_filter {
+public:
+    /**
+     * Send data to specific established connection.
+     *
+     * @param layer Filter layer.
+     * @param id Client ID.
+     * @param data Data to be sent.
+     * @return @c true if connection is present and @c false otherwise.
+     */
+    template<typename Layer>
+    bool send(Layer &layer, uint64_t id, std::vector<std::byte> &&data) {
+        return layer.send(id, std::move(data));
+    }
+
+    /**
+     * Closes specified connection if it's established.
+     *
+     * @param layer Filter layer.
+     * @param id Client ID.
+     * @param err Optional error.
+     */
+    template<typename Layer>
+    void close(Layer &layer, uint64_t id, std::optional<ignite_error> err) {
+        layer.close(id, std::move(err));
+    }
+
+    /**
+     * Callback that called on successful connection establishment.
+     *
+     * @param layer Filter layer.
+     * @param addr Address of the new connection.
+     * @param id Connection ID.
+     */
+    template<typename Layer>
+    void on_connection_success(Layer &layer, const end_point &addr, uint64_t id) {
+        layer.on_connection_success(addr, id);
+    }
+
+    /**
+     * Callback that called on error during connection establishment.
+     *
+     * @param layer Filter layer.
+     * @param addr Connection address.
+     * @param err Error.
+     */
+    template<typename Layer>
+    void on_connection_error(Layer &layer, const end_point &addr, ignite_error err) {
+        layer.on_connection_error(addr, std::move(err));
+    }
+
+    /**
+     * Callback that called on error during connection establishment.
+     *
+     * @param layer Filter layer.
+     * @param id Async client ID.
+     * @param err Error. Can be null if connection closed without error.
+     */
+    template<typename Layer>
+    void on_connection_closed(Layer &layer, uint64_t id, std::optional<ignite_error> err) {
+        layer.on_connection_closed(id, std::move(err));
+    }
+
+    /**
+     * Callback that called when new message is received.
+     *
+     * @param layer Filter layer.
+     * @param id Async client ID.
+     * @param msg Received message.
+     */
+    template<typename Layer>
+    void on_message_received(Layer &layer, uint64_t id, bytes_view msg) {
+        layer.on_message_received(id, msg);
+    }
+
+    /**
+     * Callback that called when message is sent.
+     *
+     * @param layer Filter layer.
+     * @param id Async client ID.
+     */
+    template<typename Layer>
+    void on_message_sent(Layer &layer, uint64_t id) {
+        layer.on_message_sent(id);
+    }
+};
+
+/**
+ * Asynchronous client pool with the filters composed at compile time.
+ *
+ * The first filter is the closest to the underlying pool, the same as the first filter passed to the
+ * async_client_pool_adapter. Every event makes one virtual call into the pipeline and one into the user handler, and
+ * passes the filters through the inlined calls.
+ *
+ * @tparam Filters Filter types. Must be default constructible and derive from static_filter.
+ */
+template<typename... Filters>
+class static_filter_pipeline : public async_client_pool,
+                               public async_handler,
+                               public std::enable_shared_from_this<static_filter_pipeline<Filters...>> {
+public:
+    /** Number of filters. */
+    static constexpr std::size_t FILTERS = sizeof...(Filters);
+
+    /**
+     * Constructor.
+     *
+     * @param pool Client pool.
+     */
+    explicit static_filter_pipeline(std::shared_ptr<async_client_pool> pool)
+        : m_pool(std::move(pool)) {}
+
+    /**
+     * Start internal thread that establishes connections to provided addresses and asynchronously sends and
+     * receives messages from them.
+     *
+     * @param addrs Addresses to connect to.
+     * @param conn_limit Connection upper limit. Zero means limit is disabled.
+     *
+     * @throw IgniteError on error.
+     */
+    void start(std::vector<tcp_range> addrs, uint32_t conn_limit) override {
+        m_pool->start(std::move(addrs), conn_limit);
+    }
+
+    /**
+     * Close all established connections and stops handling threads.
+     */
+    void stop() override { m_pool->stop(); }
+
+    /**
+     * Replace the addresses to connect to.
+     *
+     * @param addrs Addresses to connect to.
+     */
+    void update_addresses(std::vector<tcp_range> addrs) override { m_pool->update_addresses(std::move(addrs)); }
+
+    /**
+     * Set handler.
+     *
+     * @param handler Handler to set.
+     */
+    void set_handler(std::weak_ptr<async_handler> handler) override {
+        m_handler = std::move(handler);
+        m_pool->set_handler(this->weak_from_this());
+    }
+
+    /**
+     * Send data to specific established connection.
+     *
+     * @param id Client ID.
+     * @param data Data to be sent.
+     * @return @c true if connection is present and @c false otherwise.
+     *
+     * @throw IgniteError on error.
+     */
+    bool send(uint64_t id, std::vector<std::byte> &&data) override { return send_below<FILTERS>(id, std::move(data)); }
+
+    /**
+     * Closes specified connection if it's established.
+     *
+     * @param id Client ID.
+     * @param err Optional error.
+     */
+    void close(uint64_t id, std::optional<ignite_error> err) override { close_below<FILTERS>(id, std::move(err)); }
+
+    /**
+     * Callback that called on successful connection establishment.
+     *
+     * @param addr Address of the new connection.
+     * @param id Connection ID.
+     */
+    void on_connection_success(const end_point &addr, uint64_t id) override { connection_success_at<0>(addr, id); }
+
+    /**
+     * Callback that called on error during connection establishment.
+     *
+     * @param addr Connection address.
+     * @param err Error.
+     */
+    void on_connection_error(const end_point &addr, ignite_error err) override {
+        connection_error_at<0>(addr, std::move(err));
+    }
+
+    /**
+     * Callback that called on error during connection establishment.
+     *
+     * @param id Async client ID.
+     * @param err Error. Can be null if connection closed without error.
+     */
+    void on_connection_closed(uint64_t id, std::optional<ignite_error> err) override {
+        connection_closed_at<0>(id, std::move(err));
+    }
+
+    /**
+     * Callback that called when new message is received.
+     *
+     * @param id Async client ID.
+     * @param msg Received message.
+     */
+    void on_message_received(uint64_t id, bytes_view msg) override { message_received_at<0>(id, msg); }
+
+    /**
+     * Callback that called when message is sent.
+     *
+     * @param id Async client ID.
+     */
+    void on_message_sent(uint64_t id) override { message_sent_at<0>(id); }
+
+    /**
+     * Callback that called when the send queue of the connection becomes saturated or drains. The filters do not
+     * queue data, so the event goes directly to the handler.
+     *
+     * @param id Async client ID.
+     * @param saturated @c true if the queue has become saturated.
+     */
+    void on_send_queue_saturation(uint64_t id, bool saturated) override {
+        if (auto handler = m_handler.lock())
+            handler->on_send_queue_saturation(id, saturated);
+    }
+
+    /**
+     * Callback that called when the total size of the send queues becomes saturated or drains. Goes directly to the
+     * handler as well.
+     *
+     * @param saturated @c true if the total size has become saturated.
+     */
+    void on_total_send_queue_saturation(bool saturated) override {
+        if (auto handler = m_handler.lock())
+            handler->on_total_send_queue_saturation(saturated);
+    }
+
+private:
+    /**
+     * Layer of the filter with the specified index. Passes events to the neighbouring filters.
+     *
+     * @tparam I Filter index.
+     */
+    template<std::size_t I>
+    class layer {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param pipeline Pipeline.
+         */
+        explicit layer(static_filter_pipeline &pipeline)
+            : m_pipeline(pipeline) {}
+
+        /**
+         * Send data to the layer below.
+         *
+         * @param id Client ID.
+         * @param data Data to be sent.
+         * @return @c true if connection is present and @c false otherwise.
+         */
+        bool send(uint64_t id, std::vector<std::byte> &&data) {
+            return m_pipeline.template send_below<I>(id, std::move(data));
+        }
+
+        /**
+         * Close connection through the layer below.
+         *
+         * @param id Client ID.
+         * @param err Optional error.
+         */
+        void close(uint64_t id, std::optional<ignite_error> err) {
+            m_pipeline.template close_below<I>(id, std::move(err));
+        }
+
+        /**
+         * Pass connection success to the layer above.
+         *
+         * @param addr Address of the new connection.
+         * @param id Connection ID.
+         */
+        void on_connection_success(const end_point &addr, uint64_t id) {
+            m_pipeline.template connection_success_at<I + 1>(addr, id);
+        }
+
+        /**
+         * Pass connection error to the layer above.
+         *
+         * @param addr Connection address.
+         * @param err Error.
+         */
+        void on_connection_error(const end_point &addr, ignite_error err) {
+            m_pipeline.template connection_error_at<I + 1>(addr, std::move(err));
+        }
+
+        /**
+         * Pass connection close to the layer above.
+         *
+         * @param id Async client ID.
+         * @param err Error. Can be null if connection closed without error.
+         */
+        void on_connection_closed(uint64_t id, std::optional<ignite_error> err) {
+            m_pipeline.template connection_closed_at<I + 1>(id, std::move(err));
+        }
+
+        /**
+         * Pass received message to the layer above.
+         *
+         * @param id Async client ID.
+         * @param msg Received message.
+         */
+        void on_message_received(uint64_t id, bytes_view msg) {
+            m_pipeline.template message_received_at<I + 1>(id, msg);
+        }
+
+        /**
+         * Pass message sent event to the layer above.
+         *
+         * @param id Async client ID.
+         */
+        void on_message_sent(uint64_t id) { m_pipeline.template message_sent_at<I + 1>(id); }
+
+    private:
+        /** Pipeline. */
+        static_filter_pipeline &m_pipeline;
+    };
+
+    /**
+     * Send data through the filters below the specified index.
+     *
+     * @tparam I Index.
+     * @param id Client ID.
+     * @param data Data to be sent.
+     * @return @c true if connection is present and @c false otherwise.
+     */
+    template<std::size_t I>
+    bool send_below(uint64_t id, std::vector<std::byte> &&data) {
+        if constexpr (I == 0) {
+            return m_pool->send(id, std::move(data));
+        } else {
+            layer<I - 1> layer0(*this);
+            return std::get<I - 1>(m_filters).send(layer0, id, std::move(data));
+        }
+    }
+
+    /**
+     * Close connection through the filters below the specified index.
+     *
+     * @tparam I Index.
+     * @param id Client ID.
+     * @param err Optional error.
+     */
+    template<std::size_t I>
+    void close_below(uint64_t id, std::optional<ignite_error> err) {
+        if constexpr (I == 0) {
+            m_pool->close(id, std::move(err));
+        } else {
+            layer<I - 1> layer0(*this);
+            std::get<I - 1>(m_filters).close(layer0, id, std::move(err));
+        }
+    }
+
+    /**
+     * Pass connection success to the filter with the specified index, or to the handler after the last filter.
+     *
+     * @tparam I Index.
+     * @param addr Address of the new connection.
+     * @param id Connection ID.
+     */
+    template<std::size_t I>
+    void connection_success_at(const end_point &addr, uint64_t id) {
+        if constexpr (I == FILTERS) {
+            if (auto handler = m_handler.lock())
+                handler->on_connection_success(addr, id);
+        } else {
+            layer<I> layer0(*this);
+            std::get<I>(m_filters).on_connection_success(layer0, addr, id);
+        }
+    }
+
+    /**
+     * Pass connection error to the filter with the specified index, or to the handler after the last filter.
+     *
+     * @tparam I Index.
+     * @param addr Connection address.
+     * @param err Error.
+     */
+    template<std::size_t I>
+    void connection_error_at(const end_point &addr, ignite_error err) {
+        if constexpr (I == FILTERS) {
+            if (auto handler = m_handler.lock())
+                handler->on_connection_error(addr, std::move(err));
+        } else {
+            layer<I> layer0(*this);
+            std::get<I>(m_filters).on_connection_error(layer0, addr, std::move(err));
+        }
+    }
+
+    /**
+     * Pass connection close to the filter with the specified index, or to the handler after the last filter.
+     *
+     * @tparam I Index.
+     * @param id Async client ID.
+     * @param err Error. Can be null if connection closed without error.
+     */
+    template<std::size_t I>
+    void connection_closed_at(uint64_t id, std::optional<ignite_error> err) {
+        if constexpr (I == FILTERS) {
+            if (auto handler = m_handler.lock())
+                handler->on_connection_closed(id, std::move(err));
+        } else {
+            layer<I> layer0(*this);
+            std::get<I>(m_filters).on_connection_closed(layer0, id, std::move(err));
+        }
+    }
+
+    /**
+     * Pass received message to the filter with the specified index, or to the handler after the last filter.
+     *
+     * @tparam I Index.
+     * @param id Async client ID.
+     * @param msg Received message.
+     */
+    template<std::size_t I>
+    void message_received_at(uint64_t id, bytes_view msg) {
+        if constexpr (I == FILTERS) {
+            if (auto handler = m_handler.lock())
+                handler->on_message_received(id, msg);
+        } else {
+            layer<I> layer0(*this);
+            std::get<I>(m_filters).on_message_received(layer0, id, msg);
+        }
+    }
+
+    /**
+     * Pass message sent event to the filter with the specified index, or to the handler after the last filter.
+     *
+     * @tparam I Index.
+     * @param id Async client ID.
+     */
+    template<std::size_t I>
+    void message_sent_at(uint64_t id) {
+        if constexpr (I == FILTERS) {
+            if (auto handler = m_handler.lock())
+                handler->on_message_sent(id);
+        } else {
+            layer<I> layer0(*this);
+            std::get<I>(m_filters).on_message_sent(layer0, id);
+        }
+    }
+
+    /** Underlying pool. */
+    std::shared_ptr<async_client_pool> m_pool;
+
+    /** Event handler. */
+    std::weak_ptr<async_handler> m_handler;
+
+    /** Filters. */
+    std::tuple<Filters...> m_filters;
+};
+
+} // namespace ignite::network
@@ -0,0 +1,153 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "static_error_handling_filter.h"
+#include "static_filter_pipeline.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace ignite;
+using namespace ignite::network;
+
+namespace {
+
+/**
+ * Pool that records everything sent to it.
+ */
+class mock_pool : public async_client_pool {
+public:
+    void start(std::vector<tcp_range>, uint32_t) override {}
+
+    void stop() override {}
+
+    void update_addresses(std::vector<tcp_range>) override {}
+
+    void set_handler(std::weak_ptr<async_handler> handler) override { m_handler = std::move(handler); }
+
+    bool send(uint64_t id, std::vector<std::byte> &&data) override {
+        m_sent.emplace_back(id, std::move(data));
+        return true;
+    }
+
+    void close(uint64_t id, std::optional<ignite_error> err) override { m_closed.emplace_back(id, std::move(err)); }
+
+    /** Handler. */
+    std::weak_ptr<async_handler> m_handler;
+
+    /** Sent data. */
+    std::vector<std::pair<uint64_t, std::vector<std::byte>>> m_sent;
+
+    /** Closed connections. */
+    std::vector<std::pair<uint64_t, std::optional<ignite_error>>> m_closed;
+};
+
+/**
+ * Handler that records received messages and throws on demand.
+ */
+class mock_handler : public async_handler {
+public:
+    void on_connection_success(const end_point &, uint64_t) override {}
+
+    void on_connection_error(const end_point &, ignite_error) override {}
+
+    void on_connection_closed(uint64_t, std::optional<ignite_error>) override {}
+
+    void on_message_received(uint64_t, bytes_view msg) override {
+        if (m_throw)
+            throw ignite_error(status_code::GENERIC, "Handler failure");
+
+        m_received.emplace_back(reinterpret_cast<const char *>(msg.data()), msg.size());
+    }
+
+    void on_message_sent(uint64_t) override {}
+
+    /** Whether to throw on message. */
+    bool m_throw{false};
+
+    /** Received messages. */
+    std::vector<std::string> m_received;
+};
+
+/**
+ * Filter that appends its tag to the sent data and to the received messages.
+ */
+template<char Tag>
+class tag_filter : public static_filter {
+public:
+    template<typename Layer>
+    bool send(Layer &layer, uint64_t id, std::vector<std::byte> &&data) {
+        data.push_back(std::byte(Tag));
+        return layer.send(id, std::move(data));
+    }
+
+    template<typename Layer>
+    void on_message_received(Layer &layer, uint64_t id, bytes_view msg) {
+        std::vector<std::byte> tagged(msg.begin(), msg.end());
+        tagged.push_back(std::byte(Tag));
+        layer.on_message_received(id, tagged);
+    }
+};
+
+/**
+ * Convert string to bytes.
+ *
+ * @param str String.
+ * @return Bytes.
+ */
+std::vector<std::byte> to_bytes(const std::string &str) {
+    auto begin = reinterpret_cast<const std::byte *>(str.data());
+    return {begin, begin + str.size()};
+}
+
+} // namespace
+
+TEST(static_filter_pipeline, filter_order) {
+    auto pool = std::make_shared<mock_pool>();
+    auto handler = std::make_shared<mock_handler>();
+    auto pipeline = std::make_shared<static_filter_pipeline<tag_filter<'a'>, tag_filter<'b'>>>(pool);
+    pipeline->set_handler(handler);
+
+    // The first filter is the closest to the pool.
+    EXPECT_TRUE(pipeline->send(1, to_bytes("x")));
+    ASSERT_EQ(1, pool->m_sent.size());
+    EXPECT_EQ(1, pool->m_sent[0].first);
+    EXPECT_EQ(to_bytes("xba"), pool->m_sent[0].second);
+
+    auto msg = to_bytes("y");
+    pool->m_handler.lock()->on_message_received(1, msg);
+    ASSERT_EQ(1, handler->m_received.size());
+    EXPECT_EQ("yab", handler->m_received[0]);
+}
+
+TEST(static_filter_pipeline, error_handling_closes_connection) {
+    auto pool = std::make_shared<mock_pool>();
+    auto handler = std::make_shared<mock_handler>();
+    auto pipeline = std::make_shared<static_filter_pipeline<static_error_handling_filter, tag_filter<'a'>>>(pool);
+    pipeline->set_handler(handler);
+
+    handler->m_throw = true;
+
+    auto msg = to_bytes("y");
+    EXPECT_NO_THROW(pool->m_handler.lock()->on_message_received(7, msg));
+
+    ASSERT_EQ(1, pool->m_closed.size());
+    EXPECT_EQ(7, pool->m_closed[0].first);
+    ASSERT_TRUE(pool->m_closed[0].second.has_value());
+    EXPECT_EQ(status_code::GENERIC, pool->m_closed[0].second->get_status_code());
+}
@@ -60,6 +60,17 @@ namespace ignite::network {
 
 std::optional<tcp_range> tcp_range::parse(std::string_view str, uint16_t def_port) {
     tcp_range res;
+    if (is_unix_socket_host(str)) {
+        if (str.size() == UNIX_SOCKET_PREFIX.size())
+            return std::nullopt;
+
+        res.host = str;
+        res.port = 0;
+        res.range = 0;
+
+        return {std::move(res)};
+    }
+
     size_t colon_num = std::count(str.begin(), str.end(), ':');
 
     if (colon_num == 0) {
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <ignite/network/end_point.h>
+
 #include <cstdint>
 #include <optional>
 #include <string>
@@ -33,6 +35,9 @@ struct tcp_range {
     /**
      * Parse string and try to get TcpRange.
      *
+     * Strings starting with UNIX_SOCKET_PREFIX are parsed as a Unix domain socket path. Port range is not
+     * applicable for them.
+     *
      * @param str String to parse.
      * @param defPort Default port.
      * @return TcpRange instance on success and none on failure.
@@ -74,10 +79,29 @@ struct tcp_range {
      * @return String representation.
      */
     [[nodiscard]] std::string to_string() const {
+        if (is_unix_socket())
+            return host;
+
         return host + ':' + std::to_string(port) + ".." + std::to_string(port + range);
     }
 
-    /** Remote host. */
+    /**
+     * Check whether the range denotes a Unix domain socket.
+     *
+     * @return @c true if the range is a Unix domain socket path.
+     */
+    [[nodiscard]] bool is_unix_socket() const { return is_unix_socket_host(host); }
+
+    /**
+     * Get Unix domain socket path.
+     *
+     * @return Path to the socket file. Only meaningful if is_unix_socket() returns @c true.
+     */
+    [[nodiscard]] std::string_view unix_socket_path() const {
+        return std::string_view(host).substr(UNIX_SOCKET_PREFIX.size());
+    }
+
+    /** Remote host or Unix domain socket path prefixed with UNIX_SOCKET_PREFIX. */
     std::string host;
 
     /** TCP port. */
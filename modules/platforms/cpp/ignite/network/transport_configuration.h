@@ -0,0 +1,104 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <ignite/network/event_loop_group.h>
+
+#include <cstddef>
+#include <memory>
+
+namespace ignite::network {
+
+/**
+ * Socket tuning profile.
+ */
+enum class socket_profile {
+    /** Fixed 64 KiB socket buffers, no delay. */
+    DEFAULT,
+
+    /**
+     * Minimal latency at the cost of CPU: busy polling of the sockets (SO_BUSY_POLL), spinning on the event loop
+     * before blocking on epoll_wait, and, optionally, pinning of the I/O thread to a CPU.
+     */
+    LOW_LATENCY,
+
+    /**
+     * Maximal throughput: socket buffers are autotuned by the kernel, partial batches are sent with MSG_MORE, and
+     * a larger receive buffer is used.
+     */
+    THROUGHPUT,
+};
+
+/**
+ * Transport configuration.
+ */
+struct transport_configuration {
+    /**
+     * Use shared memory for connections to nodes running on the same host, if the node provides a shared memory
+     * segment. Falls back to TCP otherwise. Only supported on Linux.
+     *
+     * Ignite server nodes do not create the segments yet, so against a server the connections always fall back to
+     * TCP. Only a peer that creates the segments itself, such as a test server, is connected over shared memory.
+     */
+    bool shared_memory_enabled{false};
+
+    /**
+     * Send through the submission queue. Application threads push packets into a lock-free queue and wake the I/O
+     * thread, which then writes all pending packets of a connection with a single vectored write. Reduces contention
+     * when many threads share a connection. Otherwise, packets are sent directly from the calling thread.
+     */
+    bool submission_queue_enabled{false};
+
+    /**
+     * Minimal size of a packet sent with MSG_ZEROCOPY. Such packets are not copied into the kernel, and their
+     * memory is only released when the kernel reports the send completion. Zero disables zero-copy sends.
+     * Only supported on Linux. Disabled for a connection when the kernel reports it has to copy the data anyway,
+     * e.g. for loopback connections.
+     */
+    std::size_t zero_copy_threshold{0};
+
+    /** Socket tuning profile. Only supported on Linux. */
+    socket_profile profile{socket_profile::DEFAULT};
+
+    /** CPU to pin the I/O thread to. Negative value disables pinning. Only supported on Linux. */
+    int io_thread_cpu{-1};
+
+    /**
+     * Event loops to serve the connections. The pool starts its own I/O thread if not set. CPU pinning and event loop
+     * spinning of the low-latency profile do not apply to the shared event loops. Not supported on Windows.
+     */
+    std::shared_ptr<event_loop_group> event_loops;
+
+    /**
+     * High watermark of the send queue of a connection, in bytes. Once the queued data reaches it, the pool rejects
+     * further data for the connection until the queue drains to the low watermark. Zero means no limit. Only supported
+     * for TCP connections on Linux and macOS, and for shared memory connections.
+     */
+    std::size_t send_queue_limit{0};
+
+    /** Low watermark of the send queue of a connection, in bytes. Zero means half of the limit. */
+    std::size_t send_queue_low_watermark{0};
+
+    /**
+     * High watermark of the total size of the send queues of all the connections of the pool, in bytes. The low
+     * watermark is half of it. Zero means no limit.
+     */
+    std::size_t total_send_queue_limit{0};
+};
+
+} // namespace ignite::network
@@ -24,15 +24,8 @@ namespace ignite::protocol {
 
 reader::reader(bytes_view buffer)
     : m_buffer(buffer)
-    , m_unpacker()
     , m_current_val()
     , m_move_res(MSGPACK_UNPACK_SUCCESS) {
-    // TODO: Research if we can get rid of copying here.
-    msgpack_unpacker_init(&m_unpacker, MSGPACK_UNPACKER_INIT_BUFFER_SIZE);
-    msgpack_unpacker_reserve_buffer(&m_unpacker, m_buffer.size());
-    memcpy(msgpack_unpacker_buffer(&m_unpacker), m_buffer.data(), m_buffer.size());
-    msgpack_unpacker_buffer_consumed(&m_unpacker, m_buffer.size());
-
     msgpack_unpacked_init(&m_current_val);
 
     next();
@@ -46,10 +39,29 @@ bool reader::try_read_nil() {
     return true;
 }
 
+std::uint32_t reader::read_array_header() {
+    auto size = read_array_size();
+
+    // The array is already unpacked with its elements, so the header is parsed once more to skip it only.
+    auto tag = std::uint8_t(m_buffer[m_current_offset]);
+    std::size_t header_len = 1;
+    if (tag == 0xdc)
+        header_len += 2;
+    else if (tag == 0xdd)
+        header_len += 4;
+
+    m_offset = m_current_offset + header_len;
+    next();
+
+    return size;
+}
+
 void reader::next() {
     check_data_in_stream();
 
-    m_move_res = msgpack_unpacker_next(&m_unpacker, &m_current_val);
+    m_current_offset = m_offset;
+    m_move_res = msgpack_unpack_next(
+        &m_current_val, reinterpret_cast<const char *>(m_buffer.data()), m_buffer.size(), &m_offset);
 }
 
 } // namespace ignite::protocol
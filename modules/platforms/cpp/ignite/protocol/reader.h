@@ -51,7 +51,7 @@ public:
     /**
      * Destructor.
      */
-    ~reader() { msgpack_unpacker_destroy(&m_unpacker); }
+    ~reader() { msgpack_unpacked_destroy(&m_current_val); }
 
     /**
      * Read object of type T from msgpack stream.
@@ -206,6 +206,16 @@ public:
         return unpack_array_size(m_current_val.data);
     }
 
+    /**
+     * Read array header only and move to the first element.
+     *
+     * Unlike read_array_size(), the elements are then read one by one with the usual methods. This is how the arrays
+     * are read that the server writes as a header followed by the flat values of several fields per element.
+     *
+     * @return Array size as written in the header.
+     */
+    [[nodiscard]] std::uint32_t read_array_header();
+
     /**
      * Read array.
      *
@@ -235,7 +245,7 @@ public:
             res.emplace_back(std::move(val));
         }
         next();
-        return std::move(res);
+        return res;
     }
 
     /**
@@ -289,8 +299,11 @@ private:
     /** Buffer. */
     bytes_view m_buffer;
 
-    /** Unpacker. */
-    msgpack_unpacker m_unpacker;
+    /** Offset of the current value in the buffer. */
+    std::size_t m_current_offset{0};
+
+    /** Offset of the value after the current one. */
+    std::size_t m_offset{0};
 
     /** Current value. */
     msgpack_unpacked m_current_val;
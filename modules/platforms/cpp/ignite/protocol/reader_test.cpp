@@ -0,0 +1,101 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reader.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+using namespace ignite;
+using namespace ignite::protocol;
+
+namespace {
+
+/**
+ * Make a view of the test bytes.
+ */
+template<std::size_t N>
+bytes_view make_view(const std::array<std::uint8_t, N> &data) {
+    return {reinterpret_cast<const std::byte *>(data.data()), data.size()};
+}
+
+} // namespace
+
+TEST(reader, flat_array) {
+    // SQL_EXEC response as the server writes it: the column metadata fields are flat after the array header,
+    // while the rows of the page are an array of binary tuples.
+    const std::array<std::uint8_t, 52> data{0xc0, 0xc3, 0xc2, 0xc2, 0xff, 0x92, 0xa3, 0x4b, 0x45, 0x59, 0xc2, 0x04,
+        0x00, 0x13, 0xc3, 0xc0, 0xa6, 0x50, 0x55, 0x42, 0x4c, 0x49, 0x43, 0xa4, 0x54, 0x42, 0x4c, 0x31, 0xa3, 0x56,
+        0x41, 0x4c, 0xc3, 0x0e, 0x00, 0xce, 0x00, 0x01, 0x00, 0x00, 0xc3, 0xc0, 0x00, 0x00, 0x92, 0xc4, 0x02, 0x01,
+        0x02, 0xc4, 0x01, 0x03};
+
+    reader rd(make_view(data));
+
+    EXPECT_TRUE(rd.try_read_nil());
+    EXPECT_TRUE(rd.read_bool());
+    EXPECT_FALSE(rd.read_bool());
+    EXPECT_FALSE(rd.read_bool());
+    EXPECT_EQ(-1, rd.read_int64());
+
+    ASSERT_EQ(2, rd.read_array_header());
+
+    EXPECT_EQ("KEY", rd.read_string());
+    EXPECT_FALSE(rd.read_bool());
+    EXPECT_EQ(4, rd.read_int32());
+    EXPECT_EQ(0, rd.read_int32());
+    EXPECT_EQ(19, rd.read_int32());
+    EXPECT_TRUE(rd.read_bool());
+    EXPECT_TRUE(rd.try_read_nil());
+    EXPECT_EQ("PUBLIC", rd.read_string());
+    EXPECT_EQ("TBL1", rd.read_string());
+
+    EXPECT_EQ("VAL", rd.read_string());
+    EXPECT_TRUE(rd.read_bool());
+    EXPECT_EQ(14, rd.read_int32());
+    EXPECT_EQ(0, rd.read_int32());
+    EXPECT_EQ(65536, rd.read_int32());
+    EXPECT_TRUE(rd.read_bool());
+    EXPECT_TRUE(rd.try_read_nil());
+    EXPECT_EQ(0, rd.read_int32());
+    EXPECT_EQ(0, rd.read_int32());
+
+    ASSERT_EQ(2, rd.read_array_header());
+    EXPECT_EQ(2, rd.read_binary().size());
+    EXPECT_EQ(1, rd.read_binary().size());
+}
+
+TEST(reader, flat_array_16bit_header) {
+    std::array<std::uint8_t, 3 + 17> data{0xdc, 0x00, 0x11};
+    for (std::uint8_t i = 0; i < 17; ++i)
+        data[3 + i] = i;
+
+    reader rd(make_view(data));
+
+    ASSERT_EQ(17, rd.read_array_header());
+    for (std::int32_t i = 0; i < 17; ++i)
+        EXPECT_EQ(i, rd.read_int32());
+}
+
+TEST(reader, whole_array) {
+    const std::array<std::uint8_t, 4> data{0x92, 0x01, 0x02, 0x03};
+
+    reader rd(make_view(data));
+
+    EXPECT_EQ((std::vector<std::int32_t>{1, 2}), rd.read_array<std::int32_t>());
+    EXPECT_EQ(3, rd.read_int32());
+}
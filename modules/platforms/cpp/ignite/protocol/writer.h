@@ -137,6 +137,13 @@ public:
         msgpack_pack_ext_with_body(m_packer.get(), data.data(), data.size(), std::int8_t(extension_type::BITMASK));
     }
 
+    /**
+     * Write already packed data as is.
+     *
+     * @param data Packed data.
+     */
+    void write_raw(bytes_view data) { m_buffer.write_raw(data); }
+
 private:
     /**
      * Write callback.
@@ -310,6 +310,24 @@ public:
      */
     void append_bytes(bytes_view bytes);
 
+    /**
+     * @brief Writes binary value of specified element in place.
+     *
+     * Lets large values be written directly to the tuple without an intermediate buffer.
+     *
+     * @tparam FillT Callable taking the value position and size.
+     * @param size Value size. Should match the claimed size.
+     * @param fill Function that writes exactly @c size bytes to the given position.
+     */
+    template<typename FillT>
+    void append_bytes(SizeT size, FillT &&fill) {
+        assert(element_index < element_count);
+        assert(next_value + size <= value_base + value_area_size);
+        fill(next_value, size);
+        next_value += size;
+        append_entry();
+    }
+
     /**
      * @brief Writes binary value of specified element.
      *
@@ -0,0 +1,184 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "binary_tuple_parser.h"
+#include "ignite_type.h"
+
+#include <ignite/common/bytes_view.h>
+#include <ignite/common/hash_utils.h>
+#include <ignite/common/ignite_error.h>
+#include <ignite/common/uuid.h>
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+
+namespace ignite {
+
+/**
+ * @brief Colocation hash calculator.
+ *
+ * Computes the hash of the colocation columns of a row the same way as the server does. The value of every column is
+ * hashed with the hash of the previous columns as the seed. A row with the same colocation column values always gets
+ * the same hash, and so the same partition.
+ */
+class hash_calculator {
+public:
+    /**
+     * @brief Appends null.
+     */
+    void append_null() noexcept { m_hash = hash_utils::hash32(std::int8_t(0), m_hash); }
+
+    /**
+     * @brief Appends a value.
+     *
+     * @param value Value.
+     */
+    void append_int8(std::int8_t value) noexcept { m_hash = hash_utils::hash32(value, m_hash); }
+
+    /**
+     * @brief Appends a value.
+     *
+     * @param value Value.
+     */
+    void append_int16(std::int16_t value) noexcept { m_hash = hash_utils::hash32(value, m_hash); }
+
+    /**
+     * @brief Appends a value.
+     *
+     * @param value Value.
+     */
+    void append_int32(std::int32_t value) noexcept { m_hash = hash_utils::hash32(value, m_hash); }
+
+    /**
+     * @brief Appends a value.
+     *
+     * @param value Value.
+     */
+    void append_int64(std::int64_t value) noexcept { m_hash = hash_utils::hash32(value, m_hash); }
+
+    /**
+     * @brief Appends a value. The value is hashed as its bits.
+     *
+     * @param value Value.
+     */
+    void append_float(float value) noexcept {
+        std::int32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        append_int32(bits);
+    }
+
+    /**
+     * @brief Appends a value. The value is hashed as its bits.
+     *
+     * @param value Value.
+     */
+    void append_double(double value) noexcept {
+        std::int64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        append_int64(bits);
+    }
+
+    /**
+     * @brief Appends a value as its most significant and then least significant halves.
+     *
+     * @param value Value.
+     */
+    void append_uuid(const uuid &value) noexcept {
+        append_int64(value.getMostSignificantBits());
+        append_int64(value.getLeastSignificantBits());
+    }
+
+    /**
+     * @brief Appends a STRING or BINARY value. A string is hashed as its UTF-8 bytes.
+     *
+     * @param value Value.
+     */
+    void append_bytes(bytes_view value) noexcept { m_hash = hash_utils::hash32(value, m_hash); }
+
+    /**
+     * @brief Appends a value of the binary tuple element.
+     *
+     * @param typ Element type.
+     * @param value Element value, as returned by binary_tuple_parser::get_next().
+     */
+    void append(ignite_type typ, const std::optional<bytes_view> &value) {
+        if (!value) {
+            append_null();
+            return;
+        }
+
+        switch (typ) {
+            case ignite_type::INT8:
+                append_int8(binary_tuple_parser::get_int8(*value));
+                break;
+            case ignite_type::INT16:
+                append_int16(binary_tuple_parser::get_int16(*value));
+                break;
+            case ignite_type::INT32:
+                append_int32(binary_tuple_parser::get_int32(*value));
+                break;
+            case ignite_type::INT64:
+                append_int64(binary_tuple_parser::get_int64(*value));
+                break;
+            case ignite_type::FLOAT:
+                append_float(binary_tuple_parser::get_float(*value));
+                break;
+            case ignite_type::DOUBLE:
+                append_double(binary_tuple_parser::get_double(*value));
+                break;
+            case ignite_type::UUID:
+                append_uuid(binary_tuple_parser::get_uuid(*value));
+                break;
+            case ignite_type::STRING:
+            case ignite_type::BINARY:
+                append_bytes(*value);
+                break;
+            default:
+                // TODO: IGNITE-18035 Support other types
+                throw ignite_error("Type with id " + std::to_string(int(typ)) + " is not yet supported");
+        }
+    }
+
+    /**
+     * @brief Gets the hash of the appended values.
+     *
+     * @return Hash.
+     */
+    [[nodiscard]] std::int32_t get_hash() const noexcept { return m_hash; }
+
+    /**
+     * @brief Gets the partition for the hash.
+     *
+     * @param hash Colocation hash.
+     * @param partitions Number of partitions. Should be positive.
+     * @return Partition, from zero to @c partitions exclusive.
+     */
+    [[nodiscard]] static constexpr std::int32_t get_partition(std::int32_t hash, std::int32_t partitions) noexcept {
+        auto partition = hash % partitions;
+        return partition < 0 ? -partition : partition;
+    }
+
+private:
+    /** Hash of the appended values. */
+    std::int32_t m_hash{0};
+};
+
+} // namespace ignite
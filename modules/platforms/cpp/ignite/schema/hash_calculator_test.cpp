@@ -0,0 +1,176 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "binary_tuple_builder.h"
+#include "binary_tuple_parser.h"
+#include "hash_calculator.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace ignite;
+
+TEST(hash_calculator, BinaryTupleMatchesValues) {
+    std::string str{"colocation key"};
+    uuid id{0x0102030405060708, -1};
+
+    hash_calculator expected;
+    expected.append_int8(-7);
+    expected.append_int16(1000);
+    expected.append_int32(-100000);
+    expected.append_int64(1LL << 40);
+    expected.append_float(1.5f);
+    expected.append_double(-2.25);
+    expected.append_uuid(id);
+    expected.append_bytes({reinterpret_cast<const std::byte *>(str.data()), str.size()});
+    expected.append_null();
+
+    binary_tuple_builder builder(9);
+    builder.start();
+    builder.claim_int8(-7);
+    builder.claim_int16(1000);
+    builder.claim_int32(-100000);
+    builder.claim_int64(1LL << 40);
+    builder.claim_float(1.5f);
+    builder.claim_double(-2.25);
+    builder.claim_uuid(id);
+    builder.claim_string(str);
+    builder.claim(std::nullopt);
+    builder.layout();
+    builder.append_int8(-7);
+    builder.append_int16(1000);
+    builder.append_int32(-100000);
+    builder.append_int64(1LL << 40);
+    builder.append_float(1.5f);
+    builder.append_double(-2.25);
+    builder.append_uuid(id);
+    builder.append_string(str);
+    builder.append(std::nullopt);
+    auto &tuple = builder.build();
+
+    const ignite_type types[] = {ignite_type::INT8, ignite_type::INT16, ignite_type::INT32, ignite_type::INT64,
+        ignite_type::FLOAT, ignite_type::DOUBLE, ignite_type::UUID, ignite_type::STRING, ignite_type::INT32};
+
+    binary_tuple_parser parser(9, tuple);
+    hash_calculator actual;
+    for (auto typ : types)
+        actual.append(typ, parser.get_next());
+
+    EXPECT_EQ(expected.get_hash(), actual.get_hash());
+}
+
+TEST(hash_calculator, JavaReferenceValues) {
+    // Values of HashCalculator.hash() of the server for the same sequences of values.
+    hash_calculator int64_key;
+    int64_key.append_int64(42);
+    EXPECT_EQ(1065270881, int64_key.get_hash());
+
+    hash_calculator multi_column_key;
+    multi_column_key.append_int32(1);
+    multi_column_key.append_int64(-5);
+    multi_column_key.append_bytes({reinterpret_cast<const std::byte *>("abc"), 3});
+    EXPECT_EQ(-800226275, multi_column_key.get_hash());
+
+    hash_calculator uuid_key;
+    uuid_key.append_uuid(uuid{0x0102030405060708, -1});
+    EXPECT_EQ(1270247712, uuid_key.get_hash());
+
+    std::string str{"colocation key"};
+    hash_calculator string_key;
+    string_key.append_bytes({reinterpret_cast<const std::byte *>(str.data()), str.size()});
+    EXPECT_EQ(-366250788, string_key.get_hash());
+
+    hash_calculator all_types;
+    all_types.append_int8(-7);
+    all_types.append_int16(1000);
+    all_types.append_int32(-100000);
+    all_types.append_int64(1LL << 40);
+    all_types.append_float(1.5f);
+    all_types.append_double(-2.25);
+    all_types.append_uuid(uuid{0x0102030405060708, -1});
+    all_types.append_bytes({reinterpret_cast<const std::byte *>(str.data()), str.size()});
+    all_types.append_null();
+    EXPECT_EQ(-1832640519, all_types.get_hash());
+}
+
+TEST(hash_calculator, SeedChaining) {
+    hash_calculator calc;
+    calc.append_int32(1);
+    calc.append_int32(2);
+
+    EXPECT_EQ(hash_utils::hash32(std::int32_t(2), hash_utils::hash32(std::int32_t(1), 0)), calc.get_hash());
+
+    hash_calculator reversed;
+    reversed.append_int32(2);
+    reversed.append_int32(1);
+
+    EXPECT_NE(calc.get_hash(), reversed.get_hash());
+}
+
+TEST(hash_calculator, UnsupportedType) {
+    std::byte data[3]{};
+    hash_calculator calc;
+
+    EXPECT_THROW(calc.append(ignite_type::DATE, bytes_view{data, 3}), ignite_error);
+}
+
+TEST(hash_calculator, Partition) {
+    EXPECT_EQ(0, hash_calculator::get_partition(0, 10));
+    EXPECT_EQ(3, hash_calculator::get_partition(13, 10));
+    EXPECT_EQ(3, hash_calculator::get_partition(-13, 10));
+    EXPECT_EQ(8, hash_calculator::get_partition(INT32_MIN, 10));
+    EXPECT_EQ(7, hash_calculator::get_partition(INT32_MAX, 10));
+    EXPECT_EQ(0, hash_calculator::get_partition(-5, 1));
+
+    for (std::int64_t key = -1000; key < 1000; ++key) {
+        hash_calculator calc;
+        calc.append_int64(key);
+        auto partition = hash_calculator::get_partition(calc.get_hash(), 25);
+        EXPECT_GE(partition, 0);
+        EXPECT_LT(partition, 25);
+    }
+}
+
+// Throughput benchmark, not a part of the unit suite. Run it with --gtest_also_run_disabled_tests.
+TEST(hash_calculator, DISABLED_Throughput) {
+    constexpr std::int64_t KEYS = 4'000'000;
+    constexpr std::int32_t PARTITIONS = 25;
+
+    // Two-column key: a long and a short string, hashed column by column like the client does.
+    std::string suffix{"colocation-key-suffix"};
+    bytes_view suffix_bytes{reinterpret_cast<const std::byte *>(suffix.data()), suffix.size()};
+
+    std::int64_t partition_sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (std::int64_t key = 0; key < KEYS; ++key) {
+        hash_calculator calc;
+        calc.append_int64(key);
+        calc.append_bytes(suffix_bytes);
+        partition_sum += hash_calculator::get_partition(calc.get_hash(), PARTITIONS);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    // The sum keeps the loop from being optimized away.
+    EXPECT_GT(partition_sum, 0);
+
+    std::cout << "Hashed " << KEYS << " keys in " << elapsed.count() << " s, " << std::int64_t(KEYS / elapsed.count())
+              << " keys/s" << std::endl;
+}
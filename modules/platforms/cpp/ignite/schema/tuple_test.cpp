@@ -638,6 +638,33 @@ TEST(tuple, SingleVarlen) { // NOLINT(cert-err58-cpp)
     checkReaderWriterEquality(schema, values, data);
 }
 
+TEST(tuple, VarlenFilledInPlace) { // NOLINT(cert-err58-cpp)
+    std::vector<std::byte> value(1000);
+    for (std::size_t i = 0; i < value.size(); ++i)
+        value[i] = std::byte(i * 7);
+
+    binary_tuple_builder expected_builder(2);
+    expected_builder.start();
+    expected_builder.claim_int32(42);
+    expected_builder.claim_bytes(value);
+    expected_builder.layout();
+    expected_builder.append_int32(42);
+    expected_builder.append_bytes(value);
+
+    binary_tuple_builder builder(2);
+    builder.start();
+    builder.claim_int32(42);
+    builder.claim(SizeT(value.size()));
+    builder.layout();
+    builder.append_int32(42);
+    builder.append_bytes(SizeT(value.size()), [&value](std::byte *dst, SizeT size) {
+        EXPECT_EQ(value.size(), size);
+        std::copy(value.begin(), value.end(), dst);
+    });
+
+    EXPECT_EQ(expected_builder.build(), builder.build());
+}
+
 TEST(tuple, TinyVarlenFormatOverflowLarge) { // NOLINT(cert-err58-cpp)
     SchemaDescriptor schema;
 
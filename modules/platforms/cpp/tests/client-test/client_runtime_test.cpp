@@ -0,0 +1,120 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite_runner_suite.h"
+#include "tests/test-common/test_utils.h"
+
+#include "ignite/client/client_runtime.h"
+#include "ignite/client/ignite_client.h"
+#include "ignite/client/ignite_client_configuration.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+#include <optional>
+
+#ifndef _WIN32
+# include <poll.h>
+#endif
+
+using namespace ignite;
+
+/**
+ * Test suite.
+ */
+class client_runtime_test : public ignite_runner_suite {};
+
+TEST_F(client_runtime_test, clients_share_runtime) {
+    auto runtime = client_runtime::create(1);
+
+    ignite_client_configuration cfg{NODE_ADDRS};
+    cfg.set_logger(get_logger());
+    cfg.set_runtime(runtime);
+
+    auto client1 = ignite_client::start(cfg, std::chrono::seconds(30));
+    auto client2 = ignite_client::start(cfg, std::chrono::seconds(30));
+
+    // The threads are kept while the clients use them.
+    runtime = {};
+
+    EXPECT_TRUE(client1.get_tables().get_table("tbl1").has_value());
+    EXPECT_TRUE(client2.get_tables().get_table("tbl1").has_value());
+
+    // Stopping one client does not affect the other one.
+    client1 = {};
+    EXPECT_TRUE(client2.get_tables().get_table("tbl1").has_value());
+}
+
+#ifndef _WIN32
+
+/**
+ * Drive the runtime the way an application event loop does, until the predicate holds.
+ *
+ * @param runtime Runtime.
+ * @param pred Predicate.
+ * @return @c true if the predicate holds.
+ */
+bool drive(client_runtime &runtime, const std::function<bool()> &pred) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+
+        auto timeout = runtime.get_timeout().value_or(std::chrono::milliseconds(100));
+
+        pollfd pfd{runtime.get_fd(), POLLIN, 0};
+        int res = poll(&pfd, 1, int(std::min(timeout, std::chrono::milliseconds(100)).count()));
+
+        if (res == 1)
+            runtime.on_readable();
+        else
+            runtime.on_timer();
+    }
+
+    return true;
+}
+
+TEST_F(client_runtime_test, external_runtime) {
+    auto runtime = client_runtime::create_external();
+
+    ignite_client_configuration cfg{NODE_ADDRS};
+    cfg.set_logger(get_logger());
+    cfg.set_runtime(runtime);
+
+    std::optional<ignite_result<ignite_client>> client_res;
+    ignite_client::start_async(cfg, std::chrono::seconds(30),
+        [&client_res](ignite_result<ignite_client> &&res) { client_res = std::move(res); });
+
+    ASSERT_TRUE(drive(runtime, [&] { return client_res.has_value(); }));
+    ASSERT_FALSE(client_res->has_error()) << client_res->error().what_str();
+
+    auto client = std::move(*client_res).value();
+
+    std::optional<ignite_result<std::optional<table>>> table_res;
+    client.get_tables().get_table_async(
+        "tbl1", [&table_res](ignite_result<std::optional<table>> &&res) { table_res = std::move(res); });
+
+    ASSERT_TRUE(drive(runtime, [&] { return table_res.has_value(); }));
+    ASSERT_FALSE(table_res->has_error()) << table_res->error().what_str();
+    EXPECT_TRUE(table_res->value().has_value());
+
+    // Blocking operations are not allowed, as the loop thread runs the callbacks.
+    EXPECT_THROW((void) ignite_client::start(cfg, std::chrono::seconds(1)), ignite_error);
+}
+
+#endif
@@ -0,0 +1,201 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite_runner_suite.h"
+#include "tests/test-common/test_utils.h"
+
+#include "ignite/client/detail/cluster_connection.h"
+#include "ignite/client/detail/table/schema.h"
+#include "ignite/client/detail/table/tuple_codec.h"
+#include "ignite/client/ignite_client.h"
+#include "ignite/client/ignite_client_configuration.h"
+#include "ignite/schema/binary_tuple_builder.h"
+#include "ignite/schema/binary_tuple_parser.h"
+#include "ignite/schema/hash_calculator.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace ignite;
+
+/**
+ * Test suite.
+ *
+ * The colocation hashes of the client are checked against the ones that the server computes for the same values with
+ * its row marshaller.
+ */
+class colocation_test : public ignite_runner_suite {
+protected:
+    void SetUp() override {
+        ignite_client_configuration cfg{NODE_ADDRS};
+        cfg.set_logger(get_logger());
+
+        m_client = ignite_client::start(cfg, std::chrono::seconds(30));
+
+        m_connection = detail::cluster_connection::create(cfg);
+        sync<void>([this](ignite_callback<void> callback) { m_connection->start_async(std::move(callback)); });
+    }
+
+    void TearDown() override { m_connection->stop(); }
+
+    /**
+     * Compute the colocation hash of the values with the client.
+     *
+     * @param values Values of the colocation columns, in order.
+     * @return Hash.
+     */
+    static std::int32_t client_hash(const std::vector<primitive> &values) {
+        std::vector<detail::column> columns;
+        ignite_tuple tuple;
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            detail::column col{};
+            col.name = "COL" + std::to_string(i);
+            col.type = values[i].get_type();
+            col.is_key = true;
+            col.schema_index = std::int32_t(i);
+
+            tuple.set(col.name, values[i]);
+            columns.emplace_back(std::move(col));
+        }
+
+        detail::schema sch(1, std::int32_t(values.size()), std::move(columns));
+
+        return detail::colocation_hash(sch, tuple);
+    }
+
+    /**
+     * Compute the colocation hash of the values on the server.
+     *
+     * @param values Values of the colocation columns, in order.
+     * @return Hash.
+     */
+    std::int32_t server_hash(const std::vector<primitive> &values) {
+        // Every value takes three elements of the tuple: type, scale and value.
+        binary_tuple_builder columns{std::int32_t(values.size() * 3)};
+        columns.start();
+        for (const auto &value : values) {
+            columns.claim_int32(std::int32_t(value.get_type()));
+            columns.claim_int32(0);
+            detail::claim_column(columns, value.get_type(), value);
+        }
+        columns.layout();
+        for (const auto &value : values) {
+            columns.append_int32(std::int32_t(value.get_type()));
+            columns.append_int32(0);
+            detail::append_column(columns, value.get_type(), value);
+        }
+        auto columns_data = columns.build();
+
+        binary_tuple_builder args{6};
+        args.start();
+        args.claim_int32(std::int32_t(ignite_type::INT32));
+        args.claim_int32(0);
+        args.claim_int32(std::int32_t(values.size()));
+        args.claim_int32(std::int32_t(ignite_type::BINARY));
+        args.claim_int32(0);
+        args.claim_bytes(columns_data);
+        args.layout();
+        args.append_int32(std::int32_t(ignite_type::INT32));
+        args.append_int32(0);
+        args.append_int32(std::int32_t(values.size()));
+        args.append_int32(std::int32_t(ignite_type::BINARY));
+        args.append_int32(0);
+        args.append_bytes(columns_data);
+        auto args_data = args.build();
+
+        auto writer_func = [&args_data](protocol::writer &writer) {
+            writer.write_nil();
+            writer.write(COLOCATION_HASH_JOB);
+            writer.write(std::int32_t(2));
+            writer.write_binary(args_data);
+        };
+
+        auto reader_func = [](protocol::reader &reader) {
+            // The result is a tuple of its type, scale and value.
+            binary_tuple_parser parser(3, reader.read_binary());
+            parser.get_next();
+            parser.get_next();
+            return binary_tuple_parser::get_int32(parser.get_next().value());
+        };
+
+        return sync<std::int32_t>([&](ignite_callback<std::int32_t> callback) {
+            m_connection->perform_request<std::int32_t>(
+                detail::client_operation::COMPUTE_EXECUTE, writer_func, std::move(reader_func), std::move(callback));
+        });
+    }
+
+    /**
+     * Check that the client computes the same hash as the server.
+     *
+     * @param values Values of the colocation columns, in order.
+     */
+    void check_hash(const std::vector<primitive> &values) {
+        auto expected = server_hash(values);
+
+        EXPECT_EQ(expected, client_hash(values));
+        EXPECT_EQ(hash_calculator::get_partition(expected, PARTITIONS),
+            hash_calculator::get_partition(client_hash(values), PARTITIONS));
+    }
+
+    /** Job that computes the colocation hash on the server. */
+    static constexpr const char *COLOCATION_HASH_JOB =
+        "org.apache.ignite.internal.runner.app.PlatformTestNodeRunner$ColocationHashJob";
+
+    /** Number of partitions of the test tables. */
+    static constexpr std::int32_t PARTITIONS = 10;
+
+    /** Ignite client. */
+    ignite_client m_client;
+
+    /** Connection for the compute requests. */
+    std::shared_ptr<detail::cluster_connection> m_connection;
+};
+
+TEST_F(colocation_test, table_key_partition_matches_server) {
+    auto table = m_client.get_tables().get_table("tbl1");
+    ASSERT_TRUE(table.has_value());
+
+    auto partitions = table->get_partition_count();
+    ASSERT_EQ(PARTITIONS, partitions);
+
+    for (std::int64_t key = -50; key < 50; ++key) {
+        auto expected = hash_calculator::get_partition(server_hash({key}), partitions);
+
+        EXPECT_EQ(expected, table->get_partition(ignite_tuple{{"key", key}}));
+    }
+}
+
+TEST_F(colocation_test, uuid_key) {
+    check_hash({uuid(0x0102030405060708, -1)});
+    check_hash({uuid(-1, 0)});
+    check_hash({uuid(0, 0)});
+}
+
+TEST_F(colocation_test, string_key) {
+    check_hash({std::string("")});
+    check_hash({std::string("colocation key")});
+    check_hash({std::string("a string that is longer than a single block of the hash")});
+}
+
+TEST_F(colocation_test, multi_column_key) {
+    check_hash({std::int32_t(1), std::int64_t(-5), std::string("abc")});
+    check_hash({std::int8_t(-7), std::int16_t(1000), uuid(1, 2), std::string("x")});
+    check_hash({std::int64_t(1) << 40, 1.5f, -2.25});
+}
@@ -43,3 +43,41 @@ TEST_F(client_test, get_configuration) {
     EXPECT_EQ(cfg.get_endpoints(), cfg2.get_endpoints());
     EXPECT_EQ(cfg.get_connection_limit(), cfg2.get_connection_limit());
 }
+
+TEST_F(client_test, start_with_warmup) {
+    warmup settings;
+    settings.set_min_connections(std::uint32_t(NODE_ADDRS.size()));
+    settings.set_tables({"tbl1"});
+
+    ignite_client_configuration cfg{NODE_ADDRS};
+    cfg.set_logger(get_logger());
+    cfg.set_warmup(settings);
+    cfg.set_read_mode(read_mode::PRIMARY);
+
+    auto client = ignite_client::start(cfg, std::chrono::seconds(30));
+
+    auto table = client.get_tables().get_table("tbl1");
+    ASSERT_TRUE(table.has_value());
+    EXPECT_EQ("tbl1", table->name());
+    EXPECT_FALSE(table->record_binary_view().get(nullptr, {{"key", std::int64_t(-1)}}).has_value());
+}
+
+TEST_F(client_test, start_with_warmup_of_missing_table) {
+    warmup settings;
+    settings.set_tables({"tbl1", "unknown_table"});
+
+    ignite_client_configuration cfg{NODE_ADDRS};
+    cfg.set_logger(get_logger());
+    cfg.set_warmup(settings);
+
+    EXPECT_THROW(
+        {
+            try {
+                (void) ignite_client::start(cfg, std::chrono::seconds(30));
+            } catch (const ignite_error &e) {
+                EXPECT_NE(std::string(e.what()).find("unknown_table"), std::string::npos);
+                throw;
+            }
+        },
+        ignite_error);
+}
@@ -957,3 +957,40 @@ TEST_F(record_binary_view_test, remove_all_exact_empty) {
     auto res = tuple_view.remove_all_exact(nullptr, {});
     EXPECT_TRUE(res.empty());
 }
+
+TEST_F(record_binary_view_test, get_from_primary) {
+    ignite_client_configuration cfg{NODE_ADDRS};
+    cfg.set_logger(get_logger());
+    cfg.set_read_mode(read_mode::PRIMARY);
+
+    auto client = ignite_client::start(cfg, std::chrono::seconds(30));
+    auto view = client.get_tables().get_table("tbl1")->record_binary_view();
+
+    std::vector<ignite_tuple> records;
+    std::vector<ignite_tuple> keys;
+    for (int i = -100; i < 100; ++i) {
+        records.emplace_back(get_tuple(i, "val" + std::to_string(i)));
+        keys.emplace_back(get_tuple(i % 2 ? i : -i));
+    }
+    tuple_view.upsert_all(nullptr, records);
+
+    for (int i = -100; i < 100; i += 7) {
+        auto res = view.get(nullptr, get_tuple(i));
+        ASSERT_TRUE(res.has_value());
+        EXPECT_EQ("val" + std::to_string(i), res->get<std::string>("val"));
+    }
+
+    auto res = view.get_all(nullptr, keys);
+    ASSERT_EQ(keys.size(), res.size());
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        auto key = keys[i].get<int64_t>("key");
+        if (key == 100) {
+            EXPECT_FALSE(res[i].has_value());
+            continue;
+        }
+
+        ASSERT_TRUE(res[i].has_value());
+        EXPECT_EQ(key, res[i]->get<int64_t>("key"));
+        EXPECT_EQ("val" + std::to_string(key), res[i]->get<std::string>("val"));
+    }
+}
@@ -0,0 +1,121 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite_runner_suite.h"
+#include "tests/test-common/table_rows_suite.h"
+#include "tests/test-common/test_utils.h"
+
+#include "ignite/client/ignite_client.h"
+#include "ignite/client/ignite_client_configuration.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+using namespace ignite;
+
+/**
+ * Test suite.
+ */
+class sql_test : public table_rows_suite<ignite_runner_suite, 100> {
+protected:
+    /**
+     * Make statement selecting all the test rows.
+     *
+     * @param page_size Page size.
+     * @param prefetch_pages Prefetch depth.
+     * @return Statement.
+     */
+    static sql_statement select_all(std::int32_t page_size, std::int32_t prefetch_pages) {
+        sql_statement statement{"SELECT KEY, VAL FROM TBL1 WHERE KEY >= 0 AND KEY < ? ORDER BY KEY"};
+        statement.set_page_size(page_size);
+        statement.set_prefetch_pages(prefetch_pages);
+        return statement;
+    }
+
+    /**
+     * Read all the rows of the result set and check them.
+     *
+     * @param res Result set.
+     */
+    static void check_all_rows(result_set &res) {
+        ASSERT_TRUE(res.has_rowset());
+        ASSERT_EQ(2, res.metadata().size());
+        EXPECT_EQ("KEY", res.metadata()[0].name());
+        EXPECT_EQ(ignite_type::INT64, res.metadata()[0].type());
+
+        std::int64_t expected = 0;
+        while (true) {
+            for (auto &row : res.current_page()) {
+                EXPECT_EQ(expected, row.get<std::int64_t>("key"));
+                EXPECT_EQ("s-" + std::to_string(expected), row.get<std::string>("val"));
+                ++expected;
+            }
+
+            if (!res.has_more_pages())
+                break;
+
+            res.fetch_next_page();
+        }
+
+        EXPECT_EQ(ROWS, expected);
+    }
+};
+
+TEST_F(sql_test, select_paged) {
+    auto res = m_client.get_sql().execute(nullptr, select_all(7, 2), {ROWS});
+
+    EXPECT_EQ(7, res.current_page().size());
+    check_all_rows(res);
+}
+
+TEST_F(sql_test, select_paged_no_prefetch) {
+    auto res = m_client.get_sql().execute(nullptr, select_all(7, 0), {ROWS});
+
+    check_all_rows(res);
+}
+
+TEST_F(sql_test, select_single_page) {
+    auto res = m_client.get_sql().execute(nullptr, select_all(1000, 1), {ROWS});
+
+    EXPECT_EQ(ROWS, res.current_page().size());
+    EXPECT_FALSE(res.has_more_pages());
+}
+
+TEST_F(sql_test, select_with_args) {
+    auto res = m_client.get_sql().execute(nullptr, {"SELECT VAL FROM TBL1 WHERE KEY = ?"}, {std::int64_t(42)});
+
+    ASSERT_EQ(1, res.current_page().size());
+    EXPECT_EQ("s-42", res.current_page().front().get<std::string>("val"));
+}
+
+TEST_F(sql_test, close_before_last_page) {
+    auto res = m_client.get_sql().execute(nullptr, select_all(10, 3), {ROWS});
+    ASSERT_TRUE(res.has_more_pages());
+
+    res.close();
+
+    EXPECT_FALSE(res.has_more_pages());
+    EXPECT_THROW(res.fetch_next_page(), ignite_error);
+}
+
+TEST_F(sql_test, dml_affected_rows) {
+    auto res = m_client.get_sql().execute(nullptr, {"UPDATE TBL1 SET VAL = 'x' WHERE KEY < 10 AND KEY >= 0"}, {});
+
+    EXPECT_FALSE(res.has_rowset());
+    EXPECT_EQ(10, res.affected_rows());
+}
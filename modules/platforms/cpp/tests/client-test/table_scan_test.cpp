@@ -0,0 +1,102 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite_runner_suite.h"
+#include "tests/test-common/table_rows_suite.h"
+#include "tests/test-common/test_utils.h"
+
+#include "ignite/client/ignite_client.h"
+#include "ignite/client/ignite_client_configuration.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <set>
+
+using namespace ignite;
+
+/**
+ * Test suite.
+ */
+class table_scan_test : public table_rows_suite<ignite_runner_suite, 200> {};
+
+TEST_F(table_scan_test, scan_reads_all_rows) {
+    table_scan_options options;
+    options.set_page_size(8);
+    options.set_window(2);
+
+    auto scan = m_table.scan(options);
+
+    std::set<std::int64_t> keys;
+    while (auto page = scan.next_page()) {
+        for (auto &row : page->rows) {
+            auto key = row.get<std::int64_t>("key");
+            EXPECT_EQ("s-" + std::to_string(key), row.get<std::string>("val"));
+            keys.insert(key);
+        }
+    }
+
+    EXPECT_FALSE(scan.has_more_pages());
+    EXPECT_EQ(ROWS, keys.size());
+}
+
+TEST_F(table_scan_test, scan_projection) {
+    table_scan_options options;
+    options.set_columns({"key"});
+
+    auto scan = m_table.scan(options);
+
+    std::size_t rows = 0;
+    while (auto page = scan.next_page()) {
+        for (auto &row : page->rows) {
+            EXPECT_EQ(1, row.column_count());
+            ++rows;
+        }
+    }
+
+    EXPECT_EQ(ROWS, rows);
+}
+
+TEST_F(table_scan_test, scan_quoted_names) {
+    table_scan_options options;
+    options.set_columns({"\"KEY\"", "Val"});
+
+    auto scan = m_table.scan(options);
+
+    std::size_t rows = 0;
+    while (auto page = scan.next_page()) {
+        for (auto &row : page->rows) {
+            EXPECT_EQ(2, row.column_count());
+            EXPECT_EQ("s-" + std::to_string(row.get<std::int64_t>("key")), row.get<std::string>("val"));
+            ++rows;
+        }
+    }
+
+    EXPECT_EQ(ROWS, rows);
+}
+
+TEST_F(table_scan_test, scan_close_early) {
+    table_scan_options options;
+    options.set_page_size(4);
+
+    auto scan = m_table.scan(options);
+    ASSERT_TRUE(scan.next_page().has_value());
+
+    scan.close();
+
+    EXPECT_FALSE(scan.has_more_pages());
+}
@@ -0,0 +1,73 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/ignite_client.h"
+#include "ignite/client/ignite_client_configuration.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ignite {
+
+/**
+ * Test suite that fills the test table before each test and cleans it up after.
+ *
+ * The table is "tbl1". The rows have keys from 0 to ROWS - 1 and values "s-<key>".
+ *
+ * @tparam Suite Base suite. Provides the node addresses and the logger.
+ * @tparam Rows Number of test rows.
+ */
+template<typename Suite, std::int64_t Rows>
+class table_rows_suite : public Suite {
+protected:
+    void SetUp() override {
+        ignite_client_configuration cfg{Suite::NODE_ADDRS};
+        cfg.set_logger(Suite::get_logger());
+
+        m_client = ignite_client::start(cfg, std::chrono::seconds(30));
+        m_table = std::move(*m_client.get_tables().get_table("tbl1"));
+
+        std::vector<ignite_tuple> records;
+        for (std::int64_t i = 0; i < ROWS; ++i)
+            records.emplace_back(ignite_tuple{{"key", i}, {"val", "s-" + std::to_string(i)}});
+
+        m_table.record_binary_view().upsert_all(nullptr, records);
+    }
+
+    void TearDown() override {
+        std::vector<ignite_tuple> keys;
+        for (std::int64_t i = 0; i < ROWS; ++i)
+            keys.emplace_back(ignite_tuple{{"key", i}});
+
+        m_table.record_binary_view().remove_all(nullptr, keys);
+    }
+
+    /** Number of test rows. */
+    static constexpr std::int64_t ROWS = Rows;
+
+    /** Ignite client. */
+    ignite_client m_client;
+
+    /** Table. */
+    table m_table;
+};
+
+} // namespace ignite